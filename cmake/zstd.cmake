@@ -0,0 +1,31 @@
+# Copyright 2021 gRPC authors.
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+#     http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+# zstd message compression is optional: with the default "none" provider
+# gRPC is built without it and never advertises "zstd" in
+# grpc-accept-encoding.
+
+if(gRPC_ZSTD_PROVIDER STREQUAL "package")
+  # The zstd installation directory can be configured by setting ZSTD_ROOT_DIR
+  find_path(ZSTD_INCLUDE_DIR zstd.h HINTS ${ZSTD_ROOT_DIR}/include)
+  find_library(ZSTD_LIBRARY NAMES zstd HINTS ${ZSTD_ROOT_DIR}/lib)
+  if(NOT ZSTD_INCLUDE_DIR OR NOT ZSTD_LIBRARY)
+    message(FATAL_ERROR "gRPC_ZSTD_PROVIDER is \"package\" but zstd was not found")
+  endif()
+  set(_gRPC_ZSTD_LIBRARIES ${ZSTD_LIBRARY})
+  include_directories("${ZSTD_INCLUDE_DIR}")
+  add_definitions(-DGRPC_HAVE_ZSTD)
+elseif(NOT gRPC_ZSTD_PROVIDER STREQUAL "none")
+  message(FATAL_ERROR "gRPC_ZSTD_PROVIDER must be \"none\" or \"package\"")
+endif()
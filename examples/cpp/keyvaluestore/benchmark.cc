@@ -0,0 +1,299 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Measures the lookup throughput of a keyvaluestore server started with the
+// same --num_keys=N, e.g.
+//
+//   server --num_keys=5000000 &
+//   benchmark --num_keys=5000000 --threads=16
+//
+// Each of --threads threads keeps one GetValues stream open on its own channel
+// for --seconds seconds, looking up random keys with up to --window requests
+// in flight, or instead looks up --batch random keys per MultiGet call.
+// Meanwhile --updaters threads Put new values for random keys, so that lookups
+// are measured under live updates. Keys are drawn from a Zipf distribution of
+// exponent --zipf, which is uniform by default.
+//
+// With --cache, the lookups go through the CachingInterceptor of client, on a
+// single channel whose cache the threads share, and a CacheInvalidator keeps
+// the cache up to date. This measures the hit ratio and lookup latency the
+// cache achieves on a skewed workload, e.g.
+//
+//   benchmark --num_keys=5000000 --zipf=0.99 --updaters=1 --cache
+//
+// With one request in flight, which is how client does its lookups, a stream
+// completes one lookup per round trip. To see what pipelining or batching
+// gains when round trips are slow, run the benchmark through latency_proxy:
+//
+//   latency_proxy --port=50052 --target=localhost:50051 --delay_ms=5 &
+//   benchmark --target=localhost:50052 --window=1
+//   benchmark --target=localhost:50052 --window=64
+//   benchmark --target=localhost:50052 --batch=64
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpcpp/grpcpp.h>
+
+#include "caching_interceptor.h"
+#include "helper.h"
+
+#ifdef BAZEL_BUILD
+#include "examples/protos/keyvaluestore.grpc.pb.h"
+#else
+#include "keyvaluestore.grpc.pb.h"
+#endif
+
+using Clock = std::chrono::steady_clock;
+using grpc::ClientContext;
+using grpc::ClientReaderWriter;
+using grpc::Status;
+using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiGetRequest;
+using keyvaluestore::MultiGetResponse;
+using keyvaluestore::PutRequest;
+using keyvaluestore::PutResponse;
+using keyvaluestore::Request;
+using keyvaluestore::Response;
+
+struct Options {
+  std::string target = "localhost:50051";
+  size_t num_keys = 1000000;
+  int threads = 8;
+  int updaters = 0;
+  int seconds = 10;
+  // The number of requests each GetValues stream keeps in flight. The server
+  // stops reading a stream with 1024 responses queued, and the stream would
+  // deadlock if the client then blocked writing rather than reading, so this
+  // is capped well below that.
+  int window = 1;
+  // If positive, look up this many keys per MultiGet call instead.
+  int batch = 0;
+  // The exponent of the Zipf distribution the keys are drawn from.
+  double zipf = 0;
+  // Whether GetValues lookups go through a shared cache.
+  bool cache = false;
+};
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  std::string value;
+  if (!(value = GetFlag(argc, argv, "target")).empty()) {
+    options.target = value;
+  }
+  if (!(value = GetFlag(argc, argv, "num_keys")).empty()) {
+    options.num_keys = std::stoul(value);
+  }
+  if (!(value = GetFlag(argc, argv, "threads")).empty()) {
+    options.threads = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "updaters")).empty()) {
+    options.updaters = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "seconds")).empty()) {
+    options.seconds = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "window")).empty()) {
+    options.window = (std::min)((std::max)(std::stoi(value), 1), 512);
+  }
+  if (!(value = GetFlag(argc, argv, "batch")).empty()) {
+    options.batch = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "zipf")).empty()) {
+    options.zipf = std::stod(value);
+  }
+  for (int i = 1; i < argc; i++) {
+    if (std::string(argv[i]) == "--cache") options.cache = true;
+  }
+  if (options.cache) {
+    // CachingInterceptor expects a lookup to be read before the next one is
+    // written, and does not cache MultiGet.
+    options.window = 1;
+    options.batch = 0;
+  }
+  return options;
+}
+
+std::unique_ptr<KeyValueStore::Stub> NewStub(const Options& options) {
+  // A connection per stub, so that the client does not bottleneck on one
+  // connection.
+  grpc::ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  return KeyValueStore::NewStub(grpc::CreateCustomChannel(
+      options.target, grpc::InsecureChannelCredentials(), args));
+}
+
+// Prints the median and tail of latencies, in microseconds.
+void PrintLatencies(std::vector<int64_t>* latencies) {
+  if (latencies->empty()) return;
+  std::sort(latencies->begin(), latencies->end());
+  auto percentile = [latencies](double p) {
+    return (*latencies)[size_t(p * (latencies->size() - 1))];
+  };
+  std::cout << "Latency: p50 " << percentile(0.5) << " us, p90 "
+            << percentile(0.9) << " us, p99 " << percentile(0.99)
+            << " us, p99.9 " << percentile(0.999) << " us" << std::endl;
+}
+
+int main(int argc, char** argv) {
+  const Options options = ParseOptions(argc, argv);
+  if (options.num_keys == 0) {
+    std::cout << "--num_keys must be positive" << std::endl;
+    return 1;
+  }
+  const ZipfDistribution key(options.num_keys, options.zipf);
+  std::shared_ptr<grpc::Channel> cached_channel;
+  CachingInterceptorFactory* caching_factory = nullptr;
+  std::unique_ptr<CacheInvalidator> invalidator;
+  if (options.cache) {
+    std::vector<std::unique_ptr<
+        grpc::experimental::ClientInterceptorFactoryInterface>>
+        interceptor_creators;
+    caching_factory = new CachingInterceptorFactory({kGetValuesMethod});
+    interceptor_creators.emplace_back(caching_factory);
+    cached_channel = grpc::experimental::CreateCustomChannelWithInterceptors(
+        options.target, grpc::InsecureChannelCredentials(),
+        grpc::ChannelArguments(), std::move(interceptor_creators));
+    invalidator.reset(new CacheInvalidator(cached_channel, caching_factory));
+  }
+  std::atomic<bool> done(false);
+  std::atomic<int64_t> lookups(0);
+  std::atomic<int64_t> misses(0);
+  std::atomic<int64_t> puts(0);
+  std::atomic<int64_t> failures(0);
+  // The latency of each GetValues lookup or MultiGet call, in microseconds.
+  std::mutex latencies_mu;
+  std::vector<int64_t> latencies;
+  std::vector<std::thread> threads;
+  for (int t = 0; t < options.threads; t++) {
+    threads.emplace_back([&, t] {
+      std::unique_ptr<KeyValueStore::Stub> stub =
+          options.cache ? KeyValueStore::NewStub(cached_channel)
+                        : NewStub(options);
+      std::mt19937 rng(t);
+      std::vector<int64_t> thread_latencies;
+      auto since = [](Clock::time_point start) {
+        return std::chrono::duration_cast<std::chrono::microseconds>(
+                   Clock::now() - start)
+            .count();
+      };
+      if (options.batch > 0) {
+        MultiGetRequest request;
+        while (!done.load(std::memory_order_relaxed)) {
+          request.clear_keys();
+          for (int i = 0; i < options.batch; i++) {
+            request.add_keys(SyntheticKey(key(&rng)));
+          }
+          MultiGetResponse response;
+          ClientContext context;
+          const Clock::time_point start = Clock::now();
+          if (!stub->MultiGet(&context, request, &response).ok()) {
+            failures.fetch_add(1, std::memory_order_relaxed);
+            continue;
+          }
+          thread_latencies.push_back(since(start));
+          lookups.fetch_add(response.values_size(), std::memory_order_relaxed);
+          for (const std::string& value : response.values()) {
+            if (value.empty()) misses.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+      } else {
+        ClientContext context;
+        std::unique_ptr<ClientReaderWriter<Request, Response>> stream(
+            stub->GetValues(&context));
+        Request request;
+        Response response;
+        // Responses come back in the order of the requests, so the window is
+        // refilled as each one is read.
+        std::deque<Clock::time_point> in_flight;
+        bool ok = true;
+        while (ok && !done.load(std::memory_order_relaxed)) {
+          while (ok && in_flight.size() < size_t(options.window)) {
+            request.set_key(SyntheticKey(key(&rng)));
+            in_flight.push_back(Clock::now());
+            ok = stream->Write(request);
+          }
+          if (!ok || !stream->Read(&response)) break;
+          thread_latencies.push_back(since(in_flight.front()));
+          in_flight.pop_front();
+          lookups.fetch_add(1, std::memory_order_relaxed);
+          if (response.value().empty()) {
+            misses.fetch_add(1, std::memory_order_relaxed);
+          }
+        }
+        stream->WritesDone();
+        while (!in_flight.empty() && stream->Read(&response)) {
+          in_flight.pop_front();
+        }
+        if (!stream->Finish().ok()) failures.fetch_add(1);
+      }
+      std::lock_guard<std::mutex> lock(latencies_mu);
+      latencies.insert(latencies.end(), thread_latencies.begin(),
+                       thread_latencies.end());
+    });
+  }
+  for (int t = 0; t < options.updaters; t++) {
+    threads.emplace_back([&, t] {
+      std::unique_ptr<KeyValueStore::Stub> stub = NewStub(options);
+      std::mt19937 rng(options.threads + t);
+      while (!done.load(std::memory_order_relaxed)) {
+        // Keys keep their synthetic values, so that lookups can still tell
+        // misses from hits.
+        const size_t i = key(&rng);
+        PutRequest request;
+        request.set_key(SyntheticKey(i));
+        request.set_value(SyntheticValue(i));
+        PutResponse response;
+        ClientContext context;
+        if (stub->Put(&context, request, &response).ok()) {
+          puts.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          failures.fetch_add(1, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(options.seconds));
+  done = true;
+  for (std::thread& thread : threads) thread.join();
+  std::cout << (options.batch > 0 ? "MultiGet: " : "GetValues: ")
+            << lookups / options.seconds << " keys/s, "
+            << misses << " misses; Put: " << puts / options.seconds
+            << " QPS; " << failures << " failures" << std::endl;
+  PrintLatencies(&latencies);
+  if (caching_factory != nullptr) {
+    ResponseCache::Stats stats = caching_factory->cache_stats();
+    std::cout << "Cache hit ratio: " << stats.hit_ratio()
+              << ", entries: " << stats.entries
+              << ", evictions: " << stats.evictions
+              << ", invalidating updates: " << invalidator->updates()
+              << std::endl;
+  }
+
+  return 0;
+}
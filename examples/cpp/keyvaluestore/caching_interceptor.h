@@ -16,23 +16,109 @@
  *
  */
 
-#include <map>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <thread>
+#include <utility>
 
+#include <grpcpp/client_context.h>
 #include <grpcpp/support/client_interceptor.h>
 
+#include "response_cache.h"
+#include "single_flight.h"
+
 #ifdef BAZEL_BUILD
 #include "examples/protos/keyvaluestore.grpc.pb.h"
 #else
 #include "keyvaluestore.grpc.pb.h"
 #endif
 
-// This is a naive implementation of a cache. A new cache is for each call. For
-// each new key request, the key is first searched in the map and if found, the
-// interceptor fills in the return value without making a request to the server.
-// Only if the key is not found in the cache do we make a request.
+// Parses the "max-age" and "stale-while-revalidate" directives of a
+// cache-control header value. Directives that are absent leave the
+// corresponding output untouched.
+inline void ParseCacheControl(grpc::string_ref header,
+                              ResponseCache::Clock::duration* ttl,
+                              ResponseCache::Clock::duration* swr) {
+  std::string value(header.data(), header.size());
+  size_t pos = 0;
+  while (pos < value.size()) {
+    size_t end = value.find(',', pos);
+    if (end == std::string::npos) end = value.size();
+    std::string directive = value.substr(pos, end - pos);
+    pos = end + 1;
+    size_t first = directive.find_first_not_of(' ');
+    if (first == std::string::npos) continue;
+    directive = directive.substr(first);
+    size_t eq = directive.find('=');
+    if (eq == std::string::npos) continue;
+    std::string name = directive.substr(0, eq);
+    long seconds = strtol(directive.c_str() + eq + 1, nullptr, 10);
+    if (seconds < 0) continue;
+    if (name == "max-age") {
+      *ttl = std::chrono::seconds(seconds);
+    } else if (name == "stale-while-revalidate") {
+      *swr = std::chrono::seconds(seconds);
+    }
+  }
+}
+
+// The full name of the only method that is cached.
+constexpr char kGetValuesMethod[] = "/keyvaluestore.KeyValueStore/GetValues";
+
+// Requests are identical iff they target the same method with the same
+// serialized bytes. Method names never contain a NUL, so the separator keeps
+// the key unambiguous.
+inline std::string CacheKey(const std::string& method,
+                            const keyvaluestore::Request& request) {
+  std::string cache_key = method;
+  cache_key.push_back('\0');
+  cache_key.append(request.SerializeAsString());
+  return cache_key;
+}
+
+// Caches GetValues responses in a ResponseCache that is shared by every call
+// on the channel. For each new key request, the key is first searched in the
+// cache and if found, the interceptor fills in the return value without making
+// a request to the server. Only if the key is not found in the cache do we
+// make a request. Stale entries are served immediately while the refresh is
+// written on this call's stream; its response is read before the next request
+// that needs the stream, so the refresh does not delay the caller.
+//
+// Entries live for the max-age the server sends in a cache-control header, or
+// for the cache's default TTL if it sends none. A CacheInvalidator drops them
+// sooner when the server reports that their key was updated.
+//
+// Each call has to be hijacked up front, since whether its lookups hit the
+// cache is only known once they are sent. The stream to the server is only
+// opened on the first lookup that needs it, so a call that is entirely
+// answered from the cache costs no stream.
+//
+// If |single_flight| is non-null, concurrent cache misses for the same request
+// on different calls are coalesced into a single request to the server.
 class CachingInterceptor : public grpc::experimental::Interceptor {
  public:
-  CachingInterceptor(grpc::experimental::ClientRpcInfo* info) {}
+  CachingInterceptor(grpc::experimental::ClientRpcInfo* info,
+                     ResponseCache* cache, SingleFlight* single_flight)
+      : method_(info->method()),
+        cache_(cache),
+        single_flight_(single_flight),
+        ttl_(cache->options().default_ttl),
+        stale_while_revalidate_(
+            cache->options().default_stale_while_revalidate) {}
+
+  ~CachingInterceptor() override {
+    for (const auto& revalidation : pending_revalidations_) {
+      cache_->AbandonRevalidation(revalidation.first);
+    }
+  }
 
   void Intercept(
       ::grpc::experimental::InterceptorBatchMethods* methods) override {
@@ -42,10 +128,9 @@ class CachingInterceptor : public grpc::experimental::Interceptor {
                 PRE_SEND_INITIAL_METADATA)) {
       // Hijack all calls
       hijack = true;
-      // Create a stream on which this interceptor can make requests
-      stub_ = keyvaluestore::KeyValueStore::NewStub(
-          methods->GetInterceptedChannel());
-      stream_ = stub_->GetValues(&context_);
+      // Keep the channel on which this interceptor can make requests, should
+      // it need to.
+      channel_ = methods->GetInterceptedChannel();
     }
     if (methods->QueryInterceptionHookPoint(
             grpc::experimental::InterceptionHookPoints::PRE_SEND_MESSAGE)) {
@@ -68,34 +153,63 @@ class CachingInterceptor : public grpc::experimental::Interceptor {
                 .ok());
         requested_key = req_msg.key();
       }
+      keyvaluestore::Request req;
+      req.set_key(requested_key);
+      const std::string cache_key = CacheKey(method_, req);
 
-      // Check if the key is present in the map
-      auto search = cached_map_.find(requested_key);
-      if (search != cached_map_.end()) {
-        std::cout << "Key " << requested_key << "found in map";
-        response_ = search->second;
-      } else {
-        std::cout << "Key " << requested_key << "not found in cache";
-        // Key was not found in the cache, so make a request
-        keyvaluestore::Request req;
-        req.set_key(requested_key);
-        stream_->Write(req);
-        keyvaluestore::Response resp;
-        stream_->Read(&resp);
-        response_ = resp.value();
-        // Insert the pair in the cache for future requests
-        cached_map_.insert({requested_key, response_});
+      // Responses are only cached if the key was not invalidated since this
+      // lookup, as they may have been read before the invalidating update.
+      uint64_t generation;
+      switch (cache_->Get(cache_key, &response_, &generation)) {
+        case ResponseCache::LookupResult::kFresh:
+        case ResponseCache::LookupResult::kStale:
+          break;
+        case ResponseCache::LookupResult::kStaleRevalidate:
+          if (Stream()->Write(req)) {
+            pending_revalidations_.emplace_back(cache_key, generation);
+          } else {
+            cache_->AbandonRevalidation(cache_key);
+          }
+          break;
+        case ResponseCache::LookupResult::kMiss: {
+          // Key was not found in the cache, so make a request, and insert the
+          // response in the cache for future requests. Calls that share the
+          // request leave that to the call that makes it.
+          auto fetch = [this, &req, &cache_key,
+                        generation](std::string* value) {
+            keyvaluestore::Response resp;
+            if (!ReadRevalidations() || !Stream()->Write(req) ||
+                !stream_->Read(&resp)) {
+              return false;
+            }
+            MaybeParseCacheControl();
+            *value = resp.SerializeAsString();
+            cache_->PutIfUnchanged(cache_key, *value, ttl_,
+                                   stale_while_revalidate_, generation);
+            return true;
+          };
+          bool ok = single_flight_ != nullptr
+                        ? single_flight_->Do(cache_key, fetch, &response_)
+                        : fetch(&response_);
+          if (!ok) response_.clear();
+          break;
+        }
       }
     }
     if (methods->QueryInterceptionHookPoint(
             grpc::experimental::InterceptionHookPoints::PRE_SEND_CLOSE)) {
-      stream_->WritesDone();
+      // A call that was answered entirely from the cache, or by other calls'
+      // fetches, never opened a stream.
+      if (stream_ != nullptr) {
+        ReadRevalidations();
+        stream_->WritesDone();
+      }
     }
     if (methods->QueryInterceptionHookPoint(
             grpc::experimental::InterceptionHookPoints::PRE_RECV_MESSAGE)) {
       keyvaluestore::Response* resp =
           static_cast<keyvaluestore::Response*>(methods->GetRecvMessage());
-      resp->set_value(response_);
+      resp->ParseFromString(response_);
     }
     if (methods->QueryInterceptionHookPoint(
             grpc::experimental::InterceptionHookPoints::PRE_RECV_STATUS)) {
@@ -115,20 +229,186 @@ class CachingInterceptor : public grpc::experimental::Interceptor {
   }
 
  private:
+  // Returns the stream on which this interceptor makes requests, opening it
+  // on first use.
+  grpc::ClientReaderWriter<keyvaluestore::Request, keyvaluestore::Response>*
+  Stream() {
+    if (stream_ == nullptr) {
+      stub_ = keyvaluestore::KeyValueStore::NewStub(channel_);
+      stream_ = stub_->GetValues(&context_);
+    }
+    return stream_.get();
+  }
+
+  // Reads the responses to revalidation requests written earlier on the
+  // stream, which precede any response to a request written after them.
+  bool ReadRevalidations() {
+    while (!pending_revalidations_.empty()) {
+      std::pair<std::string, uint64_t> revalidation =
+          std::move(pending_revalidations_.front());
+      pending_revalidations_.pop_front();
+      const std::string& cache_key = revalidation.first;
+      keyvaluestore::Response resp;
+      if (!stream_->Read(&resp)) {
+        cache_->AbandonRevalidation(cache_key);
+        return false;
+      }
+      MaybeParseCacheControl();
+      if (!cache_->PutIfUnchanged(cache_key, resp.SerializeAsString(), ttl_,
+                                  stale_while_revalidate_,
+                                  revalidation.second)) {
+        // The key's slot was invalidated, but the entry may still be there.
+        cache_->AbandonRevalidation(cache_key);
+      }
+    }
+    return true;
+  }
+
+  // Server initial metadata is available once the first response is read.
+  void MaybeParseCacheControl() {
+    if (cache_control_parsed_) return;
+    cache_control_parsed_ = true;
+    const auto& metadata = context_.GetServerInitialMetadata();
+    auto it = metadata.find("cache-control");
+    if (it != metadata.end()) {
+      ParseCacheControl(it->second, &ttl_, &stale_while_revalidate_);
+    }
+  }
+
+  const std::string method_;
+  ResponseCache* cache_;
+  SingleFlight* single_flight_;
+  ResponseCache::Clock::duration ttl_;
+  ResponseCache::Clock::duration stale_while_revalidate_;
+  bool cache_control_parsed_ = false;
+  std::shared_ptr<grpc::ChannelInterface> channel_;
   grpc::ClientContext context_;
   std::unique_ptr<keyvaluestore::KeyValueStore::Stub> stub_;
   std::unique_ptr<
       grpc::ClientReaderWriter<keyvaluestore::Request, keyvaluestore::Response>>
       stream_;
-  std::map<std::string, std::string> cached_map_;
+  // Cache keys whose revalidation request has been written but whose
+  // response has not been read yet, in stream order, with the generation
+  // they were looked up at.
+  std::deque<std::pair<std::string, uint64_t>> pending_revalidations_;
+  // Serialized response for the current request.
   std::string response_;
 };
 
 class CachingInterceptorFactory
     : public grpc::experimental::ClientInterceptorFactoryInterface {
  public:
+  // Identical in-flight requests to any of |coalesced_methods| (full method
+  // names such as "/keyvaluestore.KeyValueStore/GetValues") are merged into a
+  // single request. Only idempotent methods should be listed. At most
+  // |max_in_flight| distinct requests are tracked at a time.
+  explicit CachingInterceptorFactory(
+      std::set<std::string> coalesced_methods = {},
+      const ResponseCache::Options& cache_options = ResponseCache::Options(),
+      size_t max_in_flight = 1024)
+      : coalesced_methods_(std::move(coalesced_methods)),
+        cache_(cache_options),
+        single_flight_(max_in_flight) {}
+
   grpc::experimental::Interceptor* CreateClientInterceptor(
       grpc::experimental::ClientRpcInfo* info) override {
-    return new CachingInterceptor(info);
+    // Only GetValues lookups are cached; other calls are not intercepted.
+    if (std::string(info->method()) != kGetValuesMethod) return nullptr;
+    SingleFlight* single_flight =
+        coalesced_methods_.count(info->method()) > 0 ? &single_flight_
+                                                     : nullptr;
+    return new CachingInterceptor(info, &cache_, single_flight);
+  }
+
+  // Cache counters and memory use, shared across all calls on the channel.
+  ResponseCache::Stats cache_stats() { return cache_.stats(); }
+
+  // Drops the cached value of |key|.
+  void Invalidate(const std::string& key) {
+    keyvaluestore::Request request;
+    request.set_key(key);
+    cache_.Erase(CacheKey(kGetValuesMethod, request));
+  }
+
+  // Drops every cached value.
+  void InvalidateAll() { cache_.Clear(); }
+
+  // Coalescing counters, shared across all calls on the channel.
+  SingleFlight::Stats coalescing_stats() const {
+    return single_flight_.stats();
+  }
+
+ private:
+  const std::set<std::string> coalesced_methods_;
+  ResponseCache cache_;
+  SingleFlight single_flight_;
+};
+
+// Keeps the cache of a CachingInterceptorFactory consistent with the server
+// while it lives: watches the updates the server pushes on |channel|, and drops
+// the cached value of each updated key as soon as it is notified.
+//
+// Values cached while no Watch call is established may have missed updates,
+// so the whole cache is dropped whenever the call starts or fails. A failed
+// call is retried every second. Invalidating a key also drops the responses
+// to it that are being fetched, which may have been read before the update.
+class CacheInvalidator {
+ public:
+  CacheInvalidator(std::shared_ptr<grpc::ChannelInterface> channel,
+                   CachingInterceptorFactory* factory)
+      : stub_(keyvaluestore::KeyValueStore::NewStub(std::move(channel))),
+        factory_(factory),
+        thread_([this] { Run(); }) {}
+
+  ~CacheInvalidator() {
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      shutdown_ = true;
+      if (context_ != nullptr) context_->TryCancel();
+    }
+    cv_.notify_all();
+    thread_.join();
+  }
+
+  // The number of updates the server pushed.
+  uint64_t updates() const { return updates_.load(std::memory_order_relaxed); }
+
+ private:
+  void Run() {
+    while (true) {
+      grpc::ClientContext context;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        if (shutdown_) return;
+        context_ = &context;
+      }
+      std::unique_ptr<grpc::ClientReader<keyvaluestore::KeyUpdate>> reader(
+          stub_->Watch(&context, keyvaluestore::WatchRequest()));
+      // The server sends its initial metadata once it notifies the call of
+      // every update, so any value cached before then may be stale.
+      reader->WaitForInitialMetadata();
+      factory_->InvalidateAll();
+      keyvaluestore::KeyUpdate update;
+      while (reader->Read(&update)) {
+        factory_->Invalidate(update.key());
+        updates_.fetch_add(1, std::memory_order_relaxed);
+      }
+      reader->Finish();
+      factory_->InvalidateAll();
+      std::unique_lock<std::mutex> lock(mu_);
+      context_ = nullptr;
+      cv_.wait_for(lock, std::chrono::seconds(1), [this] { return shutdown_; });
+    }
   }
+
+  std::unique_ptr<keyvaluestore::KeyValueStore::Stub> stub_;
+  CachingInterceptorFactory* const factory_;
+  std::atomic<uint64_t> updates_{0};
+  std::mutex mu_;
+  std::condition_variable cv_;
+  bool shutdown_ = false;
+  // The context of the current Watch call, if any.
+  grpc::ClientContext* context_ = nullptr;
+  // Started last, since it uses the other members.
+  std::thread thread_;
 };
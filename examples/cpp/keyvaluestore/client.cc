@@ -19,6 +19,7 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <thread>
 #include <vector>
 
 #include <grpcpp/grpcpp.h>
@@ -35,6 +36,8 @@ using grpc::Channel;
 using grpc::ClientContext;
 using grpc::Status;
 using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiGetRequest;
+using keyvaluestore::MultiGetResponse;
 using keyvaluestore::Request;
 using keyvaluestore::Response;
 
@@ -70,6 +73,28 @@ class KeyValueStoreClient {
     }
   }
 
+  // Requests all the keys in the vector at once, and displays each key and its
+  // corresponding value as a pair. Unlike GetValues, this takes a single round
+  // trip however many keys there are.
+  void MultiGet(const std::vector<std::string>& keys) {
+    ClientContext context;
+    MultiGetRequest request;
+    for (const auto& key : keys) {
+      request.add_keys(key);
+    }
+    MultiGetResponse response;
+    Status status = stub_->MultiGet(&context, request, &response);
+    if (!status.ok()) {
+      std::cout << status.error_code() << ": " << status.error_message()
+                << std::endl;
+      std::cout << "RPC failed";
+      return;
+    }
+    for (int i = 0; i < response.values_size(); ++i) {
+      std::cout << keys[i] << " : " << response.values(i) << "\n";
+    }
+  }
+
  private:
   std::unique_ptr<KeyValueStore::Stub> stub_;
 };
@@ -85,15 +110,42 @@ int main(int argc, char** argv) {
   std::vector<
       std::unique_ptr<grpc::experimental::ClientInterceptorFactoryInterface>>
       interceptor_creators;
-  interceptor_creators.push_back(std::unique_ptr<CachingInterceptorFactory>(
-      new CachingInterceptorFactory()));
+  // GetValues is a pure lookup, so identical requests that are in flight at
+  // the same time on different calls can safely share one response.
+  auto* caching_factory = new CachingInterceptorFactory(
+      {"/keyvaluestore.KeyValueStore/GetValues"});
+  interceptor_creators.push_back(
+      std::unique_ptr<CachingInterceptorFactory>(caching_factory));
   auto channel = grpc::experimental::CreateCustomChannelWithInterceptors(
       "localhost:50051", grpc::InsecureChannelCredentials(), args,
       std::move(interceptor_creators));
+  // Drop cached values as soon as the server reports that they changed.
+  CacheInvalidator invalidator(channel, caching_factory);
   KeyValueStoreClient client(channel);
   std::vector<std::string> keys = {"key1", "key2", "key3", "key4",
                                    "key5", "key1", "key2", "key4"};
+  // Issue the same lookups from several threads at once so that the cache
+  // misses on different calls overlap and get coalesced.
+  std::vector<std::thread> threads;
+  for (int i = 0; i < 4; ++i) {
+    threads.emplace_back([&client, &keys] { client.GetValues(keys); });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+  // Every key is cached by now, so this call is answered entirely from the
+  // cache and opens no stream to the server.
   client.GetValues(keys);
+  // Batched lookups are not cached.
+  client.MultiGet(keys);
+  SingleFlight::Stats stats = caching_factory->coalescing_stats();
+  std::cout << "Requests sent: " << stats.leaders
+            << ", merged: " << stats.merged
+            << ", bypassed: " << stats.bypassed << std::endl;
+  ResponseCache::Stats cache_stats = caching_factory->cache_stats();
+  std::cout << "Cache hit ratio: " << cache_stats.hit_ratio()
+            << ", entries: " << cache_stats.entries
+            << ", bytes: " << cache_stats.bytes << std::endl;
 
   return 0;
 }
@@ -0,0 +1,75 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_KEYVALUESTORE_HELPER_H
+#define GRPC_EXAMPLES_CPP_KEYVALUESTORE_HELPER_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <random>
+#include <string>
+#include <vector>
+
+// Returns the value of the --name=value argument, or "" if there is none.
+inline std::string GetFlag(int argc, char** argv, const std::string& name) {
+  const std::string prefix = "--" + name + "=";
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg.compare(0, prefix.size(), prefix) == 0) {
+      return arg.substr(prefix.size());
+    }
+  }
+  return "";
+}
+
+// The server is loaded with the keys "key1" to "keyN", where the value of
+// "keyI" is "valueI".
+inline std::string SyntheticKey(size_t i) { return "key" + std::to_string(i); }
+
+inline std::string SyntheticValue(size_t i) {
+  return "value" + std::to_string(i);
+}
+
+// Draws i in [1, n] with a probability proportional to 1 / i^s, i.e. from a
+// Zipf distribution in which i is the i-th most popular value. s = 0 gives a
+// uniform distribution, and the larger s, the more skewed the distribution.
+class ZipfDistribution {
+ public:
+  ZipfDistribution(size_t n, double s) : cdf_(n) {
+    double sum = 0;
+    for (size_t i = 0; i < n; i++) {
+      sum += std::pow(double(i + 1), -s);
+      cdf_[i] = sum;
+    }
+    for (double& p : cdf_) p /= sum;
+  }
+
+  size_t operator()(std::mt19937* rng) const {
+    const double u = std::uniform_real_distribution<double>(0, 1)(*rng);
+    const size_t i =
+        std::upper_bound(cdf_.begin(), cdf_.end(), u) - cdf_.begin();
+    // Rounding may leave the last value of the CDF just below 1.
+    return (std::min)(i, cdf_.size() - 1) + 1;
+  }
+
+ private:
+  std::vector<double> cdf_;
+};
+
+#endif  // GRPC_EXAMPLES_CPP_KEYVALUESTORE_HELPER_H
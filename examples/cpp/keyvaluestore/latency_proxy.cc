@@ -0,0 +1,213 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Forwards the TCP connections made to localhost:--port to --target, and
+// delays the bytes sent in each direction by --delay_ms milliseconds, so that
+// clients on this machine see the server as if it were a round trip of twice
+// that away, e.g.
+//
+//   latency_proxy --port=50052 --target=localhost:50051 --delay_ms=5
+//
+// The delay does not limit bandwidth: bytes are forwarded in the chunks they
+// were read in, each a delay after it was read. This is only meant for
+// benchmarks, and only supports POSIX systems.
+
+#include <iostream>
+#include <string>
+
+#include "helper.h"
+
+#ifdef _WIN32
+
+int main(int argc, char** argv) {
+  std::cout << "latency_proxy is not supported on Windows" << std::endl;
+  return 1;
+}
+
+#else
+
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+using Clock = std::chrono::steady_clock;
+
+// The bytes read from one socket that are waiting to be written to another.
+class DelayLine {
+ public:
+  // Queues data to be released delay from now. Empty data marks the end.
+  void Push(std::string data, Clock::duration delay) {
+    std::lock_guard<std::mutex> lock(mu_);
+    chunks_.emplace_back(Clock::now() + delay, std::move(data));
+    cv_.notify_one();
+  }
+
+  // Waits until the oldest data is due and returns it.
+  std::string Pop() {
+    std::unique_lock<std::mutex> lock(mu_);
+    cv_.wait(lock, [this] { return !chunks_.empty(); });
+    std::pair<Clock::time_point, std::string> chunk =
+        std::move(chunks_.front());
+    chunks_.pop_front();
+    lock.unlock();
+    std::this_thread::sleep_until(chunk.first);
+    return std::move(chunk.second);
+  }
+
+ private:
+  std::mutex mu_;
+  std::condition_variable cv_;
+  // Every chunk is delayed equally, so they are due in order.
+  std::deque<std::pair<Clock::time_point, std::string>> chunks_;
+};
+
+// A proxied connection. Each direction is forwarded by a reader thread and a
+// writer thread, which share ownership of the connection.
+class Connection {
+ public:
+  Connection(int client_fd, int server_fd)
+      : client_fd_(client_fd), server_fd_(server_fd) {}
+  ~Connection() {
+    close(client_fd_);
+    close(server_fd_);
+  }
+
+  static void Start(std::shared_ptr<Connection> c, Clock::duration delay) {
+    Forward(c, c->client_fd_, c->server_fd_, &c->to_server_, delay);
+    Forward(c, c->server_fd_, c->client_fd_, &c->to_client_, delay);
+  }
+
+ private:
+  static void Forward(std::shared_ptr<Connection> c, int from, int to,
+                      DelayLine* line, Clock::duration delay) {
+    std::thread([c, from, line, delay] {
+      char buf[64 * 1024];
+      ssize_t n;
+      while ((n = read(from, buf, sizeof(buf))) > 0) {
+        line->Push(std::string(buf, n), delay);
+      }
+      line->Push(std::string(), delay);
+    }).detach();
+    std::thread([c, from, to, line] {
+      std::string data;
+      while (!(data = line->Pop()).empty()) {
+        if (!WriteAll(to, data)) {
+          // The peer is gone, so stop reading from the other side too.
+          shutdown(from, SHUT_RD);
+          break;
+        }
+      }
+      shutdown(to, SHUT_WR);
+    }).detach();
+  }
+
+  static bool WriteAll(int fd, const std::string& data) {
+    size_t written = 0;
+    while (written < data.size()) {
+      ssize_t n = write(fd, data.data() + written, data.size() - written);
+      if (n <= 0) return false;
+      written += n;
+    }
+    return true;
+  }
+
+  const int client_fd_;
+  const int server_fd_;
+  DelayLine to_server_;
+  DelayLine to_client_;
+};
+
+// Connects to host:port and returns the socket, or -1.
+int Connect(const std::string& target) {
+  const size_t colon = target.rfind(':');
+  if (colon == std::string::npos) return -1;
+  const std::string host = target.substr(0, colon);
+  const std::string port = target.substr(colon + 1);
+  addrinfo hints = {};
+  hints.ai_family = AF_UNSPEC;
+  hints.ai_socktype = SOCK_STREAM;
+  addrinfo* addrs;
+  if (getaddrinfo(host.c_str(), port.c_str(), &hints, &addrs) != 0) return -1;
+  int fd = -1;
+  for (addrinfo* a = addrs; a != nullptr && fd < 0; a = a->ai_next) {
+    fd = socket(a->ai_family, a->ai_socktype, a->ai_protocol);
+    if (fd >= 0 && connect(fd, a->ai_addr, a->ai_addrlen) != 0) {
+      close(fd);
+      fd = -1;
+    }
+  }
+  freeaddrinfo(addrs);
+  return fd;
+}
+
+int main(int argc, char** argv) {
+  int port = 50052;
+  std::string target = "localhost:50051";
+  int delay_ms = 5;
+  std::string value;
+  if (!(value = GetFlag(argc, argv, "port")).empty()) port = std::stoi(value);
+  if (!(value = GetFlag(argc, argv, "target")).empty()) target = value;
+  if (!(value = GetFlag(argc, argv, "delay_ms")).empty()) {
+    delay_ms = std::stoi(value);
+  }
+  const Clock::duration delay = std::chrono::milliseconds(delay_ms);
+
+  int listen_fd = socket(AF_INET, SOCK_STREAM, 0);
+  int one = 1;
+  setsockopt(listen_fd, SOL_SOCKET, SO_REUSEADDR, &one, sizeof(one));
+  sockaddr_in addr = {};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  if (bind(listen_fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0 ||
+      listen(listen_fd, SOMAXCONN) != 0) {
+    std::cout << "Failed to listen on port " << port << std::endl;
+    return 1;
+  }
+  std::cout << "Proxying localhost:" << port << " to " << target << " with "
+            << delay_ms << " ms of delay each way" << std::endl;
+  while (true) {
+    int client_fd = accept(listen_fd, nullptr, nullptr);
+    if (client_fd < 0) continue;
+    int server_fd = Connect(target);
+    if (server_fd < 0) {
+      std::cout << "Failed to connect to " << target << std::endl;
+      close(client_fd);
+      continue;
+    }
+    // Send each chunk when it is due rather than waiting to coalesce it.
+    setsockopt(client_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    setsockopt(server_fd, IPPROTO_TCP, TCP_NODELAY, &one, sizeof(one));
+    Connection::Start(std::make_shared<Connection>(client_fd, server_fd),
+                      delay);
+  }
+
+  return 0;
+}
+
+#endif  // _WIN32
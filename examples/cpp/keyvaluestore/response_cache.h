@@ -0,0 +1,288 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_KEYVALUESTORE_RESPONSE_CACHE_H
+#define GRPC_EXAMPLES_CPP_KEYVALUESTORE_RESPONSE_CACHE_H
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// A thread-safe cache of serialized responses, keyed by method plus serialized
+// request bytes, that can be shared by every call on a channel.
+//
+// Entries are spread over independently locked shards so that concurrent
+// lookups rarely contend. Each shard is an LRU list with its own slice of the
+// overall byte budget; inserting past the budget evicts the least recently
+// used entries of that shard.
+//
+// Every entry is fresh for its TTL. After that it may still be served for a
+// further stale-while-revalidate window: the first lookup in the window is
+// told to refresh the entry, and other lookups keep getting the stale value
+// until the refreshed one is inserted. Past the window the entry is dropped.
+//
+// A response fetched after a lookup missed may predate an invalidation that
+// Erase() or Clear() applied while it was in flight. Get() therefore returns
+// the generation of the key, which every invalidation of the key bumps, and
+// PutIfUnchanged() only inserts the response if the generation is the same.
+// Generations are tracked for slots of keys rather than for each key, so that
+// they take no memory per key; an invalidation may drop the fills of other
+// keys of its slot, which only costs them another miss.
+class ResponseCache {
+ public:
+  using Clock = std::chrono::steady_clock;
+
+  struct Options {
+    size_t num_shards = 16;
+    // Upper bound on the memory charged to entries, across all shards.
+    size_t max_bytes = 64 * 1024 * 1024;
+    // Used for entries whose response did not carry its own lifetime.
+    Clock::duration default_ttl = std::chrono::seconds(60);
+    Clock::duration default_stale_while_revalidate = std::chrono::seconds(0);
+  };
+
+  enum class LookupResult {
+    // No usable entry; the caller must fetch the response.
+    kMiss,
+    // The entry is fresh.
+    kFresh,
+    // The entry is stale and another caller is already refreshing it.
+    kStale,
+    // The entry is stale and this caller should refresh it, then call Put()
+    // on success or AbandonRevalidation() on failure.
+    kStaleRevalidate,
+  };
+
+  struct Stats {
+    uint64_t fresh_hits = 0;
+    uint64_t stale_hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+    size_t entries = 0;
+    size_t bytes = 0;
+
+    double hit_ratio() const {
+      uint64_t lookups = fresh_hits + stale_hits + misses;
+      return lookups == 0 ? 0 : double(fresh_hits + stale_hits) / lookups;
+    }
+  };
+
+  ResponseCache() : ResponseCache(Options()) {}
+
+  explicit ResponseCache(const Options& options)
+      : options_(options),
+        shards_(options.num_shards > 0 ? options.num_shards : 1) {
+    shard_max_bytes_ = options_.max_bytes / shards_.size();
+  }
+
+  const Options& options() const { return options_; }
+
+  // If |generation| is not null, it is set to the generation of |key|, to
+  // pass to PutIfUnchanged() with the refreshed response.
+  LookupResult Get(const std::string& key, std::string* value,
+                   uint64_t* generation = nullptr) {
+    const size_t hash = Hash(key);
+    Shard& shard = ShardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mu);
+    if (generation != nullptr) *generation = shard.GenerationFor(hash);
+    auto it = shard.index.find(key);
+    if (it == shard.index.end()) {
+      ++shard.misses;
+      return LookupResult::kMiss;
+    }
+    Entry& entry = *it->second;
+    Clock::time_point now = Clock::now();
+    if (now >= entry.stale_until) {
+      shard.Erase(it);
+      ++shard.misses;
+      return LookupResult::kMiss;
+    }
+    shard.lru.splice(shard.lru.begin(), shard.lru, it->second);
+    *value = entry.value;
+    if (now < entry.fresh_until) {
+      ++shard.fresh_hits;
+      return LookupResult::kFresh;
+    }
+    ++shard.stale_hits;
+    if (entry.revalidating) return LookupResult::kStale;
+    entry.revalidating = true;
+    return LookupResult::kStaleRevalidate;
+  }
+
+  void Put(const std::string& key, std::string value) {
+    Put(key, std::move(value), options_.default_ttl,
+        options_.default_stale_while_revalidate);
+  }
+
+  void Put(const std::string& key, std::string value, Clock::duration ttl,
+           Clock::duration stale_while_revalidate) {
+    Insert(key, std::move(value), ttl, stale_while_revalidate, nullptr);
+  }
+
+  // Like Put(), but returns false without inserting |value| if |key| was
+  // invalidated since Get() returned |generation|.
+  bool PutIfUnchanged(const std::string& key, std::string value,
+                      Clock::duration ttl,
+                      Clock::duration stale_while_revalidate,
+                      uint64_t generation) {
+    return Insert(key, std::move(value), ttl, stale_while_revalidate,
+                  &generation);
+  }
+
+  // Lets another caller refresh |key| after a failed revalidation.
+  void AbandonRevalidation(const std::string& key) {
+    Shard& shard = ShardFor(Hash(key));
+    std::lock_guard<std::mutex> lock(shard.mu);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) it->second->revalidating = false;
+  }
+
+  // Drops the entry of |key|, and any response to it that is being fetched.
+  void Erase(const std::string& key) {
+    const size_t hash = Hash(key);
+    Shard& shard = ShardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mu);
+    ++shard.GenerationFor(hash);
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) shard.Erase(it);
+  }
+
+  // Drops every entry, and every response that is being fetched.
+  void Clear() {
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mu);
+      for (uint64_t& generation : shard.generations) ++generation;
+      shard.lru.clear();
+      shard.index.clear();
+      shard.bytes = 0;
+    }
+  }
+
+  Stats stats() {
+    Stats stats;
+    for (Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mu);
+      stats.fresh_hits += shard.fresh_hits;
+      stats.stale_hits += shard.stale_hits;
+      stats.misses += shard.misses;
+      stats.evictions += shard.evictions;
+      stats.entries += shard.index.size();
+      stats.bytes += shard.bytes;
+    }
+    return stats;
+  }
+
+ private:
+  // The number of generation slots of each shard.
+  static constexpr size_t kGenerationSlots = 64;
+
+  struct Entry {
+    std::string key;
+    std::string value;
+    size_t charge = 0;
+    Clock::time_point fresh_until;
+    Clock::time_point stale_until;
+    bool revalidating = false;
+  };
+
+  struct Shard {
+    using Index =
+        std::unordered_map<std::string, std::list<Entry>::iterator>;
+
+    void Erase(Index::iterator it) {
+      bytes -= it->second->charge;
+      lru.erase(it->second);
+      index.erase(it);
+    }
+
+    // The shard is picked by the low bits of the hash, so the slot is picked
+    // by higher ones.
+    uint64_t& GenerationFor(size_t hash) {
+      return generations[(hash >> 16) % kGenerationSlots];
+    }
+
+    std::mutex mu;
+    // Most recently used first.
+    std::list<Entry> lru;
+    Index index;
+    size_t bytes = 0;
+    uint64_t generations[kGenerationSlots] = {};
+    uint64_t fresh_hits = 0;
+    uint64_t stale_hits = 0;
+    uint64_t misses = 0;
+    uint64_t evictions = 0;
+  };
+
+  // Inserts |value| unless |generation| is not null and no longer current.
+  bool Insert(const std::string& key, std::string value, Clock::duration ttl,
+              Clock::duration stale_while_revalidate,
+              const uint64_t* generation) {
+    size_t charge = Charge(key, value);
+    // Entries that could never fit are not cached at all rather than flushing
+    // the whole shard.
+    if (charge > shard_max_bytes_) return true;
+    const size_t hash = Hash(key);
+    Shard& shard = ShardFor(hash);
+    std::lock_guard<std::mutex> lock(shard.mu);
+    if (generation != nullptr && *generation != shard.GenerationFor(hash)) {
+      return false;
+    }
+    auto it = shard.index.find(key);
+    if (it != shard.index.end()) shard.Erase(it);
+    while (shard.bytes + charge > shard_max_bytes_) {
+      shard.Erase(shard.index.find(shard.lru.back().key));
+      ++shard.evictions;
+    }
+    Clock::time_point now = Clock::now();
+    shard.lru.push_front(Entry());
+    Entry& entry = shard.lru.front();
+    entry.key = key;
+    entry.value = std::move(value);
+    entry.charge = charge;
+    entry.fresh_until = now + ttl;
+    entry.stale_until = entry.fresh_until + stale_while_revalidate;
+    shard.index.emplace(key, shard.lru.begin());
+    shard.bytes += charge;
+    return true;
+  }
+
+  // The key is stored twice (list entry and index), plus roughly the
+  // bookkeeping of both containers.
+  static size_t Charge(const std::string& key, const std::string& value) {
+    return 2 * key.size() + value.size() + sizeof(Entry) + 64;
+  }
+
+  static size_t Hash(const std::string& key) {
+    return std::hash<std::string>()(key);
+  }
+
+  Shard& ShardFor(size_t hash) { return shards_[hash % shards_.size()]; }
+
+  const Options options_;
+  std::vector<Shard> shards_;
+  size_t shard_max_bytes_;
+};
+
+#endif  // GRPC_EXAMPLES_CPP_KEYVALUESTORE_RESPONSE_CACHE_H
@@ -16,70 +16,413 @@
  *
  */
 
+#include <deque>
 #include <iostream>
 #include <memory>
+#include <mutex>
+#include <set>
 #include <string>
 #include <vector>
 
 #include <grpcpp/grpcpp.h>
 
+#include "helper.h"
+#include "value_store.h"
+
 #ifdef BAZEL_BUILD
 #include "examples/protos/keyvaluestore.grpc.pb.h"
 #else
 #include "keyvaluestore.grpc.pb.h"
 #endif
 
+using grpc::ByteBuffer;
+using grpc::CallbackServerContext;
 using grpc::Server;
+using grpc::ServerBidiReactor;
 using grpc::ServerBuilder;
-using grpc::ServerContext;
-using grpc::ServerReaderWriter;
+using grpc::ServerUnaryReactor;
+using grpc::ServerWriteReactor;
+using grpc::Slice;
 using grpc::Status;
+using grpc::WriteOptions;
+using keyvaluestore::DeleteRequest;
+using keyvaluestore::DeleteResponse;
+using keyvaluestore::KeyUpdate;
 using keyvaluestore::KeyValueStore;
+using keyvaluestore::MultiGetRequest;
+using keyvaluestore::PutRequest;
+using keyvaluestore::PutResponse;
 using keyvaluestore::Request;
-using keyvaluestore::Response;
+using keyvaluestore::WatchRequest;
 
-struct kv_pair {
-  const char* key;
-  const char* value;
-};
+// Answers each request of a GetValues stream with the stored response for its
+// key. Requests and responses are handled as raw byte buffers, so that each
+// response is written straight from the slice the store keeps it in.
+//
+// Reads and writes proceed concurrently: a read is kept outstanding while the
+// responses to earlier requests are written, unless too many of them are
+// queued, so a client that pipelines its requests is not held to one round
+// trip per key.
+class ValueStreamer : public ServerBidiReactor<ByteBuffer, ByteBuffer> {
+ public:
+  explicit ValueStreamer(const ValueStore& store) : store_(store) {
+    StartRead(&request_);
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) {
+      ReadsDone(Status::OK);
+      return;
+    }
+    Request request;
+    if (!grpc::SerializationTraits<Request>::Deserialize(&request_, &request)
+             .ok()) {
+      ReadsDone(Status(grpc::StatusCode::INVALID_ARGUMENT, "Bad request"));
+      return;
+    }
+    Slice response = store_.Get(request.key());
+    bool start_write;
+    bool start_read;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (finished_) return;
+      queue_.push_back(response);
+      start_write = !writing_;
+      writing_ = true;
+      start_read = queue_.size() < kMaxQueuedResponses;
+      read_paused_ = !start_read;
+    }
+    if (start_read) StartRead(&request_);
+    if (start_write) NextWrite();
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      // The client is gone: outstanding reads complete with !ok, but a paused
+      // stream has none, so finish here.
+      bool finish;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        queue_.clear();
+        writing_ = false;
+        finish = !finished_;
+        finished_ = true;
+      }
+      if (finish) {
+        Finish(Status(grpc::StatusCode::UNKNOWN, "Unexpected Failure"));
+      }
+      return;
+    }
+    NextWrite();
+  }
 
-static const kv_pair kvs_map[] = {
-    {"key1", "value1"}, {"key2", "value2"}, {"key3", "value3"},
-    {"key4", "value4"}, {"key5", "value5"},
+  void OnDone() override { delete this; }
+
+ private:
+  // Writes are corked, i.e. handed to the transport without being flushed to
+  // the network, while more responses are queued, up to this many in a row.
+  static constexpr int kMaxBufferedWrites = 16;
+  // Reading stops while this many responses are waiting to be written to a
+  // slow client, so that flow control pushes back on the client.
+  static constexpr size_t kMaxQueuedResponses = 1024;
+
+  // Finishes the stream with status once the queued responses are written.
+  void ReadsDone(const Status& status) {
+    bool finish;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      reads_done_ = true;
+      status_ = status;
+      finish = !writing_ && !finished_;
+      finished_ = finished_ || finish;
+    }
+    if (finish) Finish(status);
+  }
+
+  // Writes the next queued response. Called by the single writer, i.e. with
+  // writing_ set.
+  void NextWrite() {
+    bool write = false;
+    WriteOptions write_options;
+    bool resume_read = false;
+    bool finish = false;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (queue_.empty() || finished_) {
+        writing_ = false;
+        finish = reads_done_ && !finished_;
+        finished_ = finished_ || finish;
+      } else {
+        // The byte buffer only references the stored slice.
+        ByteBuffer response(&queue_.front(), 1);
+        response_.Swap(&response);
+        queue_.pop_front();
+        write = true;
+        if (!queue_.empty() && ++corked_writes_ < kMaxBufferedWrites) {
+          write_options.set_buffer_hint();
+        } else {
+          corked_writes_ = 0;
+        }
+        // Resume reading once half of the queue has drained.
+        if (read_paused_ && queue_.size() <= kMaxQueuedResponses / 2) {
+          read_paused_ = false;
+          resume_read = true;
+        }
+      }
+    }
+    if (write) StartWrite(&response_, write_options);
+    if (resume_read) StartRead(&request_);
+    if (finish) Finish(status_);
+  }
+
+  const ValueStore& store_;
+  // Only used by the single outstanding read.
+  ByteBuffer request_;
+  // Only used by the single outstanding write.
+  ByteBuffer response_;
+  std::mutex mu_;
+  std::deque<Slice> queue_;
+  int corked_writes_ = 0;
+  bool writing_ = false;
+  bool read_paused_ = false;
+  bool reads_done_ = false;
+  bool finished_ = false;
+  Status status_;
 };
 
-const char* get_value_from_map(const char* key) {
-  for (size_t i = 0; i < sizeof(kvs_map) / sizeof(kv_pair); ++i) {
-    if (strcmp(key, kvs_map[i].key) == 0) {
-      return kvs_map[i].value;
+class UpdateBroadcaster;
+
+// Writes the keys that are updated while a Watch call lasts, in the order of
+// the updates.
+//
+// A client that falls more than kMaxQueuedUpdates behind is cut off with
+// RESOURCE_EXHAUSTED, rather than having its updates buffered without bound.
+// Like a client whose Watch call fails for any other reason, it must then
+// assume that it missed updates.
+class UpdateWriter : public ServerWriteReactor<KeyUpdate> {
+ public:
+  explicit UpdateWriter(UpdateBroadcaster* broadcaster);
+
+  // Queues the update of |key|.
+  void Notify(const std::string& key) {
+    bool start_write = false;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (closing_) return;
+      if (queue_.size() >= kMaxQueuedUpdates) {
+        CloseLocked(Status(grpc::StatusCode::RESOURCE_EXHAUSTED,
+                           "Too many updates pending"));
+      } else {
+        queue_.push_back(key);
+        start_write = !writing_;
+        writing_ = true;
+      }
+    }
+    if (start_write) NextWrite();
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      std::lock_guard<std::mutex> lock(mu_);
+      CloseLocked(Status(grpc::StatusCode::UNKNOWN, "Unexpected Failure"));
+    }
+    NextWrite();
+  }
+
+  void OnCancel() override {
+    bool finish;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      CloseLocked(Status::CANCELLED);
+      finish = !writing_ && !finished_;
+      finished_ = finished_ || finish;
+    }
+    if (finish) Finish(status_);
+  }
+
+  void OnDone() override;
+
+ private:
+  static constexpr size_t kMaxQueuedUpdates = 4096;
+
+  // Stops queueing updates, and makes the writer finish the call with status.
+  void CloseLocked(const Status& status) {
+    if (closing_) return;
+    closing_ = true;
+    status_ = status;
+    queue_.clear();
+  }
+
+  // Writes the next queued update, or finishes the call once closing. Called
+  // by the single writer, i.e. with writing_ set.
+  void NextWrite() {
+    bool write = false;
+    bool finish = false;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (queue_.empty()) {
+        writing_ = false;
+        finish = closing_ && !finished_;
+        finished_ = finished_ || finish;
+      } else {
+        update_.set_key(queue_.front());
+        queue_.pop_front();
+        write = true;
+      }
     }
+    if (write) StartWrite(&update_);
+    if (finish) Finish(status_);
+  }
+
+  UpdateBroadcaster* const broadcaster_;
+  // Only used by the single outstanding write.
+  KeyUpdate update_;
+  std::mutex mu_;
+  std::deque<std::string> queue_;
+  bool writing_ = false;
+  bool closing_ = false;
+  bool finished_ = false;
+  Status status_;
+};
+
+// Notifies every Watch call of each update.
+class UpdateBroadcaster {
+ public:
+  void Add(UpdateWriter* writer) {
+    std::lock_guard<std::mutex> lock(mu_);
+    writers_.insert(writer);
   }
-  return "";
+
+  void Remove(UpdateWriter* writer) {
+    std::lock_guard<std::mutex> lock(mu_);
+    writers_.erase(writer);
+  }
+
+  // Must be called after the update of |key| is applied, so that a client
+  // that refetches the key once notified gets the new value.
+  void Broadcast(const std::string& key) {
+    std::lock_guard<std::mutex> lock(mu_);
+    for (UpdateWriter* writer : writers_) writer->Notify(key);
+  }
+
+ private:
+  std::mutex mu_;
+  std::set<UpdateWriter*> writers_;
+};
+
+UpdateWriter::UpdateWriter(UpdateBroadcaster* broadcaster)
+    : broadcaster_(broadcaster) {
+  broadcaster_->Add(this);
+  // Lets the client know that it will be notified of every update from now
+  // on.
+  StartSendInitialMetadata();
 }
 
-// Logic and data behind the server's behavior.
-class KeyValueStoreServiceImpl final : public KeyValueStore::Service {
-  Status GetValues(ServerContext* context,
-                   ServerReaderWriter<Response, Request>* stream) override {
-    Request request;
-    while (stream->Read(&request)) {
-      Response response;
-      response.set_value(get_value_from_map(request.key().c_str()));
-      stream->Write(response);
+void UpdateWriter::OnDone() {
+  broadcaster_->Remove(this);
+  delete this;
+}
+
+// Logic and data behind the server's behavior. GetValues and MultiGet are
+// implemented with the raw callback API, and the other methods with the
+// callback API.
+class KeyValueStoreServiceImpl final
+    : public KeyValueStore::ExperimentalWithRawCallbackMethod_GetValues<
+          KeyValueStore::ExperimentalWithCallbackMethod_Put<
+              KeyValueStore::ExperimentalWithCallbackMethod_Delete<
+                  KeyValueStore::ExperimentalWithRawCallbackMethod_MultiGet<
+                      KeyValueStore::ExperimentalWithCallbackMethod_Watch<
+                          KeyValueStore::Service>>>>> {
+ public:
+  explicit KeyValueStoreServiceImpl(size_t num_keys) : store_(num_keys) {
+    for (size_t i = 1; i <= num_keys; ++i) {
+      store_.Put(SyntheticKey(i), SyntheticValue(i));
     }
-    return Status::OK;
   }
+
+  ServerBidiReactor<ByteBuffer, ByteBuffer>* GetValues(
+      CallbackServerContext* context) override {
+    // Let caching clients keep values for a minute, and keep serving them for
+    // a further 30 seconds while they are refreshed.
+    context->AddInitialMetadata("cache-control",
+                                "max-age=60, stale-while-revalidate=30");
+    return new ValueStreamer(store_);
+  }
+
+  ServerUnaryReactor* Put(CallbackServerContext* context,
+                          const PutRequest* request,
+                          PutResponse* /*response*/) override {
+    store_.Put(request->key(), request->value());
+    updates_.Broadcast(request->key());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerUnaryReactor* Delete(CallbackServerContext* context,
+                             const DeleteRequest* request,
+                             DeleteResponse* response) override {
+    response->set_found(store_.Delete(request->key()));
+    if (response->found()) updates_.Broadcast(request->key());
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerUnaryReactor* MultiGet(CallbackServerContext* context,
+                               const ByteBuffer* request,
+                               ByteBuffer* response) override {
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    // Deserializing consumes the buffer, which only references the request.
+    ByteBuffer request_buffer(*request);
+    MultiGetRequest keys;
+    if (!grpc::SerializationTraits<MultiGetRequest>::Deserialize(
+             &request_buffer, &keys)
+             .ok()) {
+      reactor->Finish(
+          Status(grpc::StatusCode::INVALID_ARGUMENT, "Bad request"));
+      return reactor;
+    }
+    // A MultiGetResponse is its values, each encoded as field 1, exactly as a
+    // Response encodes its value. The stored responses are therefore sent
+    // back to back without being copied, except that an empty value, which a
+    // Response omits, must still be encoded to keep its place in the list.
+    static const uint8_t kEmptyValue[] = {0x0a, 0x00};
+    std::vector<Slice> values;
+    values.reserve(keys.keys_size());
+    for (const std::string& key : keys.keys()) {
+      values.push_back(store_.Get(key));
+      if (values.back().size() == 0) {
+        values.back() =
+            Slice(kEmptyValue, sizeof(kEmptyValue), Slice::STATIC_SLICE);
+      }
+    }
+    ByteBuffer response_buffer(values.data(), values.size());
+    response->Swap(&response_buffer);
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerWriteReactor<KeyUpdate>* Watch(
+      CallbackServerContext* /*context*/,
+      const WatchRequest* /*request*/) override {
+    return new UpdateWriter(&updates_);
+  }
+
+ private:
+  ValueStore store_;
+  UpdateBroadcaster updates_;
 };
 
-void RunServer() {
+void RunServer(size_t num_keys) {
   std::string server_address("0.0.0.0:50051");
-  KeyValueStoreServiceImpl service;
+  KeyValueStoreServiceImpl service(num_keys);
 
   ServerBuilder builder;
   // Listen on the given address without any authentication mechanism.
   builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
   // Register "service" as the instance through which we'll communicate with
-  // clients. In this case, it corresponds to an *synchronous* service.
+  // clients. In this case, it corresponds to a *callback* service.
   builder.RegisterService(&service);
   // Finally assemble the server.
   std::unique_ptr<Server> server(builder.BuildAndStart());
@@ -91,7 +434,12 @@ void RunServer() {
 }
 
 int main(int argc, char** argv) {
-  RunServer();
+  // --num_keys=N loads the keys "key1" to "keyN", with values "value1" to
+  // "valueN".
+  size_t num_keys = 5;
+  std::string value = GetFlag(argc, argv, "num_keys");
+  if (!value.empty()) num_keys = std::stoul(value);
+  RunServer(num_keys);
 
   return 0;
 }
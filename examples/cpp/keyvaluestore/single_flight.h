@@ -0,0 +1,119 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_KEYVALUESTORE_SINGLE_FLIGHT_H
+#define GRPC_EXAMPLES_CPP_KEYVALUESTORE_SINGLE_FLIGHT_H
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// Coalesces concurrent identical requests. The first caller for a given key
+// (the "leader") performs the request; every caller that arrives with the same
+// key while the leader is still in flight waits for, and shares, the leader's
+// result instead of sending a request of its own. Only requests that are safe
+// to merge (i.e. idempotent reads) should be routed through this class.
+//
+// The number of distinct keys tracked at any time is bounded by
+// |max_in_flight|. Once that many requests are outstanding, new keys bypass
+// coalescing and are sent directly, so memory use never grows with load.
+class SingleFlight {
+ public:
+  // Fetches the value for a request. Returns false if the request failed.
+  using Fetcher = std::function<bool(std::string* value)>;
+
+  struct Stats {
+    // Requests that were actually sent.
+    uint64_t leaders = 0;
+    // Requests that were served by waiting on an identical in-flight request.
+    uint64_t merged = 0;
+    // Requests that were sent without coalescing because the in-flight table
+    // was full.
+    uint64_t bypassed = 0;
+  };
+
+  explicit SingleFlight(size_t max_in_flight = 1024)
+      : max_in_flight_(max_in_flight) {}
+
+  // Runs |fetch| for |key|, or waits for an identical request that is already
+  // in flight. Returns the result of whichever request produced |value|.
+  bool Do(const std::string& key, const Fetcher& fetch, std::string* value) {
+    std::shared_ptr<Call> call;
+    {
+      std::unique_lock<std::mutex> lock(mu_);
+      auto it = in_flight_.find(key);
+      if (it != in_flight_.end()) {
+        call = it->second;
+        call->cv.wait(lock, [&call] { return call->done; });
+        merged_.fetch_add(1, std::memory_order_relaxed);
+        *value = call->value;
+        return call->ok;
+      }
+      if (in_flight_.size() >= max_in_flight_) {
+        bypassed_.fetch_add(1, std::memory_order_relaxed);
+        lock.unlock();
+        return fetch(value);
+      }
+      call = std::make_shared<Call>();
+      in_flight_.emplace(key, call);
+    }
+    leaders_.fetch_add(1, std::memory_order_relaxed);
+    // The fetch runs without the lock held so that unrelated keys are not
+    // serialized behind a slow request.
+    bool ok = fetch(value);
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      call->ok = ok;
+      call->value = *value;
+      call->done = true;
+      in_flight_.erase(key);
+    }
+    call->cv.notify_all();
+    return ok;
+  }
+
+  Stats stats() const {
+    Stats stats;
+    stats.leaders = leaders_.load(std::memory_order_relaxed);
+    stats.merged = merged_.load(std::memory_order_relaxed);
+    stats.bypassed = bypassed_.load(std::memory_order_relaxed);
+    return stats;
+  }
+
+ private:
+  struct Call {
+    std::condition_variable cv;
+    bool done = false;
+    bool ok = false;
+    std::string value;
+  };
+
+  const size_t max_in_flight_;
+  std::mutex mu_;
+  std::unordered_map<std::string, std::shared_ptr<Call>> in_flight_;
+  std::atomic<uint64_t> leaders_{0};
+  std::atomic<uint64_t> merged_{0};
+  std::atomic<uint64_t> bypassed_{0};
+};
+
+#endif  // GRPC_EXAMPLES_CPP_KEYVALUESTORE_SINGLE_FLIGHT_H
@@ -0,0 +1,133 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_KEYVALUESTORE_VALUE_STORE_H
+#define GRPC_EXAMPLES_CPP_KEYVALUESTORE_VALUE_STORE_H
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+#include <grpcpp/support/slice.h>
+
+#ifdef BAZEL_BUILD
+#include "examples/protos/keyvaluestore.grpc.pb.h"
+#else
+#include "keyvaluestore.grpc.pb.h"
+#endif
+
+// The values served by the KeyValueStore service, keyed by key.
+//
+// Each value is stored as the serialized Response that carries it, in a
+// reference-counted slice. A lookup only takes a reference, so responses are
+// written to the network straight from the store without being copied, and a
+// Put or Delete replaces the slice rather than modifying it, so a response
+// that is being written keeps the value it was looked up with.
+//
+// Keys are spread over independently locked shards, and a shard's lock is
+// only held to probe its hash table, so lookups rarely contend, even with
+// concurrent updates.
+class ValueStore {
+ public:
+  // Sizes the shards for about |expected_keys| keys, so that loading them
+  // does not rehash.
+  explicit ValueStore(size_t expected_keys = 0) {
+    for (Shard& shard : shards_) {
+      shard.values.reserve(expected_keys / kNumShards);
+    }
+  }
+
+  ValueStore(const ValueStore&) = delete;
+  ValueStore& operator=(const ValueStore&) = delete;
+
+  // Returns the serialized Response for |key|, which has an empty value if
+  // the key is absent.
+  grpc::Slice Get(const std::string& key) const {
+    const Shard& shard = ShardFor(key);
+    std::lock_guard<std::mutex> lock(shard.mu);
+    auto it = shard.values.find(key);
+    return it == shard.values.end() ? grpc::Slice() : it->second;
+  }
+
+  // Sets the value of |key|, replacing any previous value.
+  void Put(const std::string& key, const std::string& value) {
+    // Serialize outside the lock.
+    keyvaluestore::Response response;
+    response.set_value(value);
+    const grpc::Slice serialized(response.SerializeAsString());
+    Shard& shard = ShardFor(key);
+    // The previous value is freed after the lock is released, unless a
+    // response that is being written still references it.
+    grpc::Slice previous;
+    std::lock_guard<std::mutex> lock(shard.mu);
+    grpc::Slice& stored = shard.values[key];
+    previous = stored;
+    stored = serialized;
+  }
+
+  // Removes |key| and returns whether it was present.
+  bool Delete(const std::string& key) {
+    Shard& shard = ShardFor(key);
+    // Freed after the lock is released, as in Put().
+    grpc::Slice removed;
+    std::lock_guard<std::mutex> lock(shard.mu);
+    auto it = shard.values.find(key);
+    if (it == shard.values.end()) return false;
+    removed = it->second;
+    shard.values.erase(it);
+    return true;
+  }
+
+  // The number of keys, which is only exact without concurrent updates.
+  size_t size() const {
+    size_t size = 0;
+    for (const Shard& shard : shards_) {
+      std::lock_guard<std::mutex> lock(shard.mu);
+      size += shard.values.size();
+    }
+    return size;
+  }
+
+ private:
+  // Must match the shift in ShardFor().
+  static constexpr size_t kNumShards = 256;
+
+  struct Shard {
+    mutable std::mutex mu;
+    std::unordered_map<std::string, grpc::Slice> values;
+  };
+
+  // The shard comes from the high bits of a multiplicative hash, so that it
+  // does not correlate with the bucket the shard's table picks from the low
+  // bits of the plain hash.
+  const Shard& ShardFor(const std::string& key) const {
+    const uint64_t hash = std::hash<std::string>()(key);
+    return shards_[(hash * 0x9e3779b97f4a7c15ull) >> 56];
+  }
+  Shard& ShardFor(const std::string& key) {
+    return const_cast<Shard&>(
+        static_cast<const ValueStore*>(this)->ShardFor(key));
+  }
+
+  Shard shards_[kNumShards];
+};
+
+#endif  // GRPC_EXAMPLES_CPP_KEYVALUESTORE_VALUE_STORE_H
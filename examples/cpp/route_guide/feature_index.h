@@ -0,0 +1,173 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_ROUTE_GUIDE_FEATURE_INDEX_H
+#define GRPC_EXAMPLES_CPP_ROUTE_GUIDE_FEATURE_INDEX_H
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#ifdef BAZEL_BUILD
+#include "examples/protos/route_guide.grpc.pb.h"
+#else
+#include "route_guide.grpc.pb.h"
+#endif
+
+namespace routeguide {
+
+// An immutable index over a list of features, built once when the database is
+// loaded.
+//
+// Point lookups go through a hash map keyed by location. Rectangle queries go
+// through a uniform grid over the bounding box of the features: features are
+// stored sorted by grid cell, row by row, so the cells that a rectangle
+// overlaps in one row are a contiguous run, and their coordinates are kept in
+// a packed array next to it so that filtering that run touches little memory.
+// A query costs O(cells overlapped + features in them) rather than O(N).
+class FeatureIndex {
+ public:
+  explicit FeatureIndex(std::vector<Feature> features) {
+    if (features.empty()) return;
+    int32_t max_lat = features[0].location().latitude();
+    int32_t max_lon = features[0].location().longitude();
+    min_lat_ = max_lat;
+    min_lon_ = max_lon;
+    for (const Feature& f : features) {
+      min_lat_ = (std::min)(min_lat_, f.location().latitude());
+      max_lat = (std::max)(max_lat, f.location().latitude());
+      min_lon_ = (std::min)(min_lon_, f.location().longitude());
+      max_lon = (std::max)(max_lon, f.location().longitude());
+    }
+    // Aim for a few features per cell on a square grid.
+    const size_t cells = (std::max)(features.size() / kFeaturesPerCell,
+                                    static_cast<size_t>(1));
+    int64_t side =
+        static_cast<int64_t>(std::ceil(std::sqrt(static_cast<double>(cells))));
+    if (side > kMaxGridSide) side = kMaxGridSide;
+    rows_ = side;
+    cols_ = side;
+    cell_height_ = (int64_t(max_lat) - min_lat_) / rows_ + 1;
+    cell_width_ = (int64_t(max_lon) - min_lon_) / cols_ + 1;
+
+    // Counting sort by cell. It is stable, so that of several features at the
+    // same location the first one in the database keeps winning lookups.
+    std::vector<uint32_t> cell_of(features.size());
+    cell_start_.assign(rows_ * cols_ + 1, 0);
+    for (size_t i = 0; i < features.size(); i++) {
+      const Point& p = features[i].location();
+      cell_of[i] = Row(p.latitude()) * cols_ + Col(p.longitude());
+      cell_start_[cell_of[i] + 1]++;
+    }
+    for (size_t c = 1; c < cell_start_.size(); c++) {
+      cell_start_[c] += cell_start_[c - 1];
+    }
+    std::vector<uint32_t> next(cell_start_.begin(), cell_start_.end() - 1);
+    features_.resize(features.size());
+    coords_.resize(features.size());
+    for (size_t i = 0; i < features.size(); i++) {
+      const uint32_t pos = next[cell_of[i]]++;
+      coords_[pos] = {features[i].location().latitude(),
+                      features[i].location().longitude()};
+      features_[pos] = std::move(features[i]);
+    }
+    by_location_.reserve(features_.size());
+    for (size_t i = 0; i < features_.size(); i++) {
+      by_location_.emplace(Key(coords_[i].first, coords_[i].second),
+                           static_cast<uint32_t>(i));
+    }
+  }
+
+  size_t size() const { return features_.size(); }
+
+  // Returns the feature at \a point, or nullptr if there is none.
+  const Feature* Find(const Point& point) const {
+    auto it = by_location_.find(Key(point.latitude(), point.longitude()));
+    return it == by_location_.end() ? nullptr : &features_[it->second];
+  }
+
+  // Calls \a f with every feature inside \a rectangle, borders included, as
+  // it is found. Stops early if \a f returns false.
+  template <typename F>
+  void ForEachInRectangle(const Rectangle& rectangle, F f) const {
+    if (features_.empty()) return;
+    const Point& lo = rectangle.lo();
+    const Point& hi = rectangle.hi();
+    const int32_t left = (std::min)(lo.longitude(), hi.longitude());
+    const int32_t right = (std::max)(lo.longitude(), hi.longitude());
+    const int32_t top = (std::max)(lo.latitude(), hi.latitude());
+    const int32_t bottom = (std::min)(lo.latitude(), hi.latitude());
+    if (top < min_lat_ || right < min_lon_) return;
+    const int64_t first_row = Row((std::max)(bottom, min_lat_));
+    const int64_t last_row = Row(top);
+    const int64_t first_col = Col((std::max)(left, min_lon_));
+    const int64_t last_col = Col(right);
+    if (first_row >= rows_ || first_col >= cols_) return;
+    for (int64_t row = first_row; row <= last_row && row < rows_; row++) {
+      const uint32_t begin = cell_start_[row * cols_ + first_col];
+      const uint32_t end =
+          cell_start_[row * cols_ + (std::min)(last_col, cols_ - 1) + 1];
+      for (uint32_t i = begin; i < end; i++) {
+        const int32_t lat = coords_[i].first;
+        const int32_t lon = coords_[i].second;
+        if (lat >= bottom && lat <= top && lon >= left && lon <= right &&
+            !f(features_[i])) {
+          return;
+        }
+      }
+    }
+  }
+
+ private:
+  static constexpr size_t kFeaturesPerCell = 4;
+  // Bounds the grid to 16M cells, i.e. 64MB of cell offsets.
+  static constexpr int64_t kMaxGridSide = 4096;
+
+  static uint64_t Key(int32_t latitude, int32_t longitude) {
+    return (uint64_t(uint32_t(latitude)) << 32) | uint32_t(longitude);
+  }
+
+  // The row and column of a coordinate past the minimum one, which may lie
+  // past the last row or column if it is past the maximum one.
+  int64_t Row(int32_t latitude) const {
+    return (int64_t(latitude) - min_lat_) / cell_height_;
+  }
+  int64_t Col(int32_t longitude) const {
+    return (int64_t(longitude) - min_lon_) / cell_width_;
+  }
+
+  std::vector<Feature> features_;
+  // The latitude and longitude of features_[i].
+  std::vector<std::pair<int32_t, int32_t>> coords_;
+  std::unordered_map<uint64_t, uint32_t> by_location_;
+  int32_t min_lat_ = 0;
+  int32_t min_lon_ = 0;
+  int64_t cell_height_ = 1;
+  int64_t cell_width_ = 1;
+  int64_t rows_ = 0;
+  int64_t cols_ = 0;
+  // The features of cell c are features_[cell_start_[c], cell_start_[c + 1]).
+  std::vector<uint32_t> cell_start_;
+};
+
+}  // namespace routeguide
+
+#endif  // GRPC_EXAMPLES_CPP_ROUTE_GUIDE_FEATURE_INDEX_H
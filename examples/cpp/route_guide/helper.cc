@@ -16,13 +16,24 @@
  *
  */
 
-#include <algorithm>
-#include <cctype>
+#include "helper.h"
+
+#include <cstdint>
+#include <cstring>
 #include <fstream>
 #include <iostream>
+#include <random>
 #include <sstream>
 #include <string>
 #include <vector>
+#ifdef _WIN32
+#include <iterator>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 #ifdef BAZEL_BUILD
 #include "examples/protos/route_guide.grpc.pb.h"
 #else
@@ -31,25 +42,28 @@
 
 namespace routeguide {
 
-std::string GetDbFileContent(int argc, char** argv) {
-  std::string db_path;
+std::string GetDbPath(int argc, char** argv) {
   std::string arg_str("--db_path");
-  if (argc > 1) {
-    std::string argv_1 = argv[1];
-    size_t start_position = argv_1.find(arg_str);
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    size_t start_position = arg.find(arg_str);
     if (start_position != std::string::npos) {
       start_position += arg_str.size();
-      if (argv_1[start_position] == ' ' || argv_1[start_position] == '=') {
-        db_path = argv_1.substr(start_position + 1);
+      if (arg[start_position] == ' ' || arg[start_position] == '=') {
+        return arg.substr(start_position + 1);
       }
+      return "";
     }
-  } else {
+  }
 #ifdef BAZEL_BUILD
-    db_path = "cpp/route_guide/route_guide_db.json";
+  return "cpp/route_guide/route_guide_db.json";
 #else
-    db_path = "route_guide_db.json";
+  return "route_guide_db.json";
 #endif
-  }
+}
+
+std::string GetDbFileContent(int argc, char** argv) {
+  std::string db_path = GetDbPath(argc, argv);
   std::ifstream db_file(db_path);
   if (!db_file.is_open()) {
     std::cout << "Failed to open " << db_path << std::endl;
@@ -60,105 +74,365 @@ std::string GetDbFileContent(int argc, char** argv) {
   return db.str();
 }
 
-// A simple parser for the json db file. It requires the db file to have the
-// exact form of [{"location": { "latitude": 123, "longitude": 456}, "name":
-// "the name can be empty" }, { ... } ... The spaces will be stripped.
-class Parser {
- public:
-  explicit Parser(const std::string& db) : db_(db) {
-    // Remove all spaces.
-    db_.erase(std::remove_if(db_.begin(), db_.end(), isspace), db_.end());
-    if (!Match("[")) {
-      SetFailedAndReturnFalse();
+std::string GetFlag(int argc, char** argv, const std::string& name) {
+  const std::string prefix = "--" + name + "=";
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg.compare(0, prefix.size(), prefix) == 0) {
+      return arg.substr(prefix.size());
     }
   }
+  return "";
+}
 
-  bool Finished() { return current_ >= db_.size(); }
+namespace {
 
-  bool TryParseOne(Feature* feature) {
-    if (failed_ || Finished() || !Match("{")) {
-      return SetFailedAndReturnFalse();
-    }
-    if (!Match(location_) || !Match("{") || !Match(latitude_)) {
-      return SetFailedAndReturnFalse();
+// The contents of a file, mapped into memory where possible so that they are
+// paged in as they are read rather than copied up front.
+class MappedFile {
+ public:
+  explicit MappedFile(const std::string& path) {
+#ifdef _WIN32
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) return;
+    contents_.assign(std::istreambuf_iterator<char>(file),
+                     std::istreambuf_iterator<char>());
+    data_ = contents_.data();
+    size_ = contents_.size();
+    ok_ = true;
+#else
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) return;
+    struct stat st;
+    if (fstat(fd, &st) == 0) {
+      size_ = static_cast<size_t>(st.st_size);
+      if (size_ == 0) {
+        data_ = "";
+        ok_ = true;
+      } else {
+        void* addr = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (addr != MAP_FAILED) {
+          madvise(addr, size_, MADV_SEQUENTIAL);
+          data_ = static_cast<const char*>(addr);
+          mapped_ = true;
+          ok_ = true;
+        }
+      }
     }
-    long temp = 0;
-    ReadLong(&temp);
-    feature->mutable_location()->set_latitude(temp);
-    if (!Match(",") || !Match(longitude_)) {
-      return SetFailedAndReturnFalse();
+    close(fd);
+#endif
+  }
+
+  ~MappedFile() {
+#ifndef _WIN32
+    if (mapped_) munmap(const_cast<char*>(data_), size_);
+#endif
+  }
+
+  MappedFile(const MappedFile&) = delete;
+  MappedFile& operator=(const MappedFile&) = delete;
+
+  bool ok() const { return ok_; }
+  const char* data() const { return data_; }
+  size_t size() const { return size_; }
+
+ private:
+  bool ok_ = false;
+  const char* data_ = nullptr;
+  size_t size_ = 0;
+#ifdef _WIN32
+  std::string contents_;
+#else
+  bool mapped_ = false;
+#endif
+};
+
+// A single-pass parser for the json db file, which reads the input in place.
+// The db file has the form [{"location": {"latitude": 123, "longitude": 456},
+// "name": "the name can be empty"}, {...}, ...], with keys in any order and
+// any whitespace between tokens.
+class Parser {
+ public:
+  Parser(const char* begin, const char* end) : current_(begin), end_(end) {}
+
+  bool Parse(std::vector<Feature>* feature_list) {
+    if (!Consume('[')) return false;
+    if (Consume(']')) return AtEnd();
+    do {
+      feature_list->emplace_back();
+      if (!ParseFeature(&feature_list->back())) return false;
+    } while (Consume(','));
+    return Consume(']') && AtEnd();
+  }
+
+ private:
+  void SkipSpace() {
+    while (current_ != end_ && (*current_ == ' ' || *current_ == '\n' ||
+                                *current_ == '\r' || *current_ == '\t')) {
+      current_++;
     }
-    ReadLong(&temp);
-    feature->mutable_location()->set_longitude(temp);
-    if (!Match("},") || !Match(name_) || !Match("\"")) {
-      return SetFailedAndReturnFalse();
+  }
+
+  bool AtEnd() {
+    SkipSpace();
+    return current_ == end_;
+  }
+
+  // Consumes c if it is the next token.
+  bool Consume(char c) {
+    SkipSpace();
+    if (current_ == end_ || *current_ != c) return false;
+    current_++;
+    return true;
+  }
+
+  bool ParseString(std::string* out) {
+    if (!Consume('"')) return false;
+    const char* start = current_;
+    bool escaped = false;
+    while (current_ != end_ && *current_ != '"') {
+      if (*current_ == '\\') {
+        escaped = true;
+        if (++current_ == end_) return false;
+      }
+      current_++;
     }
-    size_t name_start = current_;
-    while (current_ != db_.size() && db_[current_++] != '"') {
+    if (current_ == end_) return false;
+    if (escaped) {
+      // Only the escapes that stand for themselves, e.g. \" and \\.
+      out->clear();
+      for (const char* p = start; p != current_; p++) {
+        if (*p == '\\') p++;
+        out->push_back(*p);
+      }
+    } else {
+      out->assign(start, current_);
     }
-    if (current_ == db_.size()) {
-      return SetFailedAndReturnFalse();
+    current_++;
+    return true;
+  }
+
+  bool ParseInt(int32_t* out) {
+    SkipSpace();
+    bool negative = false;
+    if (current_ != end_ && *current_ == '-') {
+      negative = true;
+      current_++;
     }
-    feature->set_name(db_.substr(name_start, current_ - name_start - 1));
-    if (!Match("},")) {
-      if (db_[current_ - 1] == ']' && current_ == db_.size()) {
-        return true;
-      }
-      return SetFailedAndReturnFalse();
+    if (current_ == end_ || *current_ < '0' || *current_ > '9') return false;
+    int64_t value = 0;
+    while (current_ != end_ && *current_ >= '0' && *current_ <= '9') {
+      value = value * 10 + (*current_++ - '0');
+      if (value > (int64_t(1) << 31)) return false;
     }
+    value = negative ? -value : value;
+    if (value > INT32_MAX || value < INT32_MIN) return false;
+    *out = static_cast<int32_t>(value);
     return true;
   }
 
- private:
-  bool SetFailedAndReturnFalse() {
-    failed_ = true;
-    return false;
+  bool ParseLocation(Point* location) {
+    if (!Consume('{')) return false;
+    do {
+      int32_t value;
+      if (!ParseString(&key_) || !Consume(':') || !ParseInt(&value)) {
+        return false;
+      }
+      if (key_ == "latitude") {
+        location->set_latitude(value);
+      } else if (key_ == "longitude") {
+        location->set_longitude(value);
+      } else {
+        return false;
+      }
+    } while (Consume(','));
+    return Consume('}');
   }
 
-  bool Match(const std::string& prefix) {
-    bool eq = db_.substr(current_, prefix.size()) == prefix;
-    current_ += prefix.size();
-    return eq;
+  bool ParseFeature(Feature* feature) {
+    if (!Consume('{')) return false;
+    do {
+      if (!ParseString(&key_) || !Consume(':')) return false;
+      if (key_ == "location") {
+        if (!ParseLocation(feature->mutable_location())) return false;
+      } else if (key_ == "name") {
+        if (!ParseString(feature->mutable_name())) return false;
+      } else {
+        return false;
+      }
+    } while (Consume(','));
+    return Consume('}');
   }
 
-  void ReadLong(long* l) {
-    size_t start = current_;
-    while (current_ != db_.size() && db_[current_] != ',' &&
-           db_[current_] != '}') {
-      current_++;
-    }
-    // It will throw an exception if fails.
-    *l = std::stol(db_.substr(start, current_ - start));
+  const char* current_;
+  const char* const end_;
+  std::string key_;
+};
+
+bool ParseDb(const char* begin, const char* end,
+             std::vector<Feature>* feature_list) {
+  feature_list->clear();
+  Parser parser(begin, end);
+  const bool ok = parser.Parse(feature_list);
+  if (!ok) {
+    std::cout << "Error parsing the db file";
+    feature_list->clear();
   }
+  std::cout << "DB parsed, loaded " << feature_list->size() << " features."
+            << std::endl;
+  return ok;
+}
+
+// The snapshot is a SnapshotHeader, then num_features SnapshotRecords, then
+// the names of the features, back to back. Integers are in host byte order.
+constexpr char kSnapshotMagic[8] = {'R', 'G', 'S', 'N', 'A', 'P', '0', '1'};
+
+struct SnapshotHeader {
+  char magic[8];
+  uint64_t num_features;
+  uint64_t names_size;
+};
 
-  bool failed_ = false;
-  std::string db_;
-  size_t current_ = 0;
-  const std::string location_ = "\"location\":";
-  const std::string latitude_ = "\"latitude\":";
-  const std::string longitude_ = "\"longitude\":";
-  const std::string name_ = "\"name\":";
+struct SnapshotRecord {
+  int32_t latitude;
+  int32_t longitude;
+  // The range of the name within the names.
+  uint32_t name_offset;
+  uint32_t name_size;
 };
 
+bool IsSnapshot(const MappedFile& file) {
+  return file.size() >= sizeof(SnapshotHeader) &&
+         memcmp(file.data(), kSnapshotMagic, sizeof(kSnapshotMagic)) == 0;
+}
+
+bool LoadSnapshot(const MappedFile& file, std::vector<Feature>* feature_list) {
+  SnapshotHeader header;
+  memcpy(&header, file.data(), sizeof(header));
+  // Compare sizes by subtraction from the file size, so that huge counts in a
+  // corrupt header cannot wrap around.
+  const uint64_t body_size = file.size() - sizeof(header);
+  if (header.num_features > body_size / sizeof(SnapshotRecord)) return false;
+  const uint64_t records_size = header.num_features * sizeof(SnapshotRecord);
+  if (header.names_size != body_size - records_size) return false;
+  const char* records = file.data() + sizeof(header);
+  const char* names = records + records_size;
+  feature_list->reserve(header.num_features);
+  for (uint64_t i = 0; i < header.num_features; i++) {
+    SnapshotRecord record;
+    memcpy(&record, records + i * sizeof(record), sizeof(record));
+    if (uint64_t(record.name_offset) + record.name_size > header.names_size) {
+      return false;
+    }
+    feature_list->emplace_back();
+    Feature& feature = feature_list->back();
+    feature.mutable_location()->set_latitude(record.latitude);
+    feature.mutable_location()->set_longitude(record.longitude);
+    feature.set_name(names + record.name_offset, record.name_size);
+  }
+  return true;
+}
+
+}  // namespace
+
 void ParseDb(const std::string& db, std::vector<Feature>* feature_list) {
+  ParseDb(db.data(), db.data() + db.size(), feature_list);
+}
+
+bool LoadDb(const std::string& path, std::vector<Feature>* feature_list) {
   feature_list->clear();
-  std::string db_content(db);
-  db_content.erase(
-      std::remove_if(db_content.begin(), db_content.end(), isspace),
-      db_content.end());
-
-  Parser parser(db_content);
-  Feature feature;
-  while (!parser.Finished()) {
-    feature_list->push_back(Feature());
-    if (!parser.TryParseOne(&feature_list->back())) {
-      std::cout << "Error parsing the db file";
-      feature_list->clear();
-      break;
+  MappedFile file(path);
+  if (!file.ok()) {
+    std::cout << "Failed to open " << path << std::endl;
+    return false;
+  }
+  if (!IsSnapshot(file)) {
+    return ParseDb(file.data(), file.data() + file.size(), feature_list);
+  }
+  if (!LoadSnapshot(file, feature_list)) {
+    std::cout << "Error loading the db snapshot " << path << std::endl;
+    feature_list->clear();
+    return false;
+  }
+  std::cout << "DB snapshot loaded, " << feature_list->size() << " features."
+            << std::endl;
+  return true;
+}
+
+bool WriteDbJson(const std::vector<Feature>& feature_list,
+                 const std::string& path) {
+  std::ofstream out(path, std::ios::binary);
+  out << "[";
+  for (size_t i = 0; i < feature_list.size(); i++) {
+    const Feature& f = feature_list[i];
+    out << (i == 0 ? "{\n" : ", {\n") << "    \"location\": {\n"
+        << "        \"latitude\": " << f.location().latitude() << ",\n"
+        << "        \"longitude\": " << f.location().longitude() << "\n"
+        << "    },\n"
+        << "    \"name\": \"";
+    for (char c : f.name()) {
+      if (c == '"' || c == '\\') out << '\\';
+      out << c;
     }
+    out << "\"\n}";
   }
-  std::cout << "DB parsed, loaded " << feature_list->size() << " features."
+  out << "]\n";
+  return out.good();
+}
+
+bool WriteDbSnapshot(const std::vector<Feature>& feature_list,
+                     const std::string& path) {
+  SnapshotHeader header;
+  memcpy(header.magic, kSnapshotMagic, sizeof(header.magic));
+  header.num_features = feature_list.size();
+  header.names_size = 0;
+  std::vector<SnapshotRecord> records;
+  records.reserve(feature_list.size());
+  for (const Feature& f : feature_list) {
+    if (header.names_size + f.name().size() > UINT32_MAX) return false;
+    SnapshotRecord record;
+    record.latitude = f.location().latitude();
+    record.longitude = f.location().longitude();
+    record.name_offset = static_cast<uint32_t>(header.names_size);
+    record.name_size = static_cast<uint32_t>(f.name().size());
+    records.push_back(record);
+    header.names_size += f.name().size();
+  }
+  std::ofstream out(path, std::ios::binary);
+  out.write(reinterpret_cast<const char*>(&header), sizeof(header));
+  out.write(reinterpret_cast<const char*>(records.data()),
+            records.size() * sizeof(SnapshotRecord));
+  for (const Feature& f : feature_list) {
+    out.write(f.name().data(), f.name().size());
+  }
+  return out.good();
+}
+
+void MakeSyntheticDb(size_t num_features, std::vector<Feature>* feature_list) {
+  feature_list->clear();
+  feature_list->reserve(num_features);
+  std::mt19937 rng(static_cast<std::mt19937::result_type>(num_features));
+  std::uniform_int_distribution<int32_t> latitude(400000000, 420000000);
+  std::uniform_int_distribution<int32_t> longitude(-750000000, -730000000);
+  for (size_t i = 0; i < num_features; i++) {
+    Feature feature;
+    feature.set_name("Feature " + std::to_string(i));
+    feature.mutable_location()->set_latitude(latitude(rng));
+    feature.mutable_location()->set_longitude(longitude(rng));
+    feature_list->push_back(std::move(feature));
+  }
+  std::cout << "Generated " << feature_list->size() << " synthetic features."
             << std::endl;
 }
 
+void LoadFeatures(int argc, char** argv, std::vector<Feature>* feature_list) {
+  const std::string synthetic_features =
+      GetFlag(argc, argv, "synthetic_features");
+  if (!synthetic_features.empty()) {
+    MakeSyntheticDb(std::stoul(synthetic_features), feature_list);
+  } else {
+    LoadDb(GetDbPath(argc, argv), feature_list);
+  }
+}
+
 }  // namespace routeguide
@@ -25,10 +25,41 @@
 namespace routeguide {
 class Feature;
 
+// Returns the path given by --db_path, or the default route_guide_db.json.
+std::string GetDbPath(int argc, char** argv);
+
 std::string GetDbFileContent(int argc, char** argv);
 
+// Returns the value of --name=value in argv, or "" if it is missing.
+std::string GetFlag(int argc, char** argv, const std::string& name);
+
 void ParseDb(const std::string& db, std::vector<Feature>* feature_list);
 
+// Fills feature_list with the features of the db file at path, which is either
+// json, as parsed by ParseDb(), or a snapshot written by WriteDbSnapshot(). The
+// file is memory-mapped and parsed in place rather than read into a string
+// first. Returns false if the file could not be opened or parsed.
+bool LoadDb(const std::string& path, std::vector<Feature>* feature_list);
+
+// Writes feature_list as a json db file.
+bool WriteDbJson(const std::vector<Feature>& feature_list,
+                 const std::string& path);
+
+// Writes feature_list as a db snapshot: fixed-size records followed by the
+// names, which loads without any parsing. Snapshots are only meant to be read
+// on machines of the same byte order.
+bool WriteDbSnapshot(const std::vector<Feature>& feature_list,
+                     const std::string& path);
+
+// Fills feature_list with num_features features at pseudo-random locations
+// around New York, the area of route_guide_db.json. The same num_features
+// always gives the same features, so that load generators can query them.
+void MakeSyntheticDb(size_t num_features, std::vector<Feature>* feature_list);
+
+// Fills feature_list with --synthetic_features=N generated features if that
+// flag is set, or else with the features of --db_path.
+void LoadFeatures(int argc, char** argv, std::vector<Feature>* feature_list);
+
 }  // namespace routeguide
 
 #endif  // GRPC_COMMON_CPP_ROUTE_GUIDE_HELPER_H_
@@ -0,0 +1,147 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_EXAMPLES_CPP_ROUTE_GUIDE_NOTE_STORE_H
+#define GRPC_EXAMPLES_CPP_ROUTE_GUIDE_NOTE_STORE_H
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+
+#ifdef BAZEL_BUILD
+#include "examples/protos/route_guide.grpc.pb.h"
+#else
+#include "route_guide.grpc.pb.h"
+#endif
+
+namespace routeguide {
+
+// An append-only log of the notes sent from one location.
+//
+// Notes are stored in fixed-size chunks that are never moved or freed while
+// the log lives, so a note can be read, and written to a stream, without any
+// lock once it is published. Appends are serialized by a mutex that readers
+// never take.
+class NoteLog {
+ public:
+  NoteLog() = default;
+  ~NoteLog() {
+    Chunk* chunk = head_.load(std::memory_order_relaxed);
+    while (chunk != nullptr) {
+      Chunk* next = chunk->next.load(std::memory_order_relaxed);
+      delete chunk;
+      chunk = next;
+    }
+  }
+
+  NoteLog(const NoteLog&) = delete;
+  NoteLog& operator=(const NoteLog&) = delete;
+
+  // Appends note and returns its position, i.e. the number of notes that were
+  // appended before it.
+  size_t Append(const RouteNote& note) {
+    std::lock_guard<std::mutex> lock(append_mu_);
+    const size_t index = size_.load(std::memory_order_relaxed);
+    if (index % kChunkSize == 0) {
+      Chunk* chunk = new Chunk();
+      (index == 0 ? head_ : tail_->next)
+          .store(chunk, std::memory_order_release);
+      tail_ = chunk;
+    }
+    tail_->notes[index % kChunkSize] = note;
+    size_.store(index + 1, std::memory_order_release);
+    return index;
+  }
+
+  // The number of published notes.
+  size_t size() const { return size_.load(std::memory_order_acquire); }
+
+  // Calls f with each of the first n notes, in order. n must not be more than
+  // a value returned by size() or Append(). Stops early if f returns false.
+  template <typename F>
+  void ForEach(size_t n, F f) const {
+    const Chunk* chunk = nullptr;
+    for (size_t i = 0; i < n; i++) {
+      if (i % kChunkSize == 0) {
+        chunk = (i == 0 ? head_ : chunk->next).load(std::memory_order_acquire);
+      }
+      if (!f(chunk->notes[i % kChunkSize])) return;
+    }
+  }
+
+ private:
+  // Most locations only get a few notes.
+  static constexpr size_t kChunkSize = 16;
+
+  struct Chunk {
+    RouteNote notes[kChunkSize];
+    std::atomic<Chunk*> next{nullptr};
+  };
+
+  std::mutex append_mu_;
+  std::atomic<Chunk*> head_{nullptr};
+  // Only accessed by appenders.
+  Chunk* tail_ = nullptr;
+  std::atomic<size_t> size_{0};
+};
+
+// The notes received by RouteChat, keyed by location.
+//
+// Locations are spread over independently locked shards, and a shard's lock
+// is only held to find or create the log of a location. Notes sent from
+// different locations therefore never contend, and reading the notes of a
+// location never blocks appending to it.
+class NoteStore {
+ public:
+  // Appends note to the log of its location and returns that log, along with
+  // the number of notes that were sent from the location before it.
+  const NoteLog& Append(const RouteNote& note, size_t* previous_notes) {
+    NoteLog* log = GetLog(note.location());
+    *previous_notes = log->Append(note);
+    return *log;
+  }
+
+ private:
+  // Must match the shift in GetLog().
+  static constexpr size_t kNumShards = 64;
+
+  struct Shard {
+    std::mutex mu;
+    std::unordered_map<uint64_t, std::unique_ptr<NoteLog>> logs;
+  };
+
+  NoteLog* GetLog(const Point& location) {
+    const uint64_t key = (uint64_t(uint32_t(location.latitude())) << 32) |
+                         uint32_t(location.longitude());
+    // Fibonacci hashing, since nearby locations differ in their low bits.
+    Shard& shard = shards_[(key * 0x9e3779b97f4a7c15ull) >> 58];
+    std::lock_guard<std::mutex> lock(shard.mu);
+    std::unique_ptr<NoteLog>& log = shard.logs[key];
+    if (log == nullptr) log.reset(new NoteLog());
+    return log.get();
+  }
+
+  Shard shards_[kNumShards];
+};
+
+}  // namespace routeguide
+
+#endif  // GRPC_EXAMPLES_CPP_ROUTE_GUIDE_NOTE_STORE_H
@@ -0,0 +1,345 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Measures the QPS of the GetFeature, ListFeatures and RecordRoute RPCs, and
+// the note throughput of RouteChat, of a route_guide_server started with the
+// same --synthetic_features=N, e.g.
+//
+//   route_guide_server --synthetic_features=5000000 &
+//   route_guide_benchmark --synthetic_features=5000000 --threads=16
+//
+// Each RPC is driven in turn by --threads threads, each with its own channel,
+// for --seconds seconds. --rpcs=RouteChat,GetFeature only runs the listed ones,
+// e.g. to compare RouteChat throughput at several --threads.
+//
+// --streams=N instead opens N idle RouteChat streams for --seconds seconds and,
+// given --server_pid, prints the threads and memory the server then uses, e.g.
+// to compare route_guide_server with route_guide_callback_server:
+//
+//   route_guide_callback_server --synthetic_features=1000 &
+//   route_guide_benchmark --streams=10000 --server_pid=$!
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpc/grpc.h>
+#include <grpcpp/channel.h>
+#include <grpcpp/client_context.h>
+#include <grpcpp/create_channel.h>
+#include <grpcpp/security/credentials.h>
+#include "helper.h"
+#ifdef BAZEL_BUILD
+#include "examples/protos/route_guide.grpc.pb.h"
+#else
+#include "route_guide.grpc.pb.h"
+#endif
+
+using grpc::Channel;
+using grpc::ClientAsyncReaderWriter;
+using grpc::ClientContext;
+using grpc::CompletionQueue;
+using grpc::ClientReader;
+using grpc::ClientReaderWriter;
+using grpc::ClientWriter;
+using grpc::Status;
+using routeguide::Feature;
+using routeguide::GetFlag;
+using routeguide::Point;
+using routeguide::Rectangle;
+using routeguide::RouteGuide;
+using routeguide::RouteNote;
+using routeguide::RouteSummary;
+
+struct Options {
+  std::string target = "localhost:50051";
+  size_t synthetic_features = 1000000;
+  int threads = 8;
+  int seconds = 10;
+  // The side of the ListFeatures rectangles, in 1e-7 degrees. 0.01 degrees
+  // hold about 250 features per million in the synthetic DB.
+  int32_t rectangle_side = 100000;
+  // The number of points streamed by each RecordRoute call.
+  int route_points = 10;
+  // The number of distinct locations that RouteChat notes are sent from. Every
+  // note is answered with all earlier notes from its location, so fewer
+  // locations mean larger answers.
+  int chat_locations = 100000;
+  // The comma-separated RPCs to run, or all of them if empty.
+  std::string rpcs;
+  // If positive, only open this many idle RouteChat streams.
+  int streams = 0;
+  // The pid of the server, to report its resource usage.
+  int server_pid = 0;
+
+  bool ShouldRun(const std::string& rpc) const {
+    return rpcs.empty() || ("," + rpcs + ",").find("," + rpc + ",") !=
+                               std::string::npos;
+  }
+};
+
+Options ParseOptions(int argc, char** argv) {
+  Options options;
+  std::string value;
+  if (!(value = GetFlag(argc, argv, "target")).empty()) {
+    options.target = value;
+  }
+  if (!(value = GetFlag(argc, argv, "synthetic_features")).empty()) {
+    options.synthetic_features = std::stoul(value);
+  }
+  if (!(value = GetFlag(argc, argv, "threads")).empty()) {
+    options.threads = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "seconds")).empty()) {
+    options.seconds = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "rectangle_side")).empty()) {
+    options.rectangle_side = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "route_points")).empty()) {
+    options.route_points = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "chat_locations")).empty()) {
+    options.chat_locations = std::stoi(value);
+  }
+  options.rpcs = GetFlag(argc, argv, "rpcs");
+  if (!(value = GetFlag(argc, argv, "streams")).empty()) {
+    options.streams = std::stoi(value);
+  }
+  if (!(value = GetFlag(argc, argv, "server_pid")).empty()) {
+    options.server_pid = std::stoi(value);
+  }
+  return options;
+}
+
+std::unique_ptr<RouteGuide::Stub> NewStub(const Options& options) {
+  // A connection per stub, so that the client does not bottleneck on one
+  // connection.
+  grpc::ChannelArguments args;
+  args.SetInt(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL, 1);
+  return RouteGuide::NewStub(grpc::CreateCustomChannel(
+      options.target, grpc::InsecureChannelCredentials(), args));
+}
+
+// Runs one RPC of the benchmarked method on stub and returns the number of
+// features it returned, or -1 if it failed.
+using Call = std::function<int64_t(RouteGuide::Stub* stub, std::mt19937* rng)>;
+
+// Drives call from options.threads threads for options.seconds seconds and
+// prints its throughput.
+void Run(const Options& options, const std::string& name, const Call& call) {
+  if (!options.ShouldRun(name)) return;
+  std::atomic<bool> done(false);
+  std::atomic<int64_t> calls(0);
+  std::atomic<int64_t> failures(0);
+  std::atomic<int64_t> features(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < options.threads; t++) {
+    threads.emplace_back([&, t] {
+      std::unique_ptr<RouteGuide::Stub> stub = NewStub(options);
+      std::mt19937 rng(t);
+      while (!done.load(std::memory_order_relaxed)) {
+        int64_t n = call(stub.get(), &rng);
+        if (n < 0) {
+          failures.fetch_add(1, std::memory_order_relaxed);
+        } else {
+          calls.fetch_add(1, std::memory_order_relaxed);
+          features.fetch_add(n, std::memory_order_relaxed);
+        }
+      }
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(options.seconds));
+  done = true;
+  for (std::thread& thread : threads) thread.join();
+  std::cout << name << ": " << calls / options.seconds << " QPS, "
+            << features / options.seconds << " features/s, " << failures
+            << " failures" << std::endl;
+}
+
+// Keeps one RouteChat stream per thread open for options.seconds seconds,
+// sending notes from random locations as fast as the stream allows while a
+// second thread reads the answers, and prints the note throughput.
+void RunRouteChat(const Options& options) {
+  if (!options.ShouldRun("RouteChat")) return;
+  std::atomic<bool> done(false);
+  std::atomic<int64_t> sent(0);
+  std::atomic<int64_t> received(0);
+  std::atomic<int64_t> failures(0);
+  std::vector<std::thread> threads;
+  for (int t = 0; t < options.threads; t++) {
+    threads.emplace_back([&, t] {
+      std::unique_ptr<RouteGuide::Stub> stub = NewStub(options);
+      ClientContext context;
+      std::shared_ptr<ClientReaderWriter<RouteNote, RouteNote>> stream(
+          stub->RouteChat(&context));
+      std::thread reader([&] {
+        RouteNote note;
+        while (stream->Read(&note)) {
+          received.fetch_add(1, std::memory_order_relaxed);
+        }
+      });
+      std::mt19937 rng(t);
+      std::uniform_int_distribution<int> location(0,
+                                                  options.chat_locations - 1);
+      RouteNote note;
+      note.set_message("note");
+      while (!done.load(std::memory_order_relaxed)) {
+        const int l = location(rng);
+        note.mutable_location()->set_latitude(400000000 + l / 1000);
+        note.mutable_location()->set_longitude(-740000000 + l % 1000);
+        if (!stream->Write(note)) break;
+        sent.fetch_add(1, std::memory_order_relaxed);
+      }
+      stream->WritesDone();
+      reader.join();
+      if (!stream->Finish().ok()) failures.fetch_add(1);
+    });
+  }
+  std::this_thread::sleep_for(std::chrono::seconds(options.seconds));
+  done = true;
+  for (std::thread& thread : threads) thread.join();
+  std::cout << "RouteChat: " << sent / options.seconds << " notes/s sent, "
+            << received / options.seconds << " notes/s received, "
+            << failures << " failures" << std::endl;
+}
+
+// Prints the thread count and resident memory of process pid (Linux only).
+void PrintProcessUsage(int pid) {
+  std::ifstream status("/proc/" + std::to_string(pid) + "/status");
+  std::string line;
+  while (std::getline(status, line)) {
+    if (line.compare(0, 8, "Threads:") == 0 ||
+        line.compare(0, 6, "VmRSS:") == 0) {
+      std::cout << "  server " << line << std::endl;
+    }
+  }
+}
+
+// Opens options.streams RouteChat streams that send nothing, spread over
+// options.threads connections, and holds them for options.seconds seconds.
+// The client side uses a single completion queue, so that it needs no thread
+// per stream itself.
+void RunOpenStreams(const Options& options) {
+  struct OpenStream {
+    ClientContext context;
+    std::unique_ptr<ClientAsyncReaderWriter<RouteNote, RouteNote>> stream;
+    Status status;
+  };
+  CompletionQueue cq;
+  std::vector<std::unique_ptr<RouteGuide::Stub>> stubs;
+  for (int t = 0; t < options.threads; t++) stubs.push_back(NewStub(options));
+  std::vector<std::unique_ptr<OpenStream>> streams;
+  for (int i = 0; i < options.streams; i++) {
+    streams.emplace_back(new OpenStream());
+    OpenStream* s = streams.back().get();
+    s->stream = stubs[i % stubs.size()]->AsyncRouteChat(&s->context, &cq, s);
+  }
+  int opened = 0;
+  void* tag;
+  bool ok;
+  for (int i = 0; i < options.streams && cq.Next(&tag, &ok); i++) {
+    if (ok) opened++;
+  }
+  std::cout << "Opened " << opened << " of " << options.streams
+            << " streams, holding them for " << options.seconds << " seconds"
+            << std::endl;
+  std::this_thread::sleep_for(std::chrono::seconds(options.seconds));
+  if (options.server_pid > 0) PrintProcessUsage(options.server_pid);
+  for (auto& s : streams) {
+    s->context.TryCancel();
+    s->stream->Finish(&s->status, s.get());
+  }
+  for (int i = 0; i < options.streams && cq.Next(&tag, &ok); i++) {
+  }
+  cq.Shutdown();
+  while (cq.Next(&tag, &ok)) {
+  }
+}
+
+int main(int argc, char** argv) {
+  const Options options = ParseOptions(argc, argv);
+  if (options.streams > 0) {
+    RunOpenStreams(options);
+    return 0;
+  }
+  std::vector<Feature> feature_list;
+  routeguide::MakeSyntheticDb(options.synthetic_features, &feature_list);
+  if (feature_list.empty()) {
+    std::cout << "--synthetic_features must be positive" << std::endl;
+    return 1;
+  }
+  auto random_feature = [&](std::mt19937* rng) -> const Feature& {
+    return feature_list[std::uniform_int_distribution<size_t>(
+        0, feature_list.size() - 1)(*rng)];
+  };
+
+  // Half of the points are features, the other half are next to one.
+  auto random_point = [&](std::mt19937* rng) {
+    Point point = random_feature(rng).location();
+    if ((*rng)() % 2) point.set_latitude(point.latitude() + 1);
+    return point;
+  };
+
+  Run(options, "GetFeature", [&](RouteGuide::Stub* stub, std::mt19937* rng) {
+    ClientContext context;
+    Feature feature;
+    Status status = stub->GetFeature(&context, random_point(rng), &feature);
+    return status.ok() ? int64_t(feature.name().empty() ? 0 : 1) : -1;
+  });
+
+  Run(options, "ListFeatures", [&](RouteGuide::Stub* stub, std::mt19937* rng) {
+    const Point& corner = random_feature(rng).location();
+    Rectangle rect;
+    rect.mutable_lo()->CopyFrom(corner);
+    rect.mutable_hi()->set_latitude(corner.latitude() + options.rectangle_side);
+    rect.mutable_hi()->set_longitude(corner.longitude() +
+                                     options.rectangle_side);
+    ClientContext context;
+    std::unique_ptr<ClientReader<Feature>> reader(
+        stub->ListFeatures(&context, rect));
+    Feature feature;
+    int64_t n = 0;
+    while (reader->Read(&feature)) n++;
+    return reader->Finish().ok() ? n : -1;
+  });
+
+  Run(options, "RecordRoute", [&](RouteGuide::Stub* stub, std::mt19937* rng) {
+    ClientContext context;
+    RouteSummary summary;
+    std::unique_ptr<ClientWriter<Point>> writer(
+        stub->RecordRoute(&context, &summary));
+    for (int i = 0; i < options.route_points; i++) {
+      if (!writer->Write(random_point(rng))) break;
+    }
+    writer->WritesDone();
+    return writer->Finish().ok() ? int64_t(summary.feature_count()) : -1;
+  });
+
+  RunRouteChat(options);
+
+  return 0;
+}
@@ -0,0 +1,380 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// The RouteGuide server implemented with the callback API. Unlike the
+// synchronous route_guide_server, a streaming RPC does not occupy a thread
+// while it waits for the client: each stream is a reactor whose reactions run
+// on the library's threads when a read or write completes.
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <deque>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <grpc/grpc.h>
+#include <grpcpp/security/server_credentials.h>
+#include <grpcpp/server.h>
+#include <grpcpp/server_builder.h>
+#include <grpcpp/server_context.h>
+#include "feature_index.h"
+#include "helper.h"
+#include "note_store.h"
+#ifdef BAZEL_BUILD
+#include "examples/protos/route_guide.grpc.pb.h"
+#else
+#include "route_guide.grpc.pb.h"
+#endif
+
+using grpc::CallbackServerContext;
+using grpc::Server;
+using grpc::ServerBidiReactor;
+using grpc::ServerBuilder;
+using grpc::ServerReadReactor;
+using grpc::ServerUnaryReactor;
+using grpc::ServerWriteReactor;
+using grpc::Status;
+using grpc::WriteOptions;
+using routeguide::Feature;
+using routeguide::FeatureIndex;
+using routeguide::NoteLog;
+using routeguide::NoteStore;
+using routeguide::Point;
+using routeguide::Rectangle;
+using routeguide::RouteGuide;
+using routeguide::RouteNote;
+using routeguide::RouteSummary;
+using std::chrono::system_clock;
+
+float ConvertToRadians(float num) { return num * 3.1415926 / 180; }
+
+// The formula is based on http://mathforum.org/library/drmath/view/51879.html
+float GetDistance(const Point& start, const Point& end) {
+  const float kCoordFactor = 10000000.0;
+  float lat_1 = start.latitude() / kCoordFactor;
+  float lat_2 = end.latitude() / kCoordFactor;
+  float lon_1 = start.longitude() / kCoordFactor;
+  float lon_2 = end.longitude() / kCoordFactor;
+  float lat_rad_1 = ConvertToRadians(lat_1);
+  float lat_rad_2 = ConvertToRadians(lat_2);
+  float delta_lat_rad = ConvertToRadians(lat_2 - lat_1);
+  float delta_lon_rad = ConvertToRadians(lon_2 - lon_1);
+
+  float a = pow(sin(delta_lat_rad / 2), 2) +
+            cos(lat_rad_1) * cos(lat_rad_2) * pow(sin(delta_lon_rad / 2), 2);
+  float c = 2 * atan2(sqrt(a), sqrt(1 - a));
+  int R = 6371000;  // metres
+
+  return R * c;
+}
+
+struct StreamOptions {
+  // Writes are corked, i.e. handed to the transport without being flushed to
+  // the network, until this many have accumulated. The callback API allows a
+  // single write in flight per stream, so this is what lets one round trip
+  // through the transport carry several messages.
+  int max_buffered_writes = 16;
+  // RouteChat stops reading notes while this many notes are waiting to be
+  // written to a slow client, so that flow control pushes back on the client
+  // rather than the server buffering without bound.
+  size_t max_queued_notes = 1024;
+};
+
+// Returns the options of the n-th (from 1) of a stream's writes, which is the
+// last one queued if last_queued.
+WriteOptions BufferedWriteOptions(const StreamOptions& options, uint64_t n,
+                                  bool last_queued) {
+  WriteOptions write_options;
+  if (!last_queued && n % options.max_buffered_writes != 0) {
+    write_options.set_buffer_hint();
+  }
+  return write_options;
+}
+
+// Writes the features inside a rectangle, one write at a time.
+class FeatureLister : public ServerWriteReactor<Feature> {
+ public:
+  FeatureLister(const FeatureIndex& index, const Rectangle& rectangle,
+                const StreamOptions& options)
+      : options_(options) {
+    // The features are immutable, so they are written without being copied.
+    index.ForEachInRectangle(rectangle, [this](const Feature& f) {
+      features_.push_back(&f);
+      return true;
+    });
+    NextWrite();
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      Finish(Status(grpc::StatusCode::UNKNOWN, "Unexpected Failure"));
+      return;
+    }
+    NextWrite();
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  void NextWrite() {
+    if (next_ == features_.size()) {
+      Finish(Status::OK);
+      return;
+    }
+    const Feature* feature = features_[next_++];
+    StartWrite(feature, BufferedWriteOptions(options_, next_,
+                                             next_ == features_.size()));
+  }
+
+  const StreamOptions& options_;
+  std::vector<const Feature*> features_;
+  size_t next_ = 0;
+};
+
+// Summarizes a route as its points are read.
+class RouteRecorder : public ServerReadReactor<Point> {
+ public:
+  RouteRecorder(const FeatureIndex& index, RouteSummary* summary)
+      : index_(index), summary_(summary), start_time_(system_clock::now()) {
+    StartRead(&point_);
+  }
+
+  void OnReadDone(bool ok) override {
+    if (ok) {
+      point_count_++;
+      const Feature* feature = index_.Find(point_);
+      if (feature != nullptr && !feature->name().empty()) {
+        feature_count_++;
+      }
+      if (point_count_ != 1) {
+        distance_ += GetDistance(previous_, point_);
+      }
+      previous_ = point_;
+      StartRead(&point_);
+      return;
+    }
+    summary_->set_point_count(point_count_);
+    summary_->set_feature_count(feature_count_);
+    summary_->set_distance(static_cast<long>(distance_));
+    auto secs = std::chrono::duration_cast<std::chrono::seconds>(
+        system_clock::now() - start_time_);
+    summary_->set_elapsed_time(secs.count());
+    Finish(Status::OK);
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  const FeatureIndex& index_;
+  RouteSummary* summary_;
+  const system_clock::time_point start_time_;
+  Point point_;
+  Point previous_;
+  int point_count_ = 0;
+  int feature_count_ = 0;
+  float distance_ = 0.0;
+};
+
+// Answers each note with the earlier notes from its location. Reads and
+// writes proceed concurrently: a read is kept outstanding while the answers
+// to earlier notes are written, unless too many of them are queued.
+class Chatter : public ServerBidiReactor<RouteNote, RouteNote> {
+ public:
+  Chatter(NoteStore* notes, const StreamOptions& options)
+      : notes_(notes), options_(options) {
+    StartRead(&note_);
+  }
+
+  void OnReadDone(bool ok) override {
+    if (!ok) {
+      bool finish;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        reads_done_ = true;
+        finish = !writing_ && !finished_;
+        finished_ = finished_ || finish;
+      }
+      if (finish) Finish(Status::OK);
+      return;
+    }
+    // The notes before this one are immutable, so they are queued and written
+    // without being copied.
+    size_t previous_notes;
+    const NoteLog& log = notes_->Append(note_, &previous_notes);
+    std::vector<const RouteNote*> answers;
+    answers.reserve(previous_notes);
+    log.ForEach(previous_notes, [&answers](const RouteNote& n) {
+      answers.push_back(&n);
+      return true;
+    });
+    bool start_write;
+    bool start_read;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (finished_) return;
+      queue_.insert(queue_.end(), answers.begin(), answers.end());
+      start_write = !writing_ && !queue_.empty();
+      writing_ = writing_ || start_write;
+      start_read = queue_.size() < options_.max_queued_notes;
+      read_paused_ = !start_read;
+    }
+    if (start_read) StartRead(&note_);
+    if (start_write) NextWrite();
+  }
+
+  void OnWriteDone(bool ok) override {
+    if (!ok) {
+      // The client is gone: outstanding reads complete with !ok, but a paused
+      // stream has none, so finish here.
+      bool finish;
+      {
+        std::lock_guard<std::mutex> lock(mu_);
+        queue_.clear();
+        writing_ = false;
+        finish = !finished_;
+        finished_ = true;
+      }
+      if (finish) {
+        Finish(Status(grpc::StatusCode::UNKNOWN, "Unexpected Failure"));
+      }
+      return;
+    }
+    NextWrite();
+  }
+
+  void OnDone() override { delete this; }
+
+ private:
+  // Writes the next queued note. Called by the single writer, i.e. with
+  // writing_ set.
+  void NextWrite() {
+    const RouteNote* note = nullptr;
+    WriteOptions write_options;
+    bool resume_read = false;
+    bool finish = false;
+    {
+      std::lock_guard<std::mutex> lock(mu_);
+      if (queue_.empty() || finished_) {
+        writing_ = false;
+        finish = reads_done_ && !finished_;
+        finished_ = finished_ || finish;
+      } else {
+        note = queue_.front();
+        queue_.pop_front();
+        write_options =
+            BufferedWriteOptions(options_, ++writes_, queue_.empty());
+        // Resume reading once half of the queue has drained.
+        if (read_paused_ && queue_.size() <= options_.max_queued_notes / 2) {
+          read_paused_ = false;
+          resume_read = true;
+        }
+      }
+    }
+    if (note != nullptr) StartWrite(note, write_options);
+    if (resume_read) StartRead(&note_);
+    if (finish) Finish(Status::OK);
+  }
+
+  NoteStore* notes_;
+  const StreamOptions& options_;
+  // Only used by the single outstanding read.
+  RouteNote note_;
+  std::mutex mu_;
+  std::deque<const RouteNote*> queue_;
+  uint64_t writes_ = 0;
+  bool writing_ = false;
+  bool read_paused_ = false;
+  bool reads_done_ = false;
+  bool finished_ = false;
+};
+
+class RouteGuideImpl final : public RouteGuide::ExperimentalCallbackService {
+ public:
+  RouteGuideImpl(std::vector<Feature> feature_list,
+                 const StreamOptions& options)
+      : index_(std::move(feature_list)), options_(options) {}
+
+  ServerUnaryReactor* GetFeature(CallbackServerContext* context,
+                                 const Point* point,
+                                 Feature* feature) override {
+    const Feature* found = index_.Find(*point);
+    feature->set_name(found == nullptr ? "" : found->name());
+    feature->mutable_location()->CopyFrom(*point);
+    ServerUnaryReactor* reactor = context->DefaultReactor();
+    reactor->Finish(Status::OK);
+    return reactor;
+  }
+
+  ServerWriteReactor<Feature>* ListFeatures(
+      CallbackServerContext* context,
+      const routeguide::Rectangle* rectangle) override {
+    return new FeatureLister(index_, *rectangle, options_);
+  }
+
+  ServerReadReactor<Point>* RecordRoute(CallbackServerContext* context,
+                                        RouteSummary* summary) override {
+    return new RouteRecorder(index_, summary);
+  }
+
+  ServerBidiReactor<RouteNote, RouteNote>* RouteChat(
+      CallbackServerContext* context) override {
+    return new Chatter(&notes_, options_);
+  }
+
+ private:
+  const FeatureIndex index_;
+  const StreamOptions options_;
+  NoteStore notes_;
+};
+
+void RunServer(std::vector<Feature> feature_list,
+               const StreamOptions& options) {
+  std::string server_address("0.0.0.0:50051");
+  RouteGuideImpl service(std::move(feature_list), options);
+
+  ServerBuilder builder;
+  builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
+  builder.RegisterService(&service);
+  std::unique_ptr<Server> server(builder.BuildAndStart());
+  std::cout << "Server listening on " << server_address << std::endl;
+  server->Wait();
+}
+
+int main(int argc, char** argv) {
+  // Takes the arguments of route_guide_server, plus --max_buffered_writes=N
+  // and --max_queued_notes=N (see StreamOptions).
+  std::vector<Feature> feature_list;
+  routeguide::LoadFeatures(argc, argv, &feature_list);
+  StreamOptions options;
+  std::string value;
+  if (!(value = routeguide::GetFlag(argc, argv, "max_buffered_writes"))
+           .empty()) {
+    options.max_buffered_writes = (std::max)(std::stoi(value), 1);
+  }
+  if (!(value = routeguide::GetFlag(argc, argv, "max_queued_notes")).empty()) {
+    options.max_queued_notes = (std::max)(std::stoi(value), 1);
+  }
+  RunServer(std::move(feature_list), options);
+
+  return 0;
+}
@@ -0,0 +1,87 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+// Converts route guide db files, and measures how long they take to load.
+//
+// Reads the features of --db_path (json or snapshot) or generates
+// --synthetic_features=N of them, writes them to --write_json=PATH and/or
+// --write_snapshot=PATH, then times loading each written file, e.g.
+//
+//   route_guide_db_tool --synthetic_features=10000000
+//       --write_json=/tmp/db.json --write_snapshot=/tmp/db.snapshot
+//
+// The servers load either file with --db_path.
+
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "helper.h"
+#ifdef BAZEL_BUILD
+#include "examples/protos/route_guide.grpc.pb.h"
+#else
+#include "route_guide.grpc.pb.h"
+#endif
+
+using routeguide::Feature;
+
+// Loads path and prints how long it took.
+bool TimeLoad(const std::string& path) {
+  std::vector<Feature> feature_list;
+  auto start = std::chrono::steady_clock::now();
+  if (!routeguide::LoadDb(path, &feature_list)) return false;
+  auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(
+      std::chrono::steady_clock::now() - start);
+  std::cout << "Loaded " << feature_list.size() << " features from " << path
+            << " in " << elapsed.count() << " ms" << std::endl;
+  return true;
+}
+
+int main(int argc, char** argv) {
+  const std::string json_path = routeguide::GetFlag(argc, argv, "write_json");
+  const std::string snapshot_path =
+      routeguide::GetFlag(argc, argv, "write_snapshot");
+  if (json_path.empty() && snapshot_path.empty()) {
+    std::cout << "Usage: " << argv[0]
+              << " (--db_path=PATH | --synthetic_features=N)"
+                 " [--write_json=PATH] [--write_snapshot=PATH]"
+              << std::endl;
+    return 1;
+  }
+  std::vector<Feature> feature_list;
+  routeguide::LoadFeatures(argc, argv, &feature_list);
+  if (!json_path.empty()) {
+    if (!routeguide::WriteDbJson(feature_list, json_path)) {
+      std::cout << "Failed to write " << json_path << std::endl;
+      return 1;
+    }
+  }
+  if (!snapshot_path.empty()) {
+    if (!routeguide::WriteDbSnapshot(feature_list, snapshot_path)) {
+      std::cout << "Failed to write " << snapshot_path << std::endl;
+      return 1;
+    }
+  }
+  // Free the features first, so that each load starts from the same heap.
+  std::vector<Feature>().swap(feature_list);
+  if (!json_path.empty() && !TimeLoad(json_path)) return 1;
+  if (!snapshot_path.empty() && !TimeLoad(snapshot_path)) return 1;
+
+  return 0;
+}
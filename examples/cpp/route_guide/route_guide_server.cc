@@ -22,13 +22,17 @@
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 #include <grpc/grpc.h>
 #include <grpcpp/security/server_credentials.h>
 #include <grpcpp/server.h>
 #include <grpcpp/server_builder.h>
 #include <grpcpp/server_context.h>
+#include "feature_index.h"
 #include "helper.h"
+#include "note_store.h"
 #ifdef BAZEL_BUILD
 #include "examples/protos/route_guide.grpc.pb.h"
 #else
@@ -43,6 +47,9 @@ using grpc::ServerReaderWriter;
 using grpc::ServerWriter;
 using grpc::Status;
 using routeguide::Feature;
+using routeguide::FeatureIndex;
+using routeguide::NoteLog;
+using routeguide::NoteStore;
 using routeguide::Point;
 using routeguide::Rectangle;
 using routeguide::RouteGuide;
@@ -72,26 +79,19 @@ float GetDistance(const Point& start, const Point& end) {
   return R * c;
 }
 
-std::string GetFeatureName(const Point& point,
-                           const std::vector<Feature>& feature_list) {
-  for (const Feature& f : feature_list) {
-    if (f.location().latitude() == point.latitude() &&
-        f.location().longitude() == point.longitude()) {
-      return f.name();
-    }
-  }
-  return "";
+std::string GetFeatureName(const Point& point, const FeatureIndex& index) {
+  const Feature* feature = index.Find(point);
+  return feature == nullptr ? "" : feature->name();
 }
 
 class RouteGuideImpl final : public RouteGuide::Service {
  public:
-  explicit RouteGuideImpl(const std::string& db) {
-    routeguide::ParseDb(db, &feature_list_);
-  }
+  explicit RouteGuideImpl(std::vector<Feature> feature_list)
+      : index_(std::move(feature_list)) {}
 
   Status GetFeature(ServerContext* context, const Point* point,
                     Feature* feature) override {
-    feature->set_name(GetFeatureName(*point, feature_list_));
+    feature->set_name(GetFeatureName(*point, index_));
     feature->mutable_location()->CopyFrom(*point);
     return Status::OK;
   }
@@ -99,19 +99,10 @@ class RouteGuideImpl final : public RouteGuide::Service {
   Status ListFeatures(ServerContext* context,
                       const routeguide::Rectangle* rectangle,
                       ServerWriter<Feature>* writer) override {
-    auto lo = rectangle->lo();
-    auto hi = rectangle->hi();
-    long left = (std::min)(lo.longitude(), hi.longitude());
-    long right = (std::max)(lo.longitude(), hi.longitude());
-    long top = (std::max)(lo.latitude(), hi.latitude());
-    long bottom = (std::min)(lo.latitude(), hi.latitude());
-    for (const Feature& f : feature_list_) {
-      if (f.location().longitude() >= left &&
-          f.location().longitude() <= right &&
-          f.location().latitude() >= bottom && f.location().latitude() <= top) {
-        writer->Write(f);
-      }
-    }
+    // Stop scanning once the client is gone.
+    index_.ForEachInRectangle(*rectangle, [writer](const Feature& f) {
+      return writer->Write(f);
+    });
     return Status::OK;
   }
 
@@ -126,7 +117,7 @@ class RouteGuideImpl final : public RouteGuide::Service {
     system_clock::time_point start_time = system_clock::now();
     while (reader->Read(&point)) {
       point_count++;
-      if (!GetFeatureName(point, feature_list_).empty()) {
+      if (!GetFeatureName(point, index_).empty()) {
         feature_count++;
       }
       if (point_count != 1) {
@@ -149,28 +140,25 @@ class RouteGuideImpl final : public RouteGuide::Service {
                    ServerReaderWriter<RouteNote, RouteNote>* stream) override {
     RouteNote note;
     while (stream->Read(&note)) {
-      std::unique_lock<std::mutex> lock(mu_);
-      for (const RouteNote& n : received_notes_) {
-        if (n.location().latitude() == note.location().latitude() &&
-            n.location().longitude() == note.location().longitude()) {
-          stream->Write(n);
-        }
-      }
-      received_notes_.push_back(note);
+      size_t previous_notes;
+      const NoteLog& log = notes_.Append(note, &previous_notes);
+      // The notes before this one are immutable, so they are written without
+      // holding any lock.
+      log.ForEach(previous_notes,
+                  [stream](const RouteNote& n) { return stream->Write(n); });
     }
 
     return Status::OK;
   }
 
  private:
-  std::vector<Feature> feature_list_;
-  std::mutex mu_;
-  std::vector<RouteNote> received_notes_;
+  const FeatureIndex index_;
+  NoteStore notes_;
 };
 
-void RunServer(const std::string& db_path) {
+void RunServer(std::vector<Feature> feature_list) {
   std::string server_address("0.0.0.0:50051");
-  RouteGuideImpl service(db_path);
+  RouteGuideImpl service(std::move(feature_list));
 
   ServerBuilder builder;
   builder.AddListeningPort(server_address, grpc::InsecureServerCredentials());
@@ -181,9 +169,11 @@ void RunServer(const std::string& db_path) {
 }
 
 int main(int argc, char** argv) {
-  // Expect only arg: --db_path=path/to/route_guide_db.json.
-  std::string db = routeguide::GetDbFileContent(argc, argv);
-  RunServer(db);
+  // Expect only arg: --db_path=path/to/route_guide_db.json, or
+  // --synthetic_features=N to serve N generated features instead.
+  std::vector<Feature> feature_list;
+  routeguide::LoadFeatures(argc, argv, &feature_list);
+  RunServer(std::move(feature_list));
 
   return 0;
 }
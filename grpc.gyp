@@ -242,6 +242,7 @@
         'test/core/end2end/tests/retry_disabled.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_initial_batch.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_subsequent_batch.cc',
+        'test/core/end2end/tests/retry_hedging.cc',
         'test/core/end2end/tests/retry_non_retriable_status.cc',
         'test/core/end2end/tests/retry_non_retriable_status_before_recv_trailing_metadata_started.cc',
         'test/core/end2end/tests/retry_recv_initial_metadata.cc',
@@ -341,6 +342,7 @@
         'test/core/end2end/tests/retry_disabled.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_initial_batch.cc',
         'test/core/end2end/tests/retry_exceeds_buffer_size_in_subsequent_batch.cc',
+        'test/core/end2end/tests/retry_hedging.cc',
         'test/core/end2end/tests/retry_non_retriable_status.cc',
         'test/core/end2end/tests/retry_non_retriable_status_before_recv_trailing_metadata_started.cc',
         'test/core/end2end/tests/retry_recv_initial_metadata.cc',
@@ -769,6 +771,8 @@
         'src/core/lib/compression/stream_compression.cc',
         'src/core/lib/compression/stream_compression_gzip.cc',
         'src/core/lib/compression/stream_compression_identity.cc',
+        'src/core/lib/debug/call_phase_tracer.cc',
+        'src/core/lib/debug/network_latency.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
         'src/core/lib/debug/trace.cc',
@@ -888,6 +892,7 @@
         'src/core/lib/security/credentials/composite/composite_credentials.cc',
         'src/core/lib/security/credentials/credentials.cc',
         'src/core/lib/security/credentials/credentials_metadata.cc',
+        'src/core/lib/security/credentials/credentials_metadata_cache.cc',
         'src/core/lib/security/credentials/external/aws_external_account_credentials.cc',
         'src/core/lib/security/credentials/external/aws_request_signer.cc',
         'src/core/lib/security/credentials/external/external_account_credentials.cc',
@@ -1223,6 +1228,8 @@
         'src/core/lib/compression/stream_compression.cc',
         'src/core/lib/compression/stream_compression_gzip.cc',
         'src/core/lib/compression/stream_compression_identity.cc',
+        'src/core/lib/debug/call_phase_tracer.cc',
+        'src/core/lib/debug/network_latency.cc',
         'src/core/lib/debug/stats.cc',
         'src/core/lib/debug/stats_data.cc',
         'src/core/lib/debug/trace.cc',
@@ -1413,6 +1420,7 @@
         'src/cpp/common/channel_filter.cc',
         'src/cpp/common/completion_queue_cc.cc',
         'src/cpp/common/core_codegen.cc',
+        'src/cpp/common/network_latency.cc',
         'src/cpp/common/resource_quota_cc.cc',
         'src/cpp/common/rpc_method.cc',
         'src/cpp/common/secure_auth_context.cc',
@@ -1544,6 +1552,7 @@
         'src/cpp/common/completion_queue_cc.cc',
         'src/cpp/common/core_codegen.cc',
         'src/cpp/common/insecure_create_auth_context.cc',
+        'src/cpp/common/network_latency.cc',
         'src/cpp/common/resource_quota_cc.cc',
         'src/cpp/common/rpc_method.cc',
         'src/cpp/common/validate_service_config.cc',
@@ -775,6 +775,13 @@ typedef struct grpc_tls_certificate_provider grpc_tls_certificate_provider;
  */
 typedef struct grpc_tls_identity_pairs grpc_tls_identity_pairs;
 
+/**
+ * A struct that holds the keys a server uses to encrypt and decrypt TLS
+ * session tickets. It is used for experimental purpose for now and subject to
+ * change.
+ */
+typedef struct grpc_tls_session_ticket_keys grpc_tls_session_ticket_keys;
+
 /**
  * Creates a grpc_tls_identity_pairs that stores a list of identity credential
  * data, including identity private key and identity certificate chain. It is
@@ -932,6 +939,45 @@ GRPCAPI void grpc_tls_credentials_options_set_server_authorization_check_config(
     grpc_tls_credentials_options* options,
     grpc_tls_server_authorization_check_config* config);
 
+/**
+ * Creates an empty grpc_tls_session_ticket_keys. A server using it does not
+ * issue session tickets until keys are set.
+ * It is used for experimental purpose for now and subject to change.
+ */
+GRPCAPI grpc_tls_session_ticket_keys* grpc_tls_session_ticket_keys_create(void);
+
+/**
+ * Replaces the keys in |keys| with the |num_keys| keys of |key_size| bytes in
+ * |key_data|. The first key encrypts new tickets, and tickets encrypted with
+ * any of the keys are accepted, so a key can be rotated out by adding its
+ * successor in front of it and removing it once its tickets have expired.
+ * Servers sharing the keys, including restarted ones, can resume each other's
+ * sessions. Each key is a 16-byte name followed by equally sized HMAC and AES
+ * keys: |key_size| must be 48 (AES-128) or 80 (AES-256). Keys can be replaced
+ * while servers are using them. Returns 1 on success and 0 otherwise.
+ * It is used for experimental purpose for now and subject to change.
+ */
+GRPCAPI int grpc_tls_session_ticket_keys_set(grpc_tls_session_ticket_keys* keys,
+                                             const char** key_data,
+                                             size_t key_size, size_t num_keys);
+
+/**
+ * Releases a grpc_tls_session_ticket_keys object. The creator of the object is
+ * responsible for its release.
+ * It is used for experimental purpose for now and subject to change.
+ */
+GRPCAPI void grpc_tls_session_ticket_keys_release(
+    grpc_tls_session_ticket_keys* keys);
+
+/**
+ * Sets the session ticket keys used on the server side. If not set, each
+ * server generates its own keys, and sessions cannot be resumed across server
+ * restarts. The |options| will implicitly take a new ref to the |keys|.
+ * It is used for experimental purpose for now and subject to change.
+ */
+GRPCAPI void grpc_tls_credentials_options_set_session_ticket_keys(
+    grpc_tls_credentials_options* options, grpc_tls_session_ticket_keys* keys);
+
 /** --- TLS server authorization check config. ---
  *  It is used for experimental purpose for now and subject to change. */
 
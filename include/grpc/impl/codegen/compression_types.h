@@ -47,7 +47,8 @@ extern "C" {
  * GRPC_COMPRESS_NONE, the next bit to GRPC_COMPRESS_DEFLATE, etc.
  * Unset bits disable support for the algorithm. By default all algorithms are
  * supported. It's not possible to disable GRPC_COMPRESS_NONE (the attempt will
- * be ignored). */
+ * be ignored). Algorithms that gRPC was built without are never advertised nor
+ * used, whatever their bit. */
 #define GRPC_COMPRESSION_CHANNEL_ENABLED_ALGORITHMS_BITSET \
   "grpc.compression_enabled_algorithms_bitset"
 /** \} */
@@ -60,6 +61,11 @@ typedef enum {
   GRPC_COMPRESS_GZIP,
   /* EXPERIMENTAL: Stream compression is currently experimental. */
   GRPC_COMPRESS_STREAM_GZIP,
+  /* zstd and lz4 are only available when gRPC is built with them
+     (GRPC_HAVE_ZSTD and GRPC_HAVE_LZ4). Otherwise they are never advertised
+     to peers and a message compressed with them cannot be decompressed. */
+  GRPC_COMPRESS_ZSTD,
+  GRPC_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_COMPRESS_ALGORITHMS_COUNT
 } grpc_compression_algorithm;
@@ -280,6 +280,13 @@ typedef struct {
     grpc_ssl_session_cache*). (use grpc_ssl_session_cache_arg_vtable() to fetch
     an appropriate pointer arg vtable) */
 #define GRPC_SSL_SESSION_CACHE_ARG "grpc.ssl_session_cache"
+/** If non-zero and GRPC_SSL_SESSION_CACHE_ARG is not set, TLS sessions are
+    cached in a cache shared by every channel that sets this arg and is
+    created from the same channel credentials object. Sessions are keyed by
+    target name, so a new channel to a target can resume a session
+    established by another channel with the same credentials to that
+    target. */
+#define GRPC_SSL_SESSION_CACHE_SHARED_ARG "grpc.ssl_session_cache_shared"
 /** If non-zero, it will determine the maximum frame size used by TSI's frame
  *  protector.
  *
@@ -288,6 +295,13 @@ typedef struct {
  *        can break old binaries that don't support larger than 1MiB frame
  *        size. */
 #define GRPC_ARG_TSI_MAX_FRAME_SIZE "grpc.tsi.max_frame_size"
+/** If non-zero, security handshakes on this channel or server run their TSI
+ *  handshaker steps on a dedicated handshake thread pool instead of on the
+ *  polling thread that received the handshake bytes, and are subject to that
+ *  pool's admission control. The pool is shared by the whole process and is
+ *  configured with the GRPC_SECURITY_HANDSHAKE_OFFLOAD_* environment
+ *  variables. Defaults to 0. */
+#define GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD "grpc.security_handshake_offload"
 /** Maximum metadata size, in bytes. Note this limit applies to the max sum of
     all metadata key-value entries in a batch of headers. */
 #define GRPC_ARG_MAX_METADATA_SIZE "grpc.max_metadata_size"
@@ -350,6 +364,19 @@ typedef struct {
    issued by the tcp_write(). By default, this is set to 4. */
 #define GRPC_ARG_TCP_TX_ZEROCOPY_MAX_SIMULT_SENDS \
   "grpc.experimental.tcp_tx_zerocopy_max_simultaneous_sends"
+/* If non-zero, the kernel send, transmit and ack timestamps of a sample of
+   RPCs' writes are collected, where the platform supports it (Linux with
+   SCM_TIMESTAMPING). The latencies are reported per RPC, per connection in
+   channelz and per method. By default, this is disabled. */
+#define GRPC_ARG_TCP_TRACING_ENABLED "grpc.experimental.tcp_tracing_enabled"
+/* When GRPC_ARG_TCP_TRACING_ENABLED is set, 1 in this many RPCs on the channel
+   or server are traced. By default, this is set to
+   GRPC_TCP_TRACING_DEFAULT_SAMPLE_RATE. */
+#define GRPC_ARG_TCP_TRACING_SAMPLE_RATE \
+  "grpc.experimental.tcp_tracing_sample_rate"
+/** Note this is not a "channel arg" key. This is the default sample rate of
+ * GRPC_ARG_TCP_TRACING_SAMPLE_RATE. */
+#define GRPC_TCP_TRACING_DEFAULT_SAMPLE_RATE 100
 /* Timeout in milliseconds to use for calls to the grpclb load balancer.
    If 0 or unset, the balancer calls will have no deadline. */
 #define GRPC_ARG_GRPCLB_CALL_TIMEOUT_MS "grpc.grpclb_call_timeout_ms"
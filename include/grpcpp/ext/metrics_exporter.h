@@ -0,0 +1,78 @@
+//
+//
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_EXT_METRICS_EXPORTER_H
+#define GRPCPP_EXT_METRICS_EXPORTER_H
+
+#include <stdint.h>
+
+#include <string>
+
+#include <grpcpp/server_builder.h>
+
+namespace grpc_core {
+class StatsCounter;
+}  // namespace grpc_core
+
+namespace grpc {
+namespace experimental {
+
+// The full name of the method served by AddMetricsService(). It takes an
+// empty request and returns the text of GetOpenMetrics() as raw bytes.
+extern const char kMetricsServiceMethod[];
+
+// The content type of GetOpenMetrics() output, for serving it over HTTP.
+extern const char kOpenMetricsContentType[];
+
+// A counter that is exported along with gRPC's own stats. Increments are
+// recorded per-CPU, so that counting is cheap on hot paths and scraping does
+// not slow it down.
+class MetricsCounter {
+ public:
+  // \a name should be a valid OpenMetrics metric name, without the "_total"
+  // suffix; invalid characters are replaced with underscores. Counters with
+  // the same name are exported as one, with their values summed.
+  MetricsCounter(const std::string& name, const std::string& help);
+  ~MetricsCounter();
+
+  MetricsCounter(const MetricsCounter&) = delete;
+  MetricsCounter& operator=(const MetricsCounter&) = delete;
+
+  void Increment(int64_t delta = 1);
+  int64_t Value() const;
+
+ private:
+  grpc_core::StatsCounter* const counter_;
+};
+
+// Returns a snapshot of gRPC's stats and of all MetricsCounter objects in the
+// OpenMetrics text exposition format. gRPC's own counters and histograms are
+// only collected in builds with GRPC_COLLECT_STATS defined or NDEBUG not
+// defined, and read as zero otherwise. The snapshot also has per-method
+// latency quantiles for the lifecycle phases of sampled client calls; see
+// GRPC_CALL_PHASE_TRACE_SAMPLE_RATE.
+std::string GetOpenMetrics();
+
+// Registers a service that serves GetOpenMetrics() at kMetricsServiceMethod
+// to the given ServerBuilder. It is not added by AddAdminServices().
+void AddMetricsService(grpc::ServerBuilder* builder);
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_EXT_METRICS_EXPORTER_H
@@ -0,0 +1,63 @@
+//
+//
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#ifndef GRPCPP_EXT_NETWORK_LATENCY_H
+#define GRPCPP_EXT_NETWORK_LATENCY_H
+
+#include <stdint.h>
+
+#include <chrono>
+
+#include <grpcpp/impl/codegen/client_context.h>
+#include <grpcpp/impl/codegen/server_context.h>
+
+namespace grpc {
+namespace experimental {
+
+// The kernel-measured latency of the writes of an RPC, on channels and servers
+// with GRPC_ARG_TCP_TRACING_ENABLED set. Only a sample of RPCs is traced (see
+// GRPC_ARG_TCP_TRACING_SAMPLE_RATE), and only on platforms with
+// SCM_TIMESTAMPING. The timestamps of a write arrive once the peer acks it,
+// so the latency of the last writes may be missing when the RPC completes.
+struct NetworkLatency {
+  struct Stage {
+    // The total over the traced writes.
+    std::chrono::microseconds total{0};
+    // The largest value of any one traced write.
+    std::chrono::microseconds max{0};
+  };
+  // Number of the RPC's writes whose timestamps have arrived.
+  int64_t traced_writes = 0;
+  // From sendmsg() until the kernel handed the write to the NIC.
+  Stage queued_in_kernel;
+  // From the NIC handoff until the peer acked the write.
+  Stage on_wire;
+  // From sendmsg() until the peer acked the write.
+  Stage until_acked;
+};
+
+// Fills \a latency with the network latency of the RPC of \a context so far.
+// Returns false if the RPC is not traced.
+bool GetNetworkLatency(grpc::ClientContext* context, NetworkLatency* latency);
+bool GetNetworkLatency(grpc::ServerContextBase* context,
+                       NetworkLatency* latency);
+
+}  // namespace experimental
+}  // namespace grpc
+
+#endif  // GRPCPP_EXT_NETWORK_LATENCY_H
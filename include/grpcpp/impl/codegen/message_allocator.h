@@ -19,6 +19,8 @@
 #ifndef GRPCPP_IMPL_CODEGEN_MESSAGE_ALLOCATOR_H
 #define GRPCPP_IMPL_CODEGEN_MESSAGE_ALLOCATOR_H
 
+#include <grpc/impl/codegen/grpc_types.h>
+
 namespace grpc {
 #ifndef GRPC_CALLBACK_API_NONEXPERIMENTAL
 namespace experimental {
@@ -88,6 +90,28 @@ using MessageAllocator = ::grpc::MessageAllocator<RequestT, ResponseT>;
 }  // namespace experimental
 #endif
 
+namespace internal {
+
+// Allocates the request and response of a unary RPC on a message arena that
+// lives as long as the call, for the methods of a service that called
+// Service::EnableMessageArenas(). This primary template is for message types
+// that cannot be allocated on an arena: Create() returns nullptr and the
+// handler allocates the messages as usual. proto_utils.h specializes it for
+// protobuf messages.
+template <class RequestType, class ResponseType, class Enable = void>
+class ArenaMessageHolder
+    : public ::grpc::experimental::MessageHolder<RequestType, ResponseType> {
+ public:
+  static ArenaMessageHolder* Create(grpc_call* /*call*/,
+                                    size_t /*initial_block_size*/) {
+    return nullptr;
+  }
+
+  void Release() override {}
+};
+
+}  // namespace internal
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_CODEGEN_MESSAGE_ALLOCATOR_H
@@ -21,6 +21,7 @@
 
 #include <grpcpp/impl/codegen/byte_buffer.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
 #include <grpcpp/impl/codegen/rpc_service_method.h>
 #include <grpcpp/impl/codegen/sync_stream.h>
 
@@ -74,7 +75,9 @@ void UnaryRunHandlerHelper(const MethodHandler::HandlerParameter& param,
   param.call->cq()->Pluck(&ops);
 }
 
-/// A helper function with reduced templating to do deserializing.
+/// A helper function with reduced templating to do deserializing. Returns
+/// nullptr if deserialization failed, in which case the caller frees the
+/// request.
 
 template <class RequestType>
 void* UnaryDeserializeHelper(grpc_byte_buffer* req, ::grpc::Status* status,
@@ -87,7 +90,6 @@ void* UnaryDeserializeHelper(grpc_byte_buffer* req, ::grpc::Status* status,
   if (status->ok()) {
     return request;
   }
-  request->~RequestType();
   return nullptr;
 }
 
@@ -105,35 +107,80 @@ class RpcMethodHandler : public ::grpc::internal::MethodHandler {
       : func_(func), service_(service) {}
 
   void RunHandler(const HandlerParameter& param) final {
+    auto* arena_messages = static_cast<
+        ::grpc::experimental::MessageHolder<RequestType, ResponseType>*>(
+        param.internal_data);
+    if (arena_messages != nullptr) {
+      // The request and response are freed along with their arena.
+      ::grpc::Status status = Invoke(param, arena_messages->response());
+      UnaryRunHandlerHelper(
+          param, static_cast<BaseResponseType*>(arena_messages->response()),
+          status);
+      arena_messages->Release();
+      return;
+    }
     ResponseType rsp;
-    ::grpc::Status status = param.status;
-    if (status.ok()) {
-      status = CatchingFunctionHandler([this, &param, &rsp] {
-        return func_(service_,
-                     static_cast<::grpc::ServerContext*>(param.server_context),
-                     static_cast<RequestType*>(param.request), &rsp);
-      });
+    ::grpc::Status status = Invoke(param, &rsp);
+    if (param.status.ok()) {
       static_cast<RequestType*>(param.request)->~RequestType();
     }
     UnaryRunHandlerHelper(param, static_cast<BaseResponseType*>(&rsp), status);
   }
 
   void* Deserialize(grpc_call* call, grpc_byte_buffer* req,
-                    ::grpc::Status* status, void** /*handler_data*/) final {
+                    ::grpc::Status* status, void** handler_data) final {
+    if (arena_initial_block_size_ > 0 && handler_data != nullptr) {
+      auto* arena_messages =
+          ArenaMessageHolder<RequestType, ResponseType>::Create(
+              call, arena_initial_block_size_);
+      if (arena_messages != nullptr) {
+        void* request = UnaryDeserializeHelper(
+            req, status,
+            static_cast<BaseRequestType*>(arena_messages->request()));
+        if (request != nullptr) {
+          *handler_data = arena_messages;
+        } else {
+          arena_messages->Release();
+        }
+        return request;
+      }
+    }
     auto* request =
         new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
             call, sizeof(RequestType))) RequestType;
-    return UnaryDeserializeHelper(req, status,
-                                  static_cast<BaseRequestType*>(request));
+    void* deserialized = UnaryDeserializeHelper(
+        req, status, static_cast<BaseRequestType*>(request));
+    if (deserialized == nullptr) {
+      request->~RequestType();
+    }
+    return deserialized;
+  }
+
+  void EnableMessageArenas(size_t initial_block_size) final {
+    arena_initial_block_size_ = initial_block_size;
   }
 
  private:
+  // Runs the application handler on the deserialized request, unless
+  // deserialization failed.
+  ::grpc::Status Invoke(const HandlerParameter& param, ResponseType* rsp) {
+    if (!param.status.ok()) return param.status;
+    return CatchingFunctionHandler([this, &param, rsp] {
+      return func_(service_,
+                   static_cast<::grpc::ServerContext*>(param.server_context),
+                   static_cast<RequestType*>(param.request), rsp);
+    });
+  }
+
   /// Application provided rpc handler function.
   std::function<::grpc::Status(ServiceType*, ::grpc::ServerContext*,
                                const RequestType*, ResponseType*)>
       func_;
   // The class the above handler function lives in.
   ServiceType* service_;
+  // The size of the first block of the per-call message arena, or 0 if the
+  // messages are not allocated on an arena.
+  size_t arena_initial_block_size_ = 0;
 };
 
 /// A wrapper class of an application provided client streaming handler.
@@ -19,7 +19,9 @@
 #ifndef GRPCPP_IMPL_CODEGEN_PROTO_BUFFER_READER_H
 #define GRPCPP_IMPL_CODEGEN_PROTO_BUFFER_READER_H
 
+#include <algorithm>
 #include <type_traits>
+#include <vector>
 
 #include <grpc/impl/codegen/byte_buffer_reader.h>
 #include <grpc/impl/codegen/grpc_types.h>
@@ -28,6 +30,7 @@
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
+#include <grpcpp/impl/codegen/slice.h>
 #include <grpcpp/impl/codegen/status.h>
 
 /// This header provides an object that reads bytes directly from a
@@ -123,6 +126,25 @@ class ProtoBufferReader : public ::grpc::protobuf::io::ZeroCopyInputStream {
   /// Returns the total number of bytes read since this object was created.
   int64_t ByteCount() const override { return byte_count_ - backup_count_; }
 
+  /// Reads the next \a count bytes without copying them: appends to \a slices
+  /// references to the parts of the byte buffer's slices that hold them.
+  /// Returns false if fewer than \a count bytes are left.
+  bool ReadSlices(size_t count, std::vector<Slice>* slices) {
+    const void* data;
+    int size;
+    while (count > 0 && Next(&data, &size)) {
+      const size_t begin =
+          static_cast<const uint8_t*>(data) - GRPC_SLICE_START_PTR(*slice_);
+      const size_t length = (std::min)(count, static_cast<size_t>(size));
+      slices->emplace_back(g_core_codegen_interface->grpc_slice_sub(
+                               *slice_, begin, begin + length),
+                           Slice::STEAL_REF);
+      BackUp(size - static_cast<int>(length));
+      count -= length;
+    }
+    return count == 0;
+  }
+
   // These protected members are needed to support internal optimizations.
   // they expose internal bits of grpc core that are NOT stable. If you have
   // a use case needs to use one of these functions, please send an email to
@@ -20,6 +20,7 @@
 #define GRPCPP_IMPL_CODEGEN_PROTO_BUFFER_WRITER_H
 
 #include <type_traits>
+#include <vector>
 
 #include <grpc/impl/codegen/grpc_types.h>
 #include <grpc/impl/codegen/slice.h>
@@ -28,6 +29,7 @@
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
 #include <grpcpp/impl/codegen/status.h>
+#include <grpcpp/impl/codegen/sync.h>
 
 /// This header provides an object that writes bytes directly into a
 /// grpc::ByteBuffer, via the ZeroCopyOutputStream interface
@@ -43,6 +45,72 @@ class ProtoBufferWriterPeer;
 
 const int kProtoBufferWriterMaxBufferLength = 1024 * 1024;
 
+namespace internal {
+
+/// A free list of kProtoBufferWriterMaxBufferLength-byte blocks, for a
+/// ProtoBufferWriter to serialize messages larger than that into. A block
+/// returns to the list when the last reference to its slice is released,
+/// typically once it has been written to the transport, so that a stream of
+/// large messages reuses a few blocks rather than allocating (and faulting in)
+/// fresh ones for each message.
+class ProtoBufferWriterBlockPool {
+ public:
+  static constexpr size_t kBlockSize = kProtoBufferWriterMaxBufferLength;
+  /// Free blocks beyond this many are freed rather than kept.
+  static constexpr size_t kMaxFreeBlocks = 8;
+
+  static ProtoBufferWriterBlockPool* Get() {
+    // Never destroyed, since a slice may release its block at any time.
+    static ProtoBufferWriterBlockPool* pool = new ProtoBufferWriterBlockPool;
+    return pool;
+  }
+
+  /// Returns a slice of the first \a length bytes of a block, which must be
+  /// at most kBlockSize.
+  grpc_slice NewSlice(size_t length) {
+    GPR_CODEGEN_ASSERT(length <= kBlockSize);
+    void* block = nullptr;
+    {
+      grpc::internal::MutexLock lock(&mu_);
+      if (!free_blocks_.empty()) {
+        block = free_blocks_.back();
+        free_blocks_.pop_back();
+      }
+    }
+    if (block == nullptr) {
+      block = g_core_codegen_interface->gpr_malloc(kBlockSize);
+    }
+    return g_core_codegen_interface->grpc_slice_new_with_user_data(
+        block, length, &ProtoBufferWriterBlockPool::Recycle, block);
+  }
+
+  /// The number of blocks that are ready to be reused.
+  size_t free_blocks() {
+    grpc::internal::MutexLock lock(&mu_);
+    return free_blocks_.size();
+  }
+
+ private:
+  ProtoBufferWriterBlockPool() { free_blocks_.reserve(kMaxFreeBlocks); }
+
+  static void Recycle(void* block) {
+    ProtoBufferWriterBlockPool* pool = Get();
+    {
+      grpc::internal::MutexLock lock(&pool->mu_);
+      if (pool->free_blocks_.size() < kMaxFreeBlocks) {
+        pool->free_blocks_.push_back(block);
+        return;
+      }
+    }
+    g_core_codegen_interface->gpr_free(block);
+  }
+
+  grpc::internal::Mutex mu_;
+  std::vector<void*> free_blocks_ ABSL_GUARDED_BY(mu_);
+};
+
+}  // namespace internal
+
 /// This is a specialization of the protobuf class ZeroCopyOutputStream.
 /// The principle is to give the proto layer one buffer of bytes at a time
 /// that it can use to serialize the next portion of the message, with the
@@ -57,11 +125,19 @@ class ProtoBufferWriter : public ::grpc::protobuf::io::ZeroCopyOutputStream {
   /// \param[out] byte_buffer A pointer to the grpc::ByteBuffer created
   /// \param block_size How big are the chunks to allocate at a time
   /// \param total_size How many total bytes are required for this proto
-  ProtoBufferWriter(ByteBuffer* byte_buffer, int block_size, int total_size)
+  /// \param block_pool If not null, chunks are taken from this pool rather
+  /// than freshly allocated; \a block_size must then be at most
+  /// internal::ProtoBufferWriterBlockPool::kBlockSize
+  ProtoBufferWriter(ByteBuffer* byte_buffer, int block_size, int total_size,
+                    internal::ProtoBufferWriterBlockPool* block_pool = nullptr)
       : block_size_(block_size),
         total_size_(total_size),
+        block_pool_(block_pool),
         byte_count_(0),
         have_backup_(false) {
+    GPR_CODEGEN_ASSERT(block_pool == nullptr ||
+                       static_cast<size_t>(block_size) <=
+                           internal::ProtoBufferWriterBlockPool::kBlockSize);
     GPR_CODEGEN_ASSERT(!byte_buffer->Valid());
     /// Create an empty raw byte buffer and look at its underlying slice buffer
     grpc_byte_buffer* bp =
@@ -94,6 +170,9 @@ class ProtoBufferWriter : public ::grpc::protobuf::io::ZeroCopyOutputStream {
       if (GRPC_SLICE_LENGTH(slice_) > remain) {
         GRPC_SLICE_SET_LENGTH(slice_, remain);
       }
+    } else if (block_pool_ != nullptr) {
+      slice_ = block_pool_->NewSlice(
+          remain > static_cast<size_t>(block_size_) ? block_size_ : remain);
     } else {
       // When less than a whole block is needed, only allocate that much.
       // But make sure the allocated slice is not inlined.
@@ -153,6 +232,8 @@ class ProtoBufferWriter : public ::grpc::protobuf::io::ZeroCopyOutputStream {
   friend class internal::ProtoBufferWriterPeer;
   const int block_size_;  ///< size to alloc for each new \a grpc_slice needed
   const int total_size_;  ///< byte size of proto being serialized
+  internal::ProtoBufferWriterBlockPool* const
+      block_pool_;        ///< where to take slices from, if not null
   int64_t byte_count_;    ///< bytes written since this object was created
   grpc_slice_buffer*
       slice_buffer_;  ///< internal buffer of slices holding the serialized data
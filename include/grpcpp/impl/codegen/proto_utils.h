@@ -19,7 +19,11 @@
 #ifndef GRPCPP_IMPL_CODEGEN_PROTO_UTILS_H
 #define GRPCPP_IMPL_CODEGEN_PROTO_UTILS_H
 
+#include <climits>
+#include <new>
+#include <string>
 #include <type_traits>
+#include <vector>
 
 #include <grpc/impl/codegen/byte_buffer_reader.h>
 #include <grpc/impl/codegen/grpc_types.h>
@@ -27,6 +31,7 @@
 #include <grpcpp/impl/codegen/byte_buffer.h>
 #include <grpcpp/impl/codegen/config_protobuf.h>
 #include <grpcpp/impl/codegen/core_codegen_interface.h>
+#include <grpcpp/impl/codegen/message_allocator.h>
 #include <grpcpp/impl/codegen/proto_buffer_reader.h>
 #include <grpcpp/impl/codegen/proto_buffer_writer.h>
 #include <grpcpp/impl/codegen/serialization_traits.h>
@@ -50,7 +55,9 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
                 "::protobuf::io::ZeroCopyOutputStream");
   *own_buffer = true;
   int byte_size = static_cast<int>(msg.ByteSizeLong());
-  if (static_cast<size_t>(byte_size) <= GRPC_SLICE_INLINED_SIZE) {
+  if (byte_size <= kProtoBufferWriterMaxBufferLength) {
+    // A single slice of exactly the message's size, which is inlined for tiny
+    // messages.
     Slice slice(byte_size);
     // We serialize directly into the allocated slices memory
     GPR_CODEGEN_ASSERT(slice.end() == msg.SerializeWithCachedSizesToArray(
@@ -60,7 +67,9 @@ Status GenericSerialize(const grpc::protobuf::MessageLite& msg, ByteBuffer* bb,
 
     return g_core_codegen_interface->ok();
   }
-  ProtoBufferWriter writer(bb, kProtoBufferWriterMaxBufferLength, byte_size);
+  // Larger messages are split over blocks that are recycled once sent.
+  ProtoBufferWriter writer(bb, kProtoBufferWriterMaxBufferLength, byte_size,
+                           internal::ProtoBufferWriterBlockPool::Get());
   return msg.SerializeToZeroCopyStream(&writer)
              ? g_core_codegen_interface->ok()
              : Status(StatusCode::INTERNAL, "Failed to serialize message");
@@ -114,6 +123,324 @@ class SerializationTraits<
 };
 #endif
 
+namespace internal {
+
+// Reads the top level of a protobuf wire format message from a
+// ProtoBufferReader, a few bytes at a time.
+class WireFormatScanner {
+ public:
+  explicit WireFormatScanner(ProtoBufferReader* reader) : reader_(reader) {}
+
+  bool AtEnd() {
+    const void* data;
+    int size;
+    while (reader_->Next(&data, &size)) {
+      if (size > 0) {
+        reader_->BackUp(size);
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Reads a varint into *value, and appends its encoding to *copy unless copy
+  // is null.
+  bool ReadVarint(uint64_t* value, std::string* copy) {
+    *value = 0;
+    for (int shift = 0; shift < 64; shift += 7) {
+      uint8_t byte;
+      if (!ReadByte(&byte)) return false;
+      if (copy != nullptr) copy->push_back(static_cast<char>(byte));
+      *value |= static_cast<uint64_t>(byte & 0x7f) << shift;
+      if ((byte & 0x80) == 0) return true;
+    }
+    return false;
+  }
+
+  // Appends the next count bytes to *copy.
+  bool CopyBytes(uint64_t count, std::string* copy) {
+    const void* data;
+    int size;
+    while (count > 0 && reader_->Next(&data, &size)) {
+      const int length =
+          static_cast<int>((std::min)(count, static_cast<uint64_t>(size)));
+      copy->append(static_cast<const char*>(data), length);
+      reader_->BackUp(size - length);
+      count -= length;
+    }
+    return count == 0;
+  }
+
+ private:
+  bool ReadByte(uint8_t* byte) {
+    const void* data;
+    int size;
+    do {
+      if (!reader_->Next(&data, &size)) return false;
+    } while (size == 0);
+    *byte = *static_cast<const uint8_t*>(data);
+    reader_->BackUp(size - 1);
+    return true;
+  }
+
+  ProtoBufferReader* const reader_;
+};
+
+inline size_t EncodeVarint(uint64_t value, uint8_t* out) {
+  size_t size = 0;
+  while (value >= 0x80) {
+    out[size++] = static_cast<uint8_t>(value | 0x80);
+    value >>= 7;
+  }
+  out[size++] = static_cast<uint8_t>(value);
+  return size;
+}
+
+// Parses the message read by reader into msg, except for the values of the
+// length-delimited fields numbered aliased_fields[0, count), which are read
+// into values[0, count) as references to the slices that hold them.
+inline Status ParseAliased(ProtoBufferReader* reader,
+                           grpc::protobuf::MessageLite* msg,
+                           const int* aliased_fields,
+                           std::vector<Slice>* values, size_t count) {
+  const Status kParseError(StatusCode::INTERNAL,
+                           "Failed to parse aliased message");
+  WireFormatScanner scanner(reader);
+  // The encoding of the fields that are not aliased.
+  std::string rest;
+  while (!scanner.AtEnd()) {
+    const size_t field_start = rest.size();
+    uint64_t tag;
+    uint64_t value;
+    if (!scanner.ReadVarint(&tag, &rest)) return kParseError;
+    switch (tag & 7) {
+      case 0:  // varint
+        if (!scanner.ReadVarint(&value, &rest)) return kParseError;
+        break;
+      case 1:  // fixed64
+        if (!scanner.CopyBytes(8, &rest)) return kParseError;
+        break;
+      case 2: {  // length-delimited
+        size_t i = 0;
+        while (i < count &&
+               static_cast<uint64_t>(aliased_fields[i]) != tag >> 3) {
+          i++;
+        }
+        if (i == count) {
+          if (!scanner.ReadVarint(&value, &rest) ||
+              !scanner.CopyBytes(value, &rest)) {
+            return kParseError;
+          }
+          break;
+        }
+        rest.resize(field_start);
+        if (!scanner.ReadVarint(&value, nullptr) || value > INT_MAX) {
+          return kParseError;
+        }
+        // As for any singular field, the last value wins.
+        values[i].clear();
+        if (!reader->ReadSlices(value, &values[i])) return kParseError;
+        break;
+      }
+      case 5:  // fixed32
+        if (!scanner.CopyBytes(4, &rest)) return kParseError;
+        break;
+      default:  // groups, which are deprecated, or an invalid wire type
+        return kParseError;
+    }
+  }
+  if (!msg->ParseFromString(rest)) {
+    return Status(StatusCode::INTERNAL, msg->InitializationErrorString());
+  }
+  return g_core_codegen_interface->ok();
+}
+
+// Serializes msg followed by the length-delimited fields numbered
+// aliased_fields[0, count) with the values in values[0, count), which are
+// referenced rather than copied.
+inline Status SerializeAliased(const grpc::protobuf::MessageLite& msg,
+                               const int* aliased_fields,
+                               const std::vector<Slice>* values, size_t count,
+                               ByteBuffer* bb) {
+  std::vector<Slice> slices;
+  const size_t byte_size = msg.ByteSizeLong();
+  if (byte_size > 0) {
+    Slice slice(byte_size);
+    GPR_CODEGEN_ASSERT(slice.end() == msg.SerializeWithCachedSizesToArray(
+                                          const_cast<uint8_t*>(slice.begin())));
+    slices.push_back(slice);
+  }
+  for (size_t i = 0; i < count; i++) {
+    size_t length = 0;
+    for (const Slice& slice : values[i]) length += slice.size();
+    if (length == 0) continue;
+    if (length > INT_MAX) {
+      return Status(StatusCode::INTERNAL, "Aliased field too large");
+    }
+    uint8_t header[20];
+    size_t header_size = EncodeVarint(
+        (static_cast<uint64_t>(aliased_fields[i]) << 3) | 2, header);
+    header_size += EncodeVarint(length, header + header_size);
+    slices.emplace_back(header, header_size);
+    slices.insert(slices.end(), values[i].begin(), values[i].end());
+  }
+  ByteBuffer tmp(slices.data(), slices.size());
+  bb->Swap(&tmp);
+  return g_core_codegen_interface->ok();
+}
+
+}  // namespace internal
+
+namespace experimental {
+
+/// A protobuf message of type \a Message whose top-level bytes or string
+/// fields numbered \a kAliasedFields are not copied into the message, but
+/// held as references to the slices of the ByteBuffer they were received in.
+/// A large payload can then be received, and sent on, without being copied.
+///
+/// The aliased fields must be singular and are left unset in message(); a
+/// string field is not checked to be valid UTF-8. Use AliasedMessage as the
+/// message type of a TemplatedGenericStub, or deserialize the ByteBuffer of a
+/// raw method into it with SerializationTraits.
+template <class Message, int... kAliasedFields>
+class AliasedMessage {
+ public:
+  static_assert(sizeof...(kAliasedFields) > 0, "No aliased fields");
+
+  /// The message, without its aliased fields.
+  const Message& message() const { return message_; }
+  Message* mutable_message() { return &message_; }
+
+  /// The slices that hold the value of aliased field \a field_number, in
+  /// order. Empty if the field is unset.
+  const std::vector<Slice>& field(int field_number) const {
+    return fields_[Index(field_number)];
+  }
+  std::vector<Slice>* mutable_field(int field_number) {
+    return &fields_[Index(field_number)];
+  }
+
+  /// The size of aliased field \a field_number.
+  size_t field_size(int field_number) const {
+    size_t size = 0;
+    for (const Slice& slice : field(field_number)) size += slice.size();
+    return size;
+  }
+
+  void Clear() {
+    message_.Clear();
+    for (std::vector<Slice>& field : fields_) field.clear();
+  }
+
+ private:
+  friend class ::grpc::SerializationTraits<AliasedMessage, void>;
+
+  static const int* FieldNumbers() {
+    static const int kFieldNumbers[] = {kAliasedFields...};
+    return kFieldNumbers;
+  }
+
+  static size_t Index(int field_number) {
+    for (size_t i = 0; i < sizeof...(kAliasedFields); i++) {
+      if (FieldNumbers()[i] == field_number) return i;
+    }
+    GPR_CODEGEN_ASSERT(false && "Not an aliased field");
+    return 0;
+  }
+
+  Message message_;
+  std::vector<Slice> fields_[sizeof...(kAliasedFields)];
+};
+
+}  // namespace experimental
+
+template <class Message, int... kAliasedFields>
+class SerializationTraits<
+    experimental::AliasedMessage<Message, kAliasedFields...>, void> {
+ public:
+  using AliasedMessageType =
+      experimental::AliasedMessage<Message, kAliasedFields...>;
+
+  static Status Serialize(const AliasedMessageType& msg, ByteBuffer* bb,
+                          bool* own_buffer) {
+    *own_buffer = true;
+    return internal::SerializeAliased(
+        msg.message_, AliasedMessageType::FieldNumbers(), msg.fields_,
+        sizeof...(kAliasedFields), bb);
+  }
+
+  static Status Deserialize(ByteBuffer* buffer, AliasedMessageType* msg) {
+    if (buffer == nullptr) {
+      return Status(StatusCode::INTERNAL, "No payload");
+    }
+    msg->Clear();
+    Status result;
+    {
+      ProtoBufferReader reader(buffer);
+      if (!reader.status().ok()) {
+        return reader.status();
+      }
+      result = internal::ParseAliased(&reader, &msg->message_,
+                                      AliasedMessageType::FieldNumbers(),
+                                      msg->fields_, sizeof...(kAliasedFields));
+    }
+    // The aliased fields hold their own references to the slices.
+    buffer->Clear();
+    return result;
+  }
+};
+
+namespace internal {
+
+// Allocates protobuf request and response messages on a protobuf::Arena.
+// The holder and the arena's first block are allocated on the call's arena, so
+// messages that fit in the block, along with their submessages and repeated
+// fields, need no heap allocation and are freed all at once. Only the contents
+// of strings too long to be stored inline by std::string still are.
+template <class RequestType, class ResponseType>
+class ArenaMessageHolder<
+    RequestType, ResponseType,
+    typename std::enable_if<
+        std::is_base_of<grpc::protobuf::MessageLite, RequestType>::value &&
+        std::is_base_of<grpc::protobuf::MessageLite, ResponseType>::value>::
+        type>
+    : public ::grpc::experimental::MessageHolder<RequestType, ResponseType> {
+ public:
+  static ArenaMessageHolder* Create(grpc_call* call,
+                                    size_t initial_block_size) {
+    void* holder = g_core_codegen_interface->grpc_call_arena_alloc(
+        call, sizeof(ArenaMessageHolder));
+    char* block = static_cast<char*>(
+        g_core_codegen_interface->grpc_call_arena_alloc(call,
+                                                        initial_block_size));
+    return new (holder) ArenaMessageHolder(block, initial_block_size);
+  }
+
+  void Release() override {
+    // The object and the first block are allocated in the call arena.
+    this->~ArenaMessageHolder();
+  }
+
+ private:
+  ArenaMessageHolder(char* initial_block, size_t initial_block_size)
+      : arena_(Options(initial_block, initial_block_size)) {
+    this->set_request(protobuf::Arena::CreateMessage<RequestType>(&arena_));
+    this->set_response(protobuf::Arena::CreateMessage<ResponseType>(&arena_));
+  }
+
+  static protobuf::ArenaOptions Options(char* initial_block,
+                                        size_t initial_block_size) {
+    protobuf::ArenaOptions options;
+    options.initial_block = initial_block;
+    options.initial_block_size = initial_block_size;
+    return options;
+  }
+
+  protobuf::Arena arena_;
+};
+
+}  // namespace internal
+
 }  // namespace grpc
 
 #endif  // GRPCPP_IMPL_CODEGEN_PROTO_UTILS_H
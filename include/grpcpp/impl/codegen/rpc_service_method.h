@@ -78,6 +78,11 @@ class MethodHandler {
     GPR_CODEGEN_ASSERT(req == nullptr);
     return nullptr;
   }
+
+  /* Allocates the request and response messages of each call on an arena of
+     \a initial_block_size bytes and more, if the handler and the message
+     types support it. See Service::EnableMessageArenas(). */
+  virtual void EnableMessageArenas(size_t /*initial_block_size*/) {}
 };
 
 /// Server side rpc method class
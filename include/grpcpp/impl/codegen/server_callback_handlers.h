@@ -86,7 +86,11 @@ class CallbackUnaryHandler : public ::grpc::internal::MethodHandler {
         allocator_state = nullptr;
     if (allocator_ != nullptr) {
       allocator_state = allocator_->AllocateMessages();
-    } else {
+    } else if (arena_initial_block_size_ > 0) {
+      allocator_state = ArenaMessageHolder<RequestType, ResponseType>::Create(
+          call, arena_initial_block_size_);
+    }
+    if (allocator_state == nullptr) {
       allocator_state =
           new (::grpc::g_core_codegen_interface->grpc_call_arena_alloc(
               call, sizeof(DefaultMessageHolder<RequestType, ResponseType>)))
@@ -105,12 +109,18 @@ class CallbackUnaryHandler : public ::grpc::internal::MethodHandler {
     return nullptr;
   }
 
+  void EnableMessageArenas(size_t initial_block_size) final {
+    arena_initial_block_size_ = initial_block_size;
+  }
+
  private:
   std::function<ServerUnaryReactor*(::grpc::CallbackServerContext*,
                                     const RequestType*, ResponseType*)>
       get_reactor_;
   ::grpc::experimental::MessageAllocator<RequestType, ResponseType>*
       allocator_ = nullptr;
+  // Used unless there is a custom allocator_. See RpcMethodHandler.
+  size_t arena_initial_block_size_ = 0;
 
   class ServerCallbackUnaryImpl : public ServerCallbackUnary {
    public:
@@ -98,6 +98,30 @@ class Service {
     return false;
   }
 
+  /// Allocates the request and response messages of each call to the
+  /// synchronous and callback unary methods of this service on an arena that
+  /// is freed when the call ends, rather than on the heap. The first
+  /// \a initial_block_size bytes of the arena come from the memory of the call
+  /// itself; messages that need more than that allocate further blocks. This
+  /// saves the allocation of each submessage, repeated field element and short
+  /// string, which adds up for large nested protobuf messages. Only protobuf
+  /// messages can be allocated on an arena, and a callback method with a
+  /// custom MessageAllocator keeps using it.
+  ///
+  /// Must be called before the service is registered with a server. The
+  /// handler must not keep references into its request or response after the
+  /// call, e.g. by swapping their submessages into longer-lived messages.
+  void EnableMessageArenas(size_t initial_block_size) {
+    GPR_CODEGEN_ASSERT(server_ == nullptr &&
+                       "EnableMessageArenas must be called before the service "
+                       "is registered.");
+    for (const auto& method : methods_) {
+      if (method && method->handler() != nullptr) {
+        method->handler()->EnableMessageArenas(initial_block_size);
+      }
+    }
+  }
+
  protected:
   // TODO(vjpai): Promote experimental contents once callback API is accepted
   class experimental_type {
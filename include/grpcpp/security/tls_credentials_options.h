@@ -26,6 +26,7 @@
 #include <grpcpp/support/config.h>
 
 #include <memory>
+#include <string>
 #include <vector>
 
 // TODO(yihuazhang): remove the forward declaration here and include
@@ -36,6 +37,7 @@ typedef struct grpc_tls_server_authorization_check_config
     grpc_tls_server_authorization_check_config;
 typedef struct grpc_tls_credentials_options grpc_tls_credentials_options;
 typedef struct grpc_tls_certificate_provider grpc_tls_certificate_provider;
+typedef struct grpc_tls_session_ticket_keys grpc_tls_session_ticket_keys;
 
 namespace grpc {
 namespace experimental {
@@ -146,6 +148,35 @@ class TlsServerAuthorizationCheckConfig {
       server_authorization_check_interface_;
 };
 
+// Keys a server uses to encrypt and decrypt TLS session tickets. Servers that
+// share the keys, including a server that was restarted, can resume each
+// other's sessions, so reconnecting clients skip the full handshake. The keys
+// can be replaced with Set() at any time, including while servers use them.
+// It is used for experimental purposes for now and it is subject to change.
+class TlsSessionTicketKeys {
+ public:
+  TlsSessionTicketKeys();
+  ~TlsSessionTicketKeys();
+
+  // Not copyable nor movable.
+  TlsSessionTicketKeys(const TlsSessionTicketKeys&) = delete;
+  TlsSessionTicketKeys& operator=(const TlsSessionTicketKeys&) = delete;
+
+  // Replaces the keys. The first key encrypts new tickets, and tickets
+  // encrypted with any of |keys| are accepted. To rotate, put the new key in
+  // front of the current one, and drop the old key once the tickets it
+  // encrypted have expired. Every key must be 48 or 80 bytes long, see
+  // grpc_tls_session_ticket_keys_set(). Returns false if the keys are invalid,
+  // in which case the previous keys stay in use.
+  bool Set(const std::vector<std::string>& keys);
+
+  // Get the internal c keys. This function shall be used only internally.
+  grpc_tls_session_ticket_keys* c_keys() const { return c_keys_; }
+
+ private:
+  grpc_tls_session_ticket_keys* c_keys_;
+};
+
 // Base class of configurable options specified by users to configure their
 // certain security features supported in TLS. It is used for experimental
 // purposes for now and it is subject to change.
@@ -236,7 +267,14 @@ class TlsServerCredentialsOptions final : public TlsCredentialsOptions {
   void set_cert_request_type(
       grpc_ssl_client_certificate_request_type cert_request_type);
 
+  // Sets the keys used to encrypt and decrypt session tickets. If not set, the
+  // server generates its own keys, and sessions cannot be resumed across
+  // restarts or other servers.
+  void set_session_ticket_keys(
+      std::shared_ptr<TlsSessionTicketKeys> session_ticket_keys);
+
  private:
+  std::shared_ptr<TlsSessionTicketKeys> session_ticket_keys_;
 };
 
 }  // namespace experimental
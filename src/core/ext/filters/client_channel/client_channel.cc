@@ -60,6 +60,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/connected_channel.h"
 #include "src/core/lib/channel/status_util.h"
+#include "src/core/lib/debug/call_phase_tracer.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/gprpp/sync.h"
@@ -532,7 +533,8 @@ class ChannelData::RetryingCall {
       ChannelData* chand, const grpc_call_element_args& args,
       grpc_polling_entity* pollent,
       RefCountedPtr<ServerRetryThrottleData> retry_throttle_data,
-      const ClientChannelMethodParsedConfig::RetryPolicy* retry_policy);
+      const ClientChannelMethodParsedConfig::RetryPolicy* retry_policy,
+      const ClientChannelMethodParsedConfig::HedgingPolicy* hedging_policy);
   ~RetryingCall();
 
   void StartTransportStreamOpBatch(grpc_transport_stream_op_batch* batch);
@@ -547,18 +549,21 @@ class ChannelData::RetryingCall {
   // batch on a given subchannel call.
   struct SubchannelCallBatchData {
     // Creates a SubchannelCallBatchData object on the call's arena with the
-    // specified refcount.  If set_on_complete is true, the batch's
-    // on_complete callback will be set to point to on_complete();
-    // otherwise, the batch's on_complete callback will be null.
-    static SubchannelCallBatchData* Create(RetryingCall* call, int refcount,
-                                           bool set_on_complete);
+    // specified refcount, for a batch to be started on lb_call.  If
+    // set_on_complete is true, the batch's on_complete callback will be set
+    // to point to on_complete(); otherwise, the batch's on_complete
+    // callback will be null.
+    static SubchannelCallBatchData* Create(
+        RetryingCall* call, ChannelData::LoadBalancedCall* lb_call,
+        int refcount, bool set_on_complete);
 
     void Unref() {
       if (gpr_unref(&refs)) Destroy();
     }
 
-    SubchannelCallBatchData(RetryingCall* call, int refcount,
-                            bool set_on_complete);
+    SubchannelCallBatchData(RetryingCall* call,
+                            ChannelData::LoadBalancedCall* lb_call,
+                            int refcount, bool set_on_complete);
     // All dtor code must be added in `Destroy()`. This is because we may
     // call closures in `SubchannelCallBatchData` after they are unrefed by
     // `Unref()`, and msan would complain about accessing this class
@@ -640,11 +645,37 @@ class ChannelData::RetryingCall {
     SubchannelCallBatchData* recv_message_ready_deferred_batch = nullptr;
     grpc_error* recv_message_error = GRPC_ERROR_NONE;
     SubchannelCallBatchData* recv_trailing_metadata_internal_batch = nullptr;
+    // When hedging, the first error returned by this attempt's send ops
+    // while the call is uncommitted.  It is held back from the surface,
+    // since another attempt may still succeed, and is returned only if
+    // the call commits to this attempt.
+    grpc_error* send_error = GRPC_ERROR_NONE;
     // NOTE: Do not move this next to the metadata bitfields above. That would
     //       save space but will also result in a data race because compiler
     //       will generate a 2 byte store which overwrites the meta-data
     //       fields upon setting this field.
+    // Also set when a hedged attempt is abandoned, in which case any
+    // results that it still returns are discarded.
     bool retry_dispatched : 1;
+    // The number of attempts started before this one, sent to the server
+    // in grpc-previous-rpc-attempts.
+    int num_previous_attempts = 0;
+  };
+
+  // A fire-and-forget hedging timer.  Allocated on the call arena.  When
+  // it fires, another attempt is started alongside the ones in flight.
+  struct HedgingTimer {
+    HedgingTimer(RetryingCall* retrying_call, grpc_millis deadline);
+
+    // Timer callback.
+    static void OnTimer(void* arg, grpc_error* error);
+    // This is called via the call combiner, so access to call is
+    // synchronized.
+    static void StartHedgeInCallCombiner(void* arg, grpc_error* error);
+
+    RetryingCall* call;
+    grpc_timer timer;
+    grpc_closure closure;
   };
 
   // Pending batches stored in call data.
@@ -653,6 +684,9 @@ class ChannelData::RetryingCall {
     grpc_transport_stream_op_batch* batch = nullptr;
     // Indicates whether payload for send ops has been cached in CallData.
     bool send_ops_cached = false;
+    // The index of the batch's send_message op in send_messages_, once
+    // cached.
+    size_t send_message_index = 0;
   };
 
   // Caches data for send ops so that it can be retried later, if not
@@ -697,7 +731,8 @@ class ChannelData::RetryingCall {
       grpc_error* error,
       YieldCallCombinerPredicate yield_call_combiner_predicate);
   static void ResumePendingBatchInCallCombiner(void* arg, grpc_error* ignored);
-  // Resumes all pending batches on lb_call_.
+  // Resumes all pending batches on lb_call_, or on every attempt in flight
+  // when hedging.
   void PendingBatchesResume();
   // Returns a pointer to the first pending batch for which predicate(batch)
   // returns true, or null if not found.
@@ -712,6 +747,30 @@ class ChannelData::RetryingCall {
   // Returns true if the call is being retried.
   bool MaybeRetry(SubchannelCallBatchData* batch_data, grpc_status_code status,
                   grpc_mdelem* server_pushback_md);
+  // Returns true if a hedging policy is configured and another attempt
+  // may be started.
+  bool CanStartHedgedAttempt() const;
+  // Starts the hedging timer, if another attempt may be started.
+  void MaybeStartHedgingTimer(grpc_millis delay);
+  // Cancels the hedging timer, if any.
+  void CancelHedgingTimer();
+  // Handles a hedged attempt that failed.  Returns true if the attempt
+  // was dropped in favor of others, in which case batch_data is unreffed
+  // and the call combiner yielded; returns false if the attempt's result
+  // should be returned to the surface.
+  bool MaybeHedge(SubchannelCallBatchData* batch_data, grpc_status_code status,
+                  grpc_mdelem* server_pushback_md);
+  // Cancels the hedged attempt on lb_call, whose results will not be used.
+  void AbandonAttempt(ChannelData::LoadBalancedCall* lb_call);
+  // Abandons all attempts other than lb_call_.
+  void AbandonHedgedAttempts();
+  // The on_complete callback for the cancel_stream batch sent to an
+  // abandoned attempt.  Yields the call combiner.
+  static void OnCancelComplete(void* arg, grpc_error* error);
+  // Releases the deferred recv_initial_metadata_ready and recv_message_ready
+  // callbacks and the held send op error of an attempt whose results will
+  // not be used.
+  static void DropAttemptResults(SubchannelCallRetryState* retry_state);
 
   // Invokes recv_initial_metadata_ready for a subchannel batch.
   static void InvokeRecvInitialMetadataCallback(void* arg, grpc_error* error);
@@ -760,6 +819,18 @@ class ChannelData::RetryingCall {
   void AddClosuresForCompletedPendingBatch(SubchannelCallBatchData* batch_data,
                                            grpc_error* error,
                                            CallCombinerClosureList* closures);
+  // When hedging, attempts race to complete the same pending batches.
+  // Each pending batch is completed once, when all of its send ops have
+  // succeeded on some attempt.  Errors are held back in retry_state until
+  // the call commits.
+  void AddClosuresForCompletedHedgedSendOps(
+      SubchannelCallRetryState* retry_state, grpc_error* error,
+      CallCombinerClosureList* closures);
+  // Fails the pending batches whose send ops have all been started on the
+  // attempt but have not yet completed.
+  void AddClosuresToFailStartedPendingBatches(
+      SubchannelCallRetryState* retry_state, grpc_error* error,
+      CallCombinerClosureList* closures);
 
   // If there are any cached ops to replay or pending ops to start on the
   // subchannel call, adds a closure to closures to invoke
@@ -773,8 +844,10 @@ class ChannelData::RetryingCall {
   static void OnComplete(void* arg, grpc_error* error);
 
   static void StartBatchInCallCombiner(void* arg, grpc_error* ignored);
-  // Adds a closure to closures that will execute batch in the call combiner.
-  void AddClosureForSubchannelBatch(grpc_transport_stream_op_batch* batch,
+  // Adds a closure to closures that will execute batch on lb_call in the
+  // call combiner.
+  void AddClosureForSubchannelBatch(ChannelData::LoadBalancedCall* lb_call,
+                                    grpc_transport_stream_op_batch* batch,
                                     CallCombinerClosureList* closures);
   // Adds retriable send_initial_metadata op to batch_data.
   void AddRetriableSendInitialMetadataOp(SubchannelCallRetryState* retry_state,
@@ -798,25 +871,38 @@ class ChannelData::RetryingCall {
   // is used in the case where a recv_initial_metadata or recv_message
   // op fails in a way that we know the call is over but when the application
   // has not yet started its own recv_trailing_metadata op.
-  void StartInternalRecvTrailingMetadata();
-  // If there are any cached send ops that need to be replayed on the
-  // current subchannel call, creates and returns a new subchannel batch
-  // to replay those ops.  Otherwise, returns nullptr.
+  void StartInternalRecvTrailingMetadata(
+      ChannelData::LoadBalancedCall* lb_call);
+  // If there are any cached send ops that need to be replayed on lb_call,
+  // creates and returns a new subchannel batch to replay those ops.
+  // Otherwise, returns nullptr.
   SubchannelCallBatchData* MaybeCreateSubchannelBatchForReplay(
+      ChannelData::LoadBalancedCall* lb_call,
       SubchannelCallRetryState* retry_state);
-  // Adds subchannel batches for pending batches to closures.
+  // Adds subchannel batches for pending batches on lb_call to closures.
   void AddSubchannelBatchesForPendingBatches(
+      ChannelData::LoadBalancedCall* lb_call,
       SubchannelCallRetryState* retry_state, CallCombinerClosureList* closures);
+  // Adds whatever subchannel batches are needed on lb_call to closures.
+  void AddRetriableSubchannelBatches(ChannelData::LoadBalancedCall* lb_call,
+                                     CallCombinerClosureList* closures);
   // Constructs and starts whatever subchannel batches are needed on the
-  // subchannel call.
+  // subchannel calls of the attempts in flight.
   static void StartRetriableSubchannelBatches(void* arg, grpc_error* ignored);
 
+  // Creates the LB call for a new attempt, which becomes lb_call_.  When
+  // hedging, the previous attempt stays in flight in hedged_lb_calls_.
+  void CreateAttempt();
+  // Starts a new attempt (or all of them, if hedging with no delay) and
+  // resumes pending batches on it.
   static void CreateLbCall(void* arg, grpc_error* error);
 
   ChannelData* chand_;
   grpc_polling_entity* pollent_;
   RefCountedPtr<ServerRetryThrottleData> retry_throttle_data_;
   const ClientChannelMethodParsedConfig::RetryPolicy* retry_policy_ = nullptr;
+  const ClientChannelMethodParsedConfig::HedgingPolicy* hedging_policy_ =
+      nullptr;
   BackOff retry_backoff_;
 
   grpc_slice path_;  // Request path.
@@ -829,7 +915,13 @@ class ChannelData::RetryingCall {
 
   grpc_closure retry_closure_;
 
+  // The most recently started attempt.  Once the call is committed, this
+  // is the committed attempt.
   RefCountedPtr<ChannelData::LoadBalancedCall> lb_call_;
+  // When hedging, earlier attempts that are still in flight.  The service
+  // config parser caps hedged attempts at 5, so these are always inlined.
+  absl::InlinedVector<RefCountedPtr<ChannelData::LoadBalancedCall>, 4>
+      hedged_lb_calls_;
 
   // Batches are added to this list when received from above.
   // They are removed when we are done handling the batch (i.e., when
@@ -852,8 +944,18 @@ class ChannelData::RetryingCall {
   bool retry_committed_ : 1;
   bool last_attempt_got_server_pushback_ : 1;
   int num_attempts_completed_ = 0;
+  int num_attempts_started_ = 0;
   size_t bytes_buffered_for_retry_ = 0;
   grpc_timer retry_timer_;
+  // The hedging timer, or null if not pending.
+  HedgingTimer* hedging_timer_ = nullptr;
+  // Set once an abandoned attempt may still be reading the cached
+  // send_message ops, which are then only freed when the call is destroyed.
+  bool free_cached_send_messages_on_destroy_ = false;
+  // When hedging, the send ops that have succeeded on any attempt.
+  bool send_initial_metadata_succeeded_ = false;
+  size_t num_send_messages_succeeded_ = 0;
+  bool send_trailing_metadata_succeeded_ = false;
 
   // The number of pending retriable subchannel batches containing send ops.
   // We hold a ref to the call stack while this is non-zero, since replay
@@ -1177,7 +1279,9 @@ class ChannelData::DynamicTerminationFilterChannelData::
       // Create retrying call.
       calld->retrying_call_ = calld->arena_->New<ChannelData::RetryingCall>(
           client_channel, args, pollent, chand->retry_throttle_data_,
-          method_config == nullptr ? nullptr : method_config->retry_policy());
+          method_config == nullptr ? nullptr : method_config->retry_policy(),
+          method_config == nullptr ? nullptr
+                                   : method_config->hedging_policy());
       if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
         gpr_log(
             GPR_INFO,
@@ -3223,6 +3327,13 @@ void ChannelData::CallData::CreateDynamicCall(grpc_call_element* elem) {
 //
 // When constructing the "child" batches, we compare those two sets of
 // data to see which batches need to be sent to the subchannel call.
+//
+// Hedging uses the same machinery, except that several attempts may be in
+// flight at once, each with its own subchannel call and retry state.  A
+// new attempt is started each time the hedging delay elapses, and the
+// cached send ops are replayed on it.  The first attempt to return data
+// from the server (or a final status that is not non-fatal) is committed,
+// and the others are cancelled.
 
 // TODO(roth): In subsequent PRs:
 // - add support for transparent retries (including initial metadata)
@@ -3234,11 +3345,13 @@ ChannelData::RetryingCall::RetryingCall(
     ChannelData* chand, const grpc_call_element_args& args,
     grpc_polling_entity* pollent,
     RefCountedPtr<ServerRetryThrottleData> retry_throttle_data,
-    const ClientChannelMethodParsedConfig::RetryPolicy* retry_policy)
+    const ClientChannelMethodParsedConfig::RetryPolicy* retry_policy,
+    const ClientChannelMethodParsedConfig::HedgingPolicy* hedging_policy)
     : chand_(chand),
       pollent_(pollent),
       retry_throttle_data_(std::move(retry_throttle_data)),
       retry_policy_(retry_policy),
+      hedging_policy_(hedging_policy),
       retry_backoff_(
           BackOff::Options()
               .set_initial_backoff(
@@ -3270,6 +3383,9 @@ ChannelData::RetryingCall::~RetryingCall() {
   for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
     GPR_ASSERT(pending_batches_[i].batch == nullptr);
   }
+  if (free_cached_send_messages_on_destroy_) {
+    for (ByteStreamCache* cache : send_messages_) cache->Destroy();
+  }
 }
 
 void ChannelData::RetryingCall::StartTransportStreamOpBatch(
@@ -3302,6 +3418,7 @@ void ChannelData::RetryingCall::StartTransportStreamOpBatch(
     // If we do not have an LB call (i.e., a pick has not yet been started),
     // fail all pending batches.  Otherwise, send the cancellation down to the
     // LB call.
+    CancelHedgingTimer();
     if (lb_call_ == nullptr) {
       // TODO(roth): If there is a pending retry callback, do we need to
       // cancel it here?
@@ -3310,6 +3427,9 @@ void ChannelData::RetryingCall::StartTransportStreamOpBatch(
       grpc_transport_stream_op_batch_finish_with_failure(
           batch, GRPC_ERROR_REF(cancel_error_), call_combiner_);
     } else {
+      // Earlier hedged attempts are cancelled independently; the result of
+      // the latest one is returned to the surface.
+      AbandonHedgedAttempts();
       // Note: This will release the call combiner.
       lb_call_->StartTransportStreamOpBatch(batch);
     }
@@ -3372,6 +3492,7 @@ void ChannelData::RetryingCall::MaybeCacheSendOpsForBatch(
   if (batch->send_message) {
     ByteStreamCache* cache = arena_->New<ByteStreamCache>(
         std::move(batch->payload->send_message.send_message));
+    pending->send_message_index = send_messages_.size();
     send_messages_.push_back(cache);
   }
   // Save metadata batch for send_trailing_metadata ops.
@@ -3398,6 +3519,7 @@ void ChannelData::RetryingCall::FreeCachedSendInitialMetadata() {
 }
 
 void ChannelData::RetryingCall::FreeCachedSendMessage(size_t idx) {
+  if (free_cached_send_messages_on_destroy_) return;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p retrying_call=%p: destroying send_messages[%" PRIuPTR "]",
@@ -3682,6 +3804,20 @@ void ChannelData::RetryingCall::RetryCommit(
     gpr_log(GPR_INFO, "chand=%p retrying_call=%p: committing retries", chand_,
             this);
   }
+  CancelHedgingTimer();
+  if (!hedged_lb_calls_.empty() && retry_state != nullptr) {
+    // Make the committed attempt lb_call_ and abandon the others.
+    if (lb_call_->GetParentData() != retry_state) {
+      for (auto& lb_call : hedged_lb_calls_) {
+        if (lb_call->GetParentData() == retry_state) {
+          std::swap(lb_call, lb_call_);
+          break;
+        }
+      }
+    }
+    GPR_ASSERT(lb_call_->GetParentData() == retry_state);
+    AbandonHedgedAttempts();
+  }
   if (retry_state != nullptr) {
     FreeCachedSendOpDataAfterCommit(retry_state);
   }
@@ -3824,20 +3960,274 @@ bool ChannelData::RetryingCall::MaybeRetry(SubchannelCallBatchData* batch_data,
   return true;
 }
 
+//
+// hedging code
+//
+
+bool ChannelData::RetryingCall::CanStartHedgedAttempt() const {
+  if (hedging_policy_ == nullptr || !enable_retries_ || retry_committed_ ||
+      cancel_error_ != GRPC_ERROR_NONE ||
+      num_attempts_started_ >= hedging_policy_->max_attempts) {
+    return false;
+  }
+  // Hedged attempts count against the retry throttle, like retries.
+  if (retry_throttle_data_ != nullptr && retry_throttle_data_->IsThrottled()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO, "chand=%p retrying_call=%p: hedging throttled", chand_,
+              this);
+    }
+    return false;
+  }
+  return true;
+}
+
+void ChannelData::RetryingCall::MaybeStartHedgingTimer(grpc_millis delay) {
+  CancelHedgingTimer();
+  if (!CanStartHedgedAttempt()) return;
+  hedging_timer_ =
+      arena_->New<HedgingTimer>(this, ExecCtx::Get()->Now() + delay);
+}
+
+void ChannelData::RetryingCall::CancelHedgingTimer() {
+  if (hedging_timer_ == nullptr) return;
+  grpc_timer_cancel(&hedging_timer_->timer);
+  hedging_timer_ = nullptr;
+}
+
+bool ChannelData::RetryingCall::MaybeHedge(SubchannelCallBatchData* batch_data,
+                                           grpc_status_code status,
+                                           grpc_mdelem* server_pushback_md) {
+  ChannelData::LoadBalancedCall* lb_call = batch_data->lb_call.get();
+  SubchannelCallRetryState* retry_state =
+      static_cast<SubchannelCallRetryState*>(lb_call->GetParentData());
+  // Check status.
+  if (GPR_LIKELY(status == GRPC_STATUS_OK)) {
+    if (retry_throttle_data_ != nullptr) {
+      retry_throttle_data_->RecordSuccess();
+    }
+    return false;
+  }
+  // A fatal status is returned to the surface, and any other attempts are
+  // cancelled when the call is committed.
+  if (!hedging_policy_->non_fatal_status_codes.Contains(status)) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(
+          GPR_INFO,
+          "chand=%p retrying_call=%p: status %s not configured as non-fatal",
+          chand_, this, grpc_status_code_to_string(status));
+    }
+    return false;
+  }
+  // Record the failure.  Once throttled, no new attempts are started, but
+  // the ones in flight are left alone.
+  if (retry_throttle_data_ != nullptr) retry_throttle_data_->RecordFailure();
+  if (retry_committed_ || cancel_error_ != GRPC_ERROR_NONE) return false;
+  // Check server push-back.  If the value is "-1" or any other unparseable
+  // string, no new attempts are started.
+  bool start_attempt = CanStartHedgedAttempt();
+  grpc_millis server_pushback_ms = -1;
+  if (server_pushback_md != nullptr) {
+    uint32_t ms;
+    if (!grpc_parse_slice_to_uint32(GRPC_MDVALUE(*server_pushback_md), &ms)) {
+      if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+        gpr_log(
+            GPR_INFO,
+            "chand=%p retrying_call=%p: not hedging due to server push-back",
+            chand_, this);
+      }
+      start_attempt = false;
+    } else {
+      server_pushback_ms = static_cast<grpc_millis>(ms);
+    }
+  }
+  // If nothing else can succeed, this attempt's result is the call's.
+  if (!start_attempt && hedged_lb_calls_.empty()) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p retrying_call=%p: no hedged attempts remaining",
+              chand_, this);
+    }
+    return false;
+  }
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p retrying_call=%p: dropping failed hedged attempt "
+            "lb_call=%p",
+            chand_, this, lb_call);
+  }
+  // Drop the attempt.
+  retry_state->retry_dispatched = true;
+  DropAttemptResults(retry_state);
+  if (lb_call == lb_call_.get()) {
+    lb_call_.reset();
+    if (!hedged_lb_calls_.empty()) {
+      lb_call_ = std::move(hedged_lb_calls_.back());
+      hedged_lb_calls_.pop_back();
+    }
+  } else {
+    for (auto it = hedged_lb_calls_.begin(); it != hedged_lb_calls_.end();
+         ++it) {
+      if (it->get() == lb_call) {
+        hedged_lb_calls_.erase(it);
+        break;
+      }
+    }
+  }
+  batch_data->Unref();
+  // A non-fatal failure starts the next attempt without waiting for the
+  // hedging delay, unless the server pushed back.
+  if (start_attempt && server_pushback_ms < 0) {
+    CancelHedgingTimer();
+    // Note: This will release the call combiner.
+    CreateLbCall(this, GRPC_ERROR_NONE);
+    return true;
+  }
+  if (start_attempt) MaybeStartHedgingTimer(server_pushback_ms);
+  GRPC_CALL_COMBINER_STOP(call_combiner_, "hedged attempt dropped");
+  return true;
+}
+
+void ChannelData::RetryingCall::AbandonAttempt(
+    ChannelData::LoadBalancedCall* lb_call) {
+  SubchannelCallRetryState* retry_state =
+      static_cast<SubchannelCallRetryState*>(lb_call->GetParentData());
+  if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+    gpr_log(GPR_INFO,
+            "chand=%p retrying_call=%p: abandoning hedged attempt lb_call=%p",
+            chand_, this, lb_call);
+  }
+  retry_state->retry_dispatched = true;
+  GRPC_ERROR_UNREF(retry_state->send_error);
+  retry_state->send_error = GRPC_ERROR_NONE;
+  // The attempt may still be reading the cached send_message ops.
+  if (retry_state->started_send_message_count >
+      retry_state->completed_send_message_count) {
+    free_cached_send_messages_on_destroy_ = true;
+  }
+  // The surface's recv_trailing_metadata op would have released the extra
+  // ref held by an internally started one.
+  if (retry_state->recv_trailing_metadata_internal_batch != nullptr) {
+    retry_state->recv_trailing_metadata_internal_batch->Unref();
+    retry_state->recv_trailing_metadata_internal_batch = nullptr;
+  }
+  if (retry_state->completed_recv_trailing_metadata) return;
+  CallCombinerClosureList closures;
+  // Make sure that the LB call sees the attempt finish.
+  if (!retry_state->started_recv_trailing_metadata) {
+    SubchannelCallBatchData* batch_data = SubchannelCallBatchData::Create(
+        this, lb_call, 1, false /* set_on_complete */);
+    AddRetriableRecvTrailingMetadataOp(retry_state, batch_data);
+    AddClosureForSubchannelBatch(lb_call, &batch_data->batch, &closures);
+  }
+  SubchannelCallBatchData* batch_data = SubchannelCallBatchData::Create(
+      this, lb_call, 1, false /* set_on_complete */);
+  GRPC_CLOSURE_INIT(&batch_data->on_complete, OnCancelComplete, batch_data,
+                    grpc_schedule_on_exec_ctx);
+  batch_data->batch.on_complete = &batch_data->on_complete;
+  batch_data->batch.cancel_stream = true;
+  batch_data->batch.payload->cancel_stream.cancel_error = grpc_error_set_int(
+      GRPC_ERROR_CREATE_FROM_STATIC_STRING("Hedged attempt abandoned"),
+      GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_CANCELLED);
+  AddClosureForSubchannelBatch(lb_call, &batch_data->batch, &closures);
+  closures.RunClosuresWithoutYielding(call_combiner_);
+}
+
+void ChannelData::RetryingCall::AbandonHedgedAttempts() {
+  for (auto& lb_call : hedged_lb_calls_) AbandonAttempt(lb_call.get());
+  hedged_lb_calls_.clear();
+}
+
+void ChannelData::RetryingCall::OnCancelComplete(void* arg,
+                                                 grpc_error* /*error*/) {
+  SubchannelCallBatchData* batch_data =
+      static_cast<SubchannelCallBatchData*>(arg);
+  GRPC_CALL_COMBINER_STOP(batch_data->call->call_combiner_,
+                          "on_complete for hedged attempt cancel_stream");
+  batch_data->Unref();
+}
+
+void ChannelData::RetryingCall::DropAttemptResults(
+    SubchannelCallRetryState* retry_state) {
+  if (retry_state->recv_initial_metadata_ready_deferred_batch != nullptr) {
+    GRPC_ERROR_UNREF(retry_state->recv_initial_metadata_error);
+    retry_state->recv_initial_metadata_error = GRPC_ERROR_NONE;
+    retry_state->recv_initial_metadata_ready_deferred_batch->Unref();
+    retry_state->recv_initial_metadata_ready_deferred_batch = nullptr;
+  }
+  if (retry_state->recv_message_ready_deferred_batch != nullptr) {
+    retry_state->recv_message.reset();
+    GRPC_ERROR_UNREF(retry_state->recv_message_error);
+    retry_state->recv_message_error = GRPC_ERROR_NONE;
+    retry_state->recv_message_ready_deferred_batch->Unref();
+    retry_state->recv_message_ready_deferred_batch = nullptr;
+  }
+  GRPC_ERROR_UNREF(retry_state->send_error);
+  retry_state->send_error = GRPC_ERROR_NONE;
+}
+
+//
+// ChannelData::RetryingCall::HedgingTimer
+//
+
+ChannelData::RetryingCall::HedgingTimer::HedgingTimer(
+    RetryingCall* retrying_call, grpc_millis deadline)
+    : call(retrying_call) {
+  GRPC_CALL_STACK_REF(call->owning_call_, "hedging_timer");
+  GRPC_CLOSURE_INIT(&closure, OnTimer, this, nullptr);
+  grpc_timer_init(&timer, deadline, &closure);
+}
+
+void ChannelData::RetryingCall::HedgingTimer::OnTimer(void* arg,
+                                                      grpc_error* error) {
+  HedgingTimer* self = static_cast<HedgingTimer*>(arg);
+  if (error == GRPC_ERROR_CANCELLED) {
+    GRPC_CALL_STACK_UNREF(self->call->owning_call_, "hedging_timer");
+    return;
+  }
+  GRPC_CLOSURE_INIT(&self->closure, StartHedgeInCallCombiner, self, nullptr);
+  GRPC_CALL_COMBINER_START(self->call->call_combiner_, &self->closure,
+                           GRPC_ERROR_NONE, "hedging timer fired");
+}
+
+void ChannelData::RetryingCall::HedgingTimer::StartHedgeInCallCombiner(
+    void* arg, grpc_error* /*error*/) {
+  HedgingTimer* self = static_cast<HedgingTimer*>(arg);
+  RetryingCall* call = self->call;
+  grpc_call_stack* owning_call = call->owning_call_;
+  // Don't hedge if the timer was cancelled after it fired.
+  const bool current = call->hedging_timer_ == self;
+  if (current) call->hedging_timer_ = nullptr;
+  if (!current || !call->CanStartHedgedAttempt()) {
+    GRPC_CALL_COMBINER_STOP(call->call_combiner_, "hedging timer ignored");
+  } else {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p retrying_call=%p: hedging delay elapsed, starting "
+              "attempt %d",
+              call->chand_, call, call->num_attempts_started_ + 1);
+    }
+    // Note: This will release the call combiner.
+    CreateLbCall(call, GRPC_ERROR_NONE);
+  }
+  GRPC_CALL_STACK_UNREF(owning_call, "hedging_timer");
+}
+
 //
 // ChannelData::RetryingCall::SubchannelCallBatchData
 //
 
 ChannelData::RetryingCall::SubchannelCallBatchData*
 ChannelData::RetryingCall::SubchannelCallBatchData::Create(
-    RetryingCall* call, int refcount, bool set_on_complete) {
-  return call->arena_->New<SubchannelCallBatchData>(call, refcount,
+    RetryingCall* call, ChannelData::LoadBalancedCall* lb_call, int refcount,
+    bool set_on_complete) {
+  return call->arena_->New<SubchannelCallBatchData>(call, lb_call, refcount,
                                                     set_on_complete);
 }
 
 ChannelData::RetryingCall::SubchannelCallBatchData::SubchannelCallBatchData(
-    RetryingCall* call, int refcount, bool set_on_complete)
-    : call(call), lb_call(call->lb_call_) {
+    RetryingCall* call, ChannelData::LoadBalancedCall* lb_call, int refcount,
+    bool set_on_complete)
+    : call(call), lb_call(lb_call->Ref()) {
   SubchannelCallRetryState* retry_state =
       static_cast<SubchannelCallRetryState*>(lb_call->GetParentData());
   batch.payload = &retry_state->batch_payload;
@@ -3926,6 +4316,7 @@ void ChannelData::RetryingCall::RecvInitialMetadataReady(void* arg,
   // If a retry was already dispatched, then we're not going to use the
   // result of this recv_initial_metadata op, so do nothing.
   if (retry_state->retry_dispatched) {
+    batch_data->Unref();
     GRPC_CALL_COMBINER_STOP(
         call->call_combiner_,
         "recv_initial_metadata_ready after retry dispatched");
@@ -3950,7 +4341,7 @@ void ChannelData::RetryingCall::RecvInitialMetadataReady(void* arg,
     if (!retry_state->started_recv_trailing_metadata) {
       // recv_trailing_metadata not yet started by application; start it
       // ourselves to get status.
-      call->StartInternalRecvTrailingMetadata();
+      call->StartInternalRecvTrailingMetadata(batch_data->lb_call.get());
     } else {
       GRPC_CALL_COMBINER_STOP(
           call->call_combiner_,
@@ -4016,6 +4407,8 @@ void ChannelData::RetryingCall::RecvMessageReady(void* arg, grpc_error* error) {
   // If a retry was already dispatched, then we're not going to use the
   // result of this recv_message op, so do nothing.
   if (retry_state->retry_dispatched) {
+    retry_state->recv_message.reset();
+    batch_data->Unref();
     GRPC_CALL_COMBINER_STOP(call->call_combiner_,
                             "recv_message_ready after retry dispatched");
     return;
@@ -4039,7 +4432,7 @@ void ChannelData::RetryingCall::RecvMessageReady(void* arg, grpc_error* error) {
     if (!retry_state->started_recv_trailing_metadata) {
       // recv_trailing_metadata not yet started by application; start it
       // ourselves to get status.
-      call->StartInternalRecvTrailingMetadata();
+      call->StartInternalRecvTrailingMetadata(batch_data->lb_call.get());
     } else {
       GRPC_CALL_COMBINER_STOP(call->call_combiner_, "recv_message_ready null");
     }
@@ -4196,6 +4589,12 @@ void ChannelData::RetryingCall::RunClosuresForCompletedCall(
   // Add closures to fail any pending batches that have not yet been started.
   AddClosuresToFailUnstartedPendingBatches(retry_state, GRPC_ERROR_REF(error),
                                            &closures);
+  // Return any send op error held back while the call was uncommitted.
+  if (retry_state->send_error != GRPC_ERROR_NONE) {
+    AddClosuresToFailStartedPendingBatches(retry_state, retry_state->send_error,
+                                           &closures);
+    retry_state->send_error = GRPC_ERROR_NONE;
+  }
   // Don't need batch_data anymore.
   batch_data->Unref();
   // Schedule all of the closures identified above.
@@ -4219,6 +4618,16 @@ void ChannelData::RetryingCall::RecvTrailingMetadataReady(void* arg,
       static_cast<SubchannelCallRetryState*>(
           batch_data->lb_call->GetParentData());
   retry_state->completed_recv_trailing_metadata = true;
+  // If this hedged attempt was abandoned, we're not going to use its
+  // result, so just release it.
+  if (retry_state->retry_dispatched) {
+    DropAttemptResults(retry_state);
+    batch_data->Unref();
+    GRPC_CALL_COMBINER_STOP(
+        call->call_combiner_,
+        "recv_trailing_metadata_ready for abandoned attempt");
+    return;
+  }
   // Get the call's status and check for server pushback metadata.
   grpc_status_code status = GRPC_STATUS_OK;
   grpc_mdelem* server_pushback_md = nullptr;
@@ -4230,6 +4639,12 @@ void ChannelData::RetryingCall::RecvTrailingMetadataReady(void* arg,
     gpr_log(GPR_INFO, "chand=%p retrying_call=%p: call finished, status=%s",
             call->chand_, call, grpc_status_code_to_string(status));
   }
+  // When hedging, other attempts may still succeed.
+  // Note: This will release the call combiner if it returns true.
+  if (call->hedging_policy_ != nullptr &&
+      call->MaybeHedge(batch_data, status, server_pushback_md)) {
+    return;
+  }
   // Check if we should retry.
   if (call->MaybeRetry(batch_data, status, server_pushback_md)) {
     // Unref batch_data for deferred recv_initial_metadata_ready or
@@ -4282,6 +4697,83 @@ void ChannelData::RetryingCall::AddClosuresForCompletedPendingBatch(
   MaybeClearPendingBatch(pending);
 }
 
+void ChannelData::RetryingCall::AddClosuresForCompletedHedgedSendOps(
+    SubchannelCallRetryState* retry_state, grpc_error* error,
+    CallCombinerClosureList* closures) {
+  if (error != GRPC_ERROR_NONE) {
+    // Another attempt may still succeed, so hold the error back.
+    if (!retry_committed_) {
+      if (retry_state->send_error == GRPC_ERROR_NONE) {
+        retry_state->send_error = error;
+      } else {
+        GRPC_ERROR_UNREF(error);
+      }
+      return;
+    }
+    AddClosuresToFailStartedPendingBatches(retry_state, error, closures);
+    return;
+  }
+  // Send ops complete in order, so everything this attempt has completed
+  // has succeeded, unless an earlier op failed.
+  if (retry_state->send_error != GRPC_ERROR_NONE) return;
+  if (retry_state->completed_send_initial_metadata) {
+    send_initial_metadata_succeeded_ = true;
+  }
+  num_send_messages_succeeded_ = GPR_MAX(
+      num_send_messages_succeeded_, retry_state->completed_send_message_count);
+  if (retry_state->completed_send_trailing_metadata) {
+    send_trailing_metadata_succeeded_ = true;
+  }
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
+    PendingBatch* pending = &pending_batches_[i];
+    grpc_transport_stream_op_batch* batch = pending->batch;
+    if (batch == nullptr || batch->on_complete == nullptr ||
+        !pending->send_ops_cached) {
+      continue;
+    }
+    if ((batch->send_initial_metadata && !send_initial_metadata_succeeded_) ||
+        (batch->send_message &&
+         pending->send_message_index >= num_send_messages_succeeded_) ||
+        (batch->send_trailing_metadata && !send_trailing_metadata_succeeded_)) {
+      continue;
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p retrying_call=%p: completing pending batch at index "
+              "%" PRIuPTR,
+              chand_, this, i);
+    }
+    closures->Add(batch->on_complete, GRPC_ERROR_NONE,
+                  "on_complete for pending batch");
+    batch->on_complete = nullptr;
+    MaybeClearPendingBatch(pending);
+  }
+}
+
+void ChannelData::RetryingCall::AddClosuresToFailStartedPendingBatches(
+    SubchannelCallRetryState* retry_state, grpc_error* error,
+    CallCombinerClosureList* closures) {
+  for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
+    PendingBatch* pending = &pending_batches_[i];
+    if (pending->batch == nullptr || pending->batch->on_complete == nullptr ||
+        !pending->send_ops_cached ||
+        PendingBatchIsUnstarted(pending, retry_state)) {
+      continue;
+    }
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
+      gpr_log(GPR_INFO,
+              "chand=%p retrying_call=%p: failing started pending batch at "
+              "index %" PRIuPTR,
+              chand_, this, i);
+    }
+    closures->Add(pending->batch->on_complete, GRPC_ERROR_REF(error),
+                  "failing on_complete for pending batch");
+    pending->batch->on_complete = nullptr;
+    MaybeClearPendingBatch(pending);
+  }
+  GRPC_ERROR_UNREF(error);
+}
+
 void ChannelData::RetryingCall::AddClosuresForReplayOrPendingSendOps(
     SubchannelCallBatchData* batch_data, SubchannelCallRetryState* retry_state,
     CallCombinerClosureList* closures) {
@@ -4341,8 +4833,8 @@ void ChannelData::RetryingCall::OnComplete(void* arg, grpc_error* error) {
     retry_state->completed_send_trailing_metadata = true;
   }
   // If the call is committed, free cached data for send ops that we've just
-  // completed.
-  if (call->retry_committed_) {
+  // completed.  Abandoned hedged attempts leave that to the committed one.
+  if (call->retry_committed_ && !retry_state->retry_dispatched) {
     call->FreeCachedSendOpDataForCompletedBatch(batch_data, retry_state);
   }
   // Construct list of closures to execute.
@@ -4352,8 +4844,13 @@ void ChannelData::RetryingCall::OnComplete(void* arg, grpc_error* error) {
   // Otherwise, invoke the callback to return the result to the surface.
   if (!retry_state->retry_dispatched) {
     // Add closure for the completed pending batch, if any.
-    call->AddClosuresForCompletedPendingBatch(batch_data, GRPC_ERROR_REF(error),
-                                              &closures);
+    if (call->hedging_policy_ != nullptr) {
+      call->AddClosuresForCompletedHedgedSendOps(
+          retry_state, GRPC_ERROR_REF(error), &closures);
+    } else {
+      call->AddClosuresForCompletedPendingBatch(
+          batch_data, GRPC_ERROR_REF(error), &closures);
+    }
     // If needed, add a callback to start any replay or pending send ops on
     // the subchannel call.
     if (!retry_state->completed_recv_trailing_metadata) {
@@ -4392,8 +4889,9 @@ void ChannelData::RetryingCall::StartBatchInCallCombiner(
 }
 
 void ChannelData::RetryingCall::AddClosureForSubchannelBatch(
+    ChannelData::LoadBalancedCall* lb_call,
     grpc_transport_stream_op_batch* batch, CallCombinerClosureList* closures) {
-  batch->handler_private.extra_arg = lb_call_.get();
+  batch->handler_private.extra_arg = lb_call;
   GRPC_CLOSURE_INIT(&batch->handler_private.closure, StartBatchInCallCombiner,
                     batch, grpc_schedule_on_exec_ctx);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
@@ -4415,12 +4913,13 @@ void ChannelData::RetryingCall::AddRetriableSendInitialMetadataOp(
   // the filters in the subchannel stack may modify this batch, and we don't
   // want those modifications to be passed forward to subsequent attempts.
   //
-  // If we've already completed one or more attempts, add the
+  // If we've already started one or more attempts, add the
   // grpc-retry-attempts header.
+  const int num_previous_attempts = retry_state->num_previous_attempts;
   retry_state->send_initial_metadata_storage =
       static_cast<grpc_linked_mdelem*>(arena_->Alloc(
           sizeof(grpc_linked_mdelem) *
-          (send_initial_metadata_.list.count + (num_attempts_completed_ > 0))));
+          (send_initial_metadata_.list.count + (num_previous_attempts > 0))));
   grpc_metadata_batch_copy(&send_initial_metadata_,
                            &retry_state->send_initial_metadata,
                            retry_state->send_initial_metadata_storage);
@@ -4429,10 +4928,10 @@ void ChannelData::RetryingCall::AddRetriableSendInitialMetadataOp(
     grpc_metadata_batch_remove(&retry_state->send_initial_metadata,
                                GRPC_BATCH_GRPC_PREVIOUS_RPC_ATTEMPTS);
   }
-  if (GPR_UNLIKELY(num_attempts_completed_ > 0)) {
+  if (GPR_UNLIKELY(num_previous_attempts > 0)) {
     grpc_mdelem retry_md = grpc_mdelem_create(
         GRPC_MDSTR_GRPC_PREVIOUS_RPC_ATTEMPTS,
-        *retry_count_strings[num_attempts_completed_ - 1], nullptr);
+        *retry_count_strings[num_previous_attempts - 1], nullptr);
     grpc_error* error = grpc_metadata_batch_add_tail(
         &retry_state->send_initial_metadata,
         &retry_state
@@ -4537,7 +5036,8 @@ void ChannelData::RetryingCall::AddRetriableRecvTrailingMetadataOp(
       &retry_state->recv_trailing_metadata_ready;
 }
 
-void ChannelData::RetryingCall::StartInternalRecvTrailingMetadata() {
+void ChannelData::RetryingCall::StartInternalRecvTrailingMetadata(
+    ChannelData::LoadBalancedCall* lb_call) {
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
     gpr_log(
         GPR_INFO,
@@ -4546,24 +5046,25 @@ void ChannelData::RetryingCall::StartInternalRecvTrailingMetadata() {
         chand_, this);
   }
   SubchannelCallRetryState* retry_state =
-      static_cast<SubchannelCallRetryState*>(lb_call_->GetParentData());
+      static_cast<SubchannelCallRetryState*>(lb_call->GetParentData());
   // Create batch_data with 2 refs, since this batch will be unreffed twice:
   // once for the recv_trailing_metadata_ready callback when the subchannel
   // batch returns, and again when we actually get a recv_trailing_metadata
   // op from the surface.
-  SubchannelCallBatchData* batch_data =
-      SubchannelCallBatchData::Create(this, 2, false /* set_on_complete */);
+  SubchannelCallBatchData* batch_data = SubchannelCallBatchData::Create(
+      this, lb_call, 2, false /* set_on_complete */);
   AddRetriableRecvTrailingMetadataOp(retry_state, batch_data);
   retry_state->recv_trailing_metadata_internal_batch = batch_data;
   // Note: This will release the call combiner.
-  lb_call_->StartTransportStreamOpBatch(&batch_data->batch);
+  lb_call->StartTransportStreamOpBatch(&batch_data->batch);
 }
 
-// If there are any cached send ops that need to be replayed on the
-// current subchannel call, creates and returns a new subchannel batch
-// to replay those ops.  Otherwise, returns nullptr.
+// If there are any cached send ops that need to be replayed on lb_call,
+// creates and returns a new subchannel batch to replay those ops.
+// Otherwise, returns nullptr.
 ChannelData::RetryingCall::SubchannelCallBatchData*
 ChannelData::RetryingCall::MaybeCreateSubchannelBatchForReplay(
+    ChannelData::LoadBalancedCall* lb_call,
     SubchannelCallRetryState* retry_state) {
   SubchannelCallBatchData* replay_batch_data = nullptr;
   // send_initial_metadata.
@@ -4576,8 +5077,8 @@ ChannelData::RetryingCall::MaybeCreateSubchannelBatchForReplay(
               "send_initial_metadata op",
               chand_, this);
     }
-    replay_batch_data =
-        SubchannelCallBatchData::Create(this, 1, true /* set_on_complete */);
+    replay_batch_data = SubchannelCallBatchData::Create(
+        this, lb_call, 1, true /* set_on_complete */);
     AddRetriableSendInitialMetadataOp(retry_state, replay_batch_data);
   }
   // send_message.
@@ -4593,8 +5094,8 @@ ChannelData::RetryingCall::MaybeCreateSubchannelBatchForReplay(
               chand_, this);
     }
     if (replay_batch_data == nullptr) {
-      replay_batch_data =
-          SubchannelCallBatchData::Create(this, 1, true /* set_on_complete */);
+      replay_batch_data = SubchannelCallBatchData::Create(
+          this, lb_call, 1, true /* set_on_complete */);
     }
     AddRetriableSendMessageOp(retry_state, replay_batch_data);
   }
@@ -4613,8 +5114,8 @@ ChannelData::RetryingCall::MaybeCreateSubchannelBatchForReplay(
               chand_, this);
     }
     if (replay_batch_data == nullptr) {
-      replay_batch_data =
-          SubchannelCallBatchData::Create(this, 1, true /* set_on_complete */);
+      replay_batch_data = SubchannelCallBatchData::Create(
+          this, lb_call, 1, true /* set_on_complete */);
     }
     AddRetriableSendTrailingMetadataOp(retry_state, replay_batch_data);
   }
@@ -4622,6 +5123,7 @@ ChannelData::RetryingCall::MaybeCreateSubchannelBatchForReplay(
 }
 
 void ChannelData::RetryingCall::AddSubchannelBatchesForPendingBatches(
+    ChannelData::LoadBalancedCall* lb_call,
     SubchannelCallRetryState* retry_state, CallCombinerClosureList* closures) {
   for (size_t i = 0; i < GPR_ARRAY_SIZE(pending_batches_); ++i) {
     PendingBatch* pending = &pending_batches_[i];
@@ -4690,8 +5192,9 @@ void ChannelData::RetryingCall::AddSubchannelBatchesForPendingBatches(
     // If we're not retrying, just send the batch as-is.
     // TODO(roth): This condition doesn't seem exactly right -- maybe need a
     // notion of "draining" once we've committed and are done replaying?
-    if (retry_policy_ == nullptr || retry_committed_) {
-      AddClosureForSubchannelBatch(batch, closures);
+    if ((retry_policy_ == nullptr && hedging_policy_ == nullptr) ||
+        retry_committed_) {
+      AddClosureForSubchannelBatch(lb_call, batch, closures);
       PendingBatchClear(pending);
       continue;
     }
@@ -4703,7 +5206,7 @@ void ChannelData::RetryingCall::AddSubchannelBatchesForPendingBatches(
                               batch->recv_message +
                               batch->recv_trailing_metadata;
     SubchannelCallBatchData* batch_data = SubchannelCallBatchData::Create(
-        this, num_callbacks, has_send_ops /* set_on_complete */);
+        this, lb_call, num_callbacks, has_send_ops /* set_on_complete */);
     // Cache send ops if needed.
     MaybeCacheSendOpsForBatch(pending);
     // send_initial_metadata.
@@ -4732,7 +5235,7 @@ void ChannelData::RetryingCall::AddSubchannelBatchesForPendingBatches(
     if (batch->recv_trailing_metadata) {
       AddRetriableRecvTrailingMetadataOp(retry_state, batch_data);
     }
-    AddClosureForSubchannelBatch(&batch_data->batch, closures);
+    AddClosureForSubchannelBatch(lb_call, &batch_data->batch, closures);
     // Track number of pending subchannel send batches.
     // If this is the first one, take a ref to the call stack.
     if (batch->send_initial_metadata || batch->send_message ||
@@ -4745,6 +5248,26 @@ void ChannelData::RetryingCall::AddSubchannelBatchesForPendingBatches(
   }
 }
 
+void ChannelData::RetryingCall::AddRetriableSubchannelBatches(
+    ChannelData::LoadBalancedCall* lb_call, CallCombinerClosureList* closures) {
+  SubchannelCallRetryState* retry_state =
+      static_cast<SubchannelCallRetryState*>(lb_call->GetParentData());
+  // Replay previously-returned send_* ops if needed.
+  SubchannelCallBatchData* replay_batch_data =
+      MaybeCreateSubchannelBatchForReplay(lb_call, retry_state);
+  if (replay_batch_data != nullptr) {
+    AddClosureForSubchannelBatch(lb_call, &replay_batch_data->batch, closures);
+    // Track number of pending subchannel send batches.
+    // If this is the first one, take a ref to the call stack.
+    if (num_pending_retriable_subchannel_send_batches_ == 0) {
+      GRPC_CALL_STACK_REF(owning_call_, "subchannel_send_batches");
+    }
+    ++num_pending_retriable_subchannel_send_batches_;
+  }
+  // Now add pending batches.
+  AddSubchannelBatchesForPendingBatches(lb_call, retry_state, closures);
+}
+
 void ChannelData::RetryingCall::StartRetriableSubchannelBatches(
     void* arg, grpc_error* /*ignored*/) {
   RetryingCall* call = static_cast<RetryingCall*>(arg);
@@ -4753,52 +5276,61 @@ void ChannelData::RetryingCall::StartRetriableSubchannelBatches(
             "chand=%p retrying_call=%p: constructing retriable batches",
             call->chand_, call);
   }
-  SubchannelCallRetryState* retry_state =
-      static_cast<SubchannelCallRetryState*>(call->lb_call_->GetParentData());
   // Construct list of closures to execute, one for each pending batch.
   CallCombinerClosureList closures;
-  // Replay previously-returned send_* ops if needed.
-  SubchannelCallBatchData* replay_batch_data =
-      call->MaybeCreateSubchannelBatchForReplay(retry_state);
-  if (replay_batch_data != nullptr) {
-    call->AddClosureForSubchannelBatch(&replay_batch_data->batch, &closures);
-    // Track number of pending subchannel send batches.
-    // If this is the first one, take a ref to the call stack.
-    if (call->num_pending_retriable_subchannel_send_batches_ == 0) {
-      GRPC_CALL_STACK_REF(call->owning_call_, "subchannel_send_batches");
-    }
-    ++call->num_pending_retriable_subchannel_send_batches_;
+  // There may be no attempt in flight if a hedged attempt is waiting for
+  // server push-back.
+  if (call->lb_call_ != nullptr) {
+    call->AddRetriableSubchannelBatches(call->lb_call_.get(), &closures);
+  }
+  for (auto& lb_call : call->hedged_lb_calls_) {
+    call->AddRetriableSubchannelBatches(lb_call.get(), &closures);
   }
-  // Now add pending batches.
-  call->AddSubchannelBatchesForPendingBatches(retry_state, &closures);
   // Start batches on subchannel call.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_call_trace)) {
     gpr_log(GPR_INFO,
             "chand=%p retrying_call=%p: starting %" PRIuPTR
-            " retriable batches on lb_call=%p",
-            call->chand_, call, closures.size(), call->lb_call_.get());
+            " retriable batches on lb_call=%p and %" PRIuPTR
+            " hedged attempts",
+            call->chand_, call, closures.size(), call->lb_call_.get(),
+            call->hedged_lb_calls_.size());
   }
   // Note: This will yield the call combiner.
   closures.RunClosures(call->call_combiner_);
 }
 
-void ChannelData::RetryingCall::CreateLbCall(void* arg, grpc_error* /*error*/) {
-  auto* call = static_cast<RetryingCall*>(arg);
+void ChannelData::RetryingCall::CreateAttempt() {
   const size_t parent_data_size =
-      call->enable_retries_ ? sizeof(SubchannelCallRetryState) : 0;
-  grpc_call_element_args args = {call->owning_call_,     nullptr,
-                                 call->call_context_,    call->path_,
-                                 call->call_start_time_, call->deadline_,
-                                 call->arena_,           call->call_combiner_};
-  call->lb_call_ = ChannelData::LoadBalancedCall::Create(
-      call->chand_, args, call->pollent_, parent_data_size);
+      enable_retries_ ? sizeof(SubchannelCallRetryState) : 0;
+  grpc_call_element_args args = {owning_call_,     nullptr,
+                                 call_context_,    path_,
+                                 call_start_time_, deadline_,
+                                 arena_,           call_combiner_};
+  if (lb_call_ != nullptr) hedged_lb_calls_.push_back(std::move(lb_call_));
+  lb_call_ = ChannelData::LoadBalancedCall::Create(chand_, args, pollent_,
+                                                   parent_data_size);
   if (GRPC_TRACE_FLAG_ENABLED(grpc_client_channel_routing_trace)) {
-    gpr_log(GPR_INFO, "chand=%p retrying_call=%p: create lb_call=%p",
-            call->chand_, call, call->lb_call_.get());
+    gpr_log(GPR_INFO, "chand=%p retrying_call=%p: create lb_call=%p", chand_,
+            this, lb_call_.get());
   }
   if (parent_data_size > 0) {
-    new (call->lb_call_->GetParentData())
-        SubchannelCallRetryState(call->call_context_);
+    auto* retry_state = new (lb_call_->GetParentData())
+        SubchannelCallRetryState(call_context_);
+    retry_state->num_previous_attempts = num_attempts_started_;
+  }
+  ++num_attempts_started_;
+}
+
+void ChannelData::RetryingCall::CreateLbCall(void* arg, grpc_error* /*error*/) {
+  auto* call = static_cast<RetryingCall*>(arg);
+  call->CreateAttempt();
+  if (call->hedging_policy_ != nullptr) {
+    // With no hedging delay, all attempts are sent at once.
+    if (call->hedging_policy_->hedging_delay == 0) {
+      while (call->CanStartHedgedAttempt()) call->CreateAttempt();
+    } else {
+      call->MaybeStartHedgingTimer(call->hedging_policy_->hedging_delay);
+    }
   }
   call->PendingBatchesResume();
 }
@@ -5433,6 +5965,7 @@ bool ChannelData::LoadBalancedCall::PickSubchannelLocked(grpc_error** error) {
       return false;
     default:  // PICK_COMPLETE
       MaybeRemoveCallFromLbQueuedCallsLocked();
+      CallPhaseTrace::Record(call_context_, CallPhase::kLbPicked);
       // Handle drops.
       if (GPR_UNLIKELY(result.subchannel == nullptr)) {
         result.error = grpc_error_set_int(
@@ -58,6 +58,9 @@ class PriorityLbConfig : public LoadBalancingPolicy::Config {
  public:
   struct PriorityLbChild {
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // The JSON that config was parsed from, used to detect unchanged
+    // children across updates.
+    Json config_json;
     bool ignore_reresolution_requests = false;
   };
 
@@ -95,12 +98,14 @@ class PriorityLb : public LoadBalancingPolicy {
     ChildPriority(RefCountedPtr<PriorityLb> priority_policy, std::string name);
 
     ~ChildPriority() override {
+      grpc_channel_args_destroy(last_update_args_);
       priority_policy_.reset(DEBUG_LOCATION, "ChildPriority");
     }
 
     const std::string& name() const { return name_; }
 
     void UpdateLocked(RefCountedPtr<LoadBalancingPolicy::Config> config,
+                      const Json& config_json,
                       bool ignore_reresolution_requests);
     void ExitIdleLocked();
     void ResetBackoffLocked();
@@ -190,6 +195,13 @@ class PriorityLb : public LoadBalancingPolicy {
 
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
 
+    // The inputs of the last update passed to child_policy_.  An update
+    // with identical inputs is not passed down, so that the child keeps
+    // its subchannels and picker when only other priorities changed.
+    Json last_update_config_json_;
+    ServerAddressList last_update_addresses_;
+    grpc_channel_args* last_update_args_ = nullptr;
+
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_CONNECTING;
     absl::Status connectivity_status_;
     RefCountedPtr<RefCountedPicker> picker_wrapper_;
@@ -315,6 +327,7 @@ void PriorityLb::UpdateLocked(UpdateArgs args) {
     } else {
       // Existing child found in new config.  Update it.
       child->UpdateLocked(config_it->second.config,
+                          config_it->second.config_json,
                           config_it->second.ignore_reresolution_requests);
     }
   }
@@ -435,6 +448,7 @@ void PriorityLb::TryNextPriorityLocked(bool report_connecting) {
       auto child_config = config_->children().find(child_name);
       GPR_DEBUG_ASSERT(child_config != config_->children().end());
       child->UpdateLocked(child_config->second.config,
+                          child_config->second.config_json,
                           child_config->second.ignore_reresolution_requests);
       return;
     }
@@ -543,7 +557,7 @@ void PriorityLb::ChildPriority::Orphan() {
 }
 
 void PriorityLb::ChildPriority::UpdateLocked(
-    RefCountedPtr<LoadBalancingPolicy::Config> config,
+    RefCountedPtr<LoadBalancingPolicy::Config> config, const Json& config_json,
     bool ignore_reresolution_requests) {
   if (priority_policy_->shutting_down_) return;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
@@ -551,6 +565,24 @@ void PriorityLb::ChildPriority::UpdateLocked(
             priority_policy_.get(), name_.c_str(), this);
   }
   ignore_reresolution_requests_ = ignore_reresolution_requests;
+  const ServerAddressList& addresses = priority_policy_->addresses_[name_];
+  // If nothing the child policy would see has changed, skip the update, so
+  // that it does not rebuild its subchannel lists and picker.
+  if (child_policy_ != nullptr && config_json == last_update_config_json_ &&
+      addresses == last_update_addresses_ &&
+      grpc_channel_args_compare(priority_policy_->args_, last_update_args_) ==
+          0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
+      gpr_log(GPR_INFO,
+              "[priority_lb %p] child %s (%p): update unchanged, skipping",
+              priority_policy_.get(), name_.c_str(), this);
+    }
+    return;
+  }
+  last_update_config_json_ = config_json;
+  last_update_addresses_ = addresses;
+  grpc_channel_args_destroy(last_update_args_);
+  last_update_args_ = grpc_channel_args_copy(priority_policy_->args_);
   // Create policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(priority_policy_->args_);
@@ -558,7 +590,7 @@ void PriorityLb::ChildPriority::UpdateLocked(
   // Construct update args.
   UpdateArgs update_args;
   update_args.config = std::move(config);
-  update_args.addresses = priority_policy_->addresses_[name_];
+  update_args.addresses = addresses;
   update_args.args = grpc_channel_args_copy(priority_policy_->args_);
   // Update the policy.
   if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_priority_trace)) {
@@ -852,6 +884,7 @@ class PriorityLbFactory : public LoadBalancingPolicyFactory {
               GRPC_ERROR_UNREF(parse_error);
             }
             children[child_name].config = std::move(config);
+            children[child_name].config_json = it2->second;
             children[child_name].ignore_reresolution_requests =
                 ignore_resolution_requests;
           }
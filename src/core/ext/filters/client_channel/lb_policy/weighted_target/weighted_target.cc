@@ -56,6 +56,9 @@ class WeightedTargetLbConfig : public LoadBalancingPolicy::Config {
   struct ChildConfig {
     uint32_t weight;
     RefCountedPtr<LoadBalancingPolicy::Config> config;
+    // The JSON that config was parsed from, used to detect unchanged
+    // children across updates.
+    Json config_json;
   };
 
   using TargetMap = std::map<std::string, ChildConfig>;
@@ -177,6 +180,13 @@ class WeightedTargetLb : public LoadBalancingPolicy {
 
     OrphanablePtr<LoadBalancingPolicy> child_policy_;
 
+    // The inputs of the last update passed to child_policy_.  An update
+    // with identical inputs is not passed down, so that the child keeps
+    // its subchannels and picker when only other targets or weights changed.
+    Json last_update_config_json_;
+    ServerAddressList last_update_addresses_;
+    grpc_channel_args* last_update_args_ = nullptr;
+
     RefCountedPtr<ChildPickerWrapper> picker_wrapper_;
     grpc_connectivity_state connectivity_state_ = GRPC_CHANNEL_CONNECTING;
     bool seen_failure_since_ready_ = false;
@@ -420,6 +430,7 @@ WeightedTargetLb::WeightedChild::~WeightedChild() {
             "[weighted_target_lb %p] WeightedChild %p %s: destroying child",
             weighted_target_policy_.get(), this, name_.c_str());
   }
+  grpc_channel_args_destroy(last_update_args_);
   weighted_target_policy_.reset(DEBUG_LOCATION, "WeightedChild");
 }
 
@@ -489,6 +500,25 @@ void WeightedTargetLb::WeightedChild::UpdateLocked(
     delayed_removal_timer_callback_pending_ = false;
     grpc_timer_cancel(&delayed_removal_timer_);
   }
+  // If nothing the child policy would see has changed, skip the update, so
+  // that it does not rebuild its subchannel lists and picker.  A weight
+  // change only affects our own picker, which the caller rebuilds.
+  if (child_policy_ != nullptr &&
+      config.config_json == last_update_config_json_ &&
+      addresses == last_update_addresses_ &&
+      grpc_channel_args_compare(args, last_update_args_) == 0) {
+    if (GRPC_TRACE_FLAG_ENABLED(grpc_lb_weighted_target_trace)) {
+      gpr_log(GPR_INFO,
+              "[weighted_target_lb %p] WeightedChild %p %s: update unchanged, "
+              "skipping",
+              weighted_target_policy_.get(), this, name_.c_str());
+    }
+    return;
+  }
+  last_update_config_json_ = config.config_json;
+  last_update_addresses_ = addresses;
+  grpc_channel_args_destroy(last_update_args_);
+  last_update_args_ = grpc_channel_args_copy(args);
   // Create child policy if needed.
   if (child_policy_ == nullptr) {
     child_policy_ = CreateChildPolicyLocked(args);
@@ -715,6 +745,7 @@ class WeightedTargetLbFactory : public LoadBalancingPolicyFactory {
       child_config->config =
           LoadBalancingPolicyRegistry::ParseLoadBalancingConfig(it->second,
                                                                 &parse_error);
+      child_config->config_json = it->second;
       if (child_config->config == nullptr) {
         GPR_DEBUG_ASSERT(parse_error != GRPC_ERROR_NONE);
         std::vector<grpc_error*> child_errors;
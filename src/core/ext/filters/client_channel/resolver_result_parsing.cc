@@ -43,6 +43,8 @@
 
 // As per the retry design, we do not allow more than 5 retry attempts.
 #define MAX_MAX_RETRY_ATTEMPTS 5
+// The same limit applies to hedged attempts.
+#define MAX_MAX_HEDGED_ATTEMPTS 5
 
 namespace grpc_core {
 namespace internal {
@@ -170,6 +172,73 @@ std::unique_ptr<ClientChannelMethodParsedConfig::RetryPolicy> ParseRetryPolicy(
   return *error == GRPC_ERROR_NONE ? std::move(retry_policy) : nullptr;
 }
 
+std::unique_ptr<ClientChannelMethodParsedConfig::HedgingPolicy>
+ParseHedgingPolicy(const Json& json, grpc_error** error) {
+  GPR_DEBUG_ASSERT(error != nullptr && *error == GRPC_ERROR_NONE);
+  auto hedging_policy =
+      absl::make_unique<ClientChannelMethodParsedConfig::HedgingPolicy>();
+  if (json.type() != Json::Type::OBJECT) {
+    *error = GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "field:hedgingPolicy error:should be of type object");
+    return nullptr;
+  }
+  std::vector<grpc_error*> error_list;
+  // Parse maxAttempts.
+  auto it = json.object_value().find("maxAttempts");
+  if (it == json.object_value().end()) {
+    error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "field:maxAttempts error:Not found"));
+  } else if (it->second.type() != Json::Type::NUMBER) {
+    error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+        "field:maxAttempts error:should be of type number"));
+  } else {
+    hedging_policy->max_attempts =
+        gpr_parse_nonnegative_int(it->second.string_value().c_str());
+    if (hedging_policy->max_attempts <= 1) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:maxAttempts error:should be at least 2"));
+    } else if (hedging_policy->max_attempts > MAX_MAX_HEDGED_ATTEMPTS) {
+      gpr_log(GPR_ERROR,
+              "service config: clamped hedgingPolicy.maxAttempts at %d",
+              MAX_MAX_HEDGED_ATTEMPTS);
+      hedging_policy->max_attempts = MAX_MAX_HEDGED_ATTEMPTS;
+    }
+  }
+  // Parse hedgingDelay.  This is optional and defaults to 0, which means
+  // that all attempts are sent without waiting.
+  ParseJsonObjectFieldAsDuration(json.object_value(), "hedgingDelay",
+                                 &hedging_policy->hedging_delay, &error_list,
+                                 false);
+  // Parse nonFatalStatusCodes.  This is optional; if unset, any non-OK
+  // status is fatal.
+  it = json.object_value().find("nonFatalStatusCodes");
+  if (it != json.object_value().end()) {
+    if (it->second.type() != Json::Type::ARRAY) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:nonFatalStatusCodes error:should be of type array"));
+    } else {
+      for (const Json& element : it->second.array_value()) {
+        if (element.type() != Json::Type::STRING) {
+          error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "field:nonFatalStatusCodes error:status codes should be of type "
+              "string"));
+          continue;
+        }
+        grpc_status_code status;
+        if (!grpc_status_code_from_string(element.string_value().c_str(),
+                                          &status)) {
+          error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "field:nonFatalStatusCodes error:failed to parse status code"));
+          continue;
+        }
+        hedging_policy->non_fatal_status_codes.Add(status);
+      }
+    }
+  }
+  *error = GRPC_ERROR_CREATE_FROM_VECTOR("hedgingPolicy", &error_list);
+  return *error == GRPC_ERROR_NONE ? std::move(hedging_policy) : nullptr;
+}
+
 grpc_error* ParseRetryThrottling(
     const Json& json,
     ClientChannelGlobalParsedConfig::RetryThrottling* retry_throttling) {
@@ -361,6 +430,8 @@ ClientChannelServiceConfigParser::ParsePerMethodParams(
   absl::optional<bool> wait_for_ready;
   grpc_millis timeout = 0;
   std::unique_ptr<ClientChannelMethodParsedConfig::RetryPolicy> retry_policy;
+  std::unique_ptr<ClientChannelMethodParsedConfig::HedgingPolicy>
+      hedging_policy;
   // Parse waitForReady.
   auto it = json.object_value().find("waitForReady");
   if (it != json.object_value().end()) {
@@ -385,10 +456,26 @@ ClientChannelServiceConfigParser::ParsePerMethodParams(
       error_list.push_back(error);
     }
   }
+  // Parse hedging policy.
+  it = json.object_value().find("hedgingPolicy");
+  if (it != json.object_value().end()) {
+    if (json.object_value().find("retryPolicy") != json.object_value().end()) {
+      error_list.push_back(GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+          "field:hedgingPolicy error:retryPolicy and hedgingPolicy are "
+          "mutually exclusive"));
+    } else {
+      grpc_error* error = GRPC_ERROR_NONE;
+      hedging_policy = ParseHedgingPolicy(it->second, &error);
+      if (hedging_policy == nullptr) {
+        error_list.push_back(error);
+      }
+    }
+  }
   *error = GRPC_ERROR_CREATE_FROM_VECTOR("Client channel parser", &error_list);
   if (*error == GRPC_ERROR_NONE) {
     return absl::make_unique<ClientChannelMethodParsedConfig>(
-        timeout, wait_for_ready, std::move(retry_policy));
+        timeout, wait_for_ready, std::move(retry_policy),
+        std::move(hedging_policy));
   }
   return nullptr;
 }
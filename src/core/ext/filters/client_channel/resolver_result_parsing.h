@@ -89,12 +89,20 @@ class ClientChannelMethodParsedConfig
     StatusCodeSet retryable_status_codes;
   };
 
+  struct HedgingPolicy {
+    int max_attempts = 0;
+    grpc_millis hedging_delay = 0;
+    StatusCodeSet non_fatal_status_codes;
+  };
+
   ClientChannelMethodParsedConfig(grpc_millis timeout,
                                   const absl::optional<bool>& wait_for_ready,
-                                  std::unique_ptr<RetryPolicy> retry_policy)
+                                  std::unique_ptr<RetryPolicy> retry_policy,
+                                  std::unique_ptr<HedgingPolicy> hedging_policy)
       : timeout_(timeout),
         wait_for_ready_(wait_for_ready),
-        retry_policy_(std::move(retry_policy)) {}
+        retry_policy_(std::move(retry_policy)),
+        hedging_policy_(std::move(hedging_policy)) {}
 
   grpc_millis timeout() const { return timeout_; }
 
@@ -102,10 +110,13 @@ class ClientChannelMethodParsedConfig
 
   const RetryPolicy* retry_policy() const { return retry_policy_.get(); }
 
+  const HedgingPolicy* hedging_policy() const { return hedging_policy_.get(); }
+
  private:
   grpc_millis timeout_ = 0;
   absl::optional<bool> wait_for_ready_;
   std::unique_ptr<RetryPolicy> retry_policy_;
+  std::unique_ptr<HedgingPolicy> hedging_policy_;
 };
 
 class ClientChannelServiceConfigParser : public ServiceConfigParser::Parser {
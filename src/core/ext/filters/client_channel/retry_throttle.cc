@@ -114,6 +114,15 @@ void ServerRetryThrottleData::RecordSuccess() {
       static_cast<gpr_atm>(throttle_data->max_milli_tokens_));
 }
 
+bool ServerRetryThrottleData::IsThrottled() {
+  // First, check if we are stale and need to be replaced.
+  ServerRetryThrottleData* throttle_data = this;
+  GetReplacementThrottleDataIfNeeded(&throttle_data);
+  const intptr_t milli_tokens = static_cast<intptr_t>(
+      gpr_atm_no_barrier_load(&throttle_data->milli_tokens_));
+  return milli_tokens <= throttle_data->max_milli_tokens_ / 2;
+}
+
 //
 // avl vtable for string -> server_retry_throttle_data map
 //
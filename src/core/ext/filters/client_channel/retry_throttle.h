@@ -42,6 +42,11 @@ class ServerRetryThrottleData : public RefCounted<ServerRetryThrottleData> {
   /// Records a success.
   void RecordSuccess();
 
+  /// Returns true if retries are currently being throttled.  Unlike
+  /// RecordFailure(), this does not modify the token count.  Used to
+  /// decide whether to send a hedged attempt.
+  bool IsThrottled();
+
   intptr_t max_milli_tokens() const { return max_milli_tokens_; }
   intptr_t milli_token_ratio() const { return milli_token_ratio_; }
 
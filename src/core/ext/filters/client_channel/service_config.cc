@@ -21,6 +21,7 @@
 #include <string>
 
 #include "absl/strings/str_cat.h"
+#include "absl/strings/string_view.h"
 
 #include <grpc/support/log.h>
 
@@ -107,7 +108,10 @@ grpc_error* ServiceConfig::ParseJsonMethodConfig(const grpc_channel_args* args,
           }
           default_method_config_vector_ = vector_ptr;
         } else {
-          grpc_slice key = grpc_slice_from_copied_string(path.c_str());
+          // Intern the key, so that lookups using interned paths (e.g.,
+          // those of registered methods) need only a pointer comparison.
+          grpc_slice key = grpc_slice_intern(
+              grpc_slice_from_static_buffer(path.data(), path.size()));
           // If the key is not already present in the map, this will
           // store a ref to the key in the map.
           auto& value = parsed_method_configs_map_[key];
@@ -119,6 +123,7 @@ grpc_error* ServiceConfig::ParseJsonMethodConfig(const grpc_channel_args* args,
             grpc_slice_unref_internal(key);
           } else {
             value = vector_ptr;
+            if (path.back() == '/') has_wildcard_method_configs_ = true;
           }
         }
       }
@@ -211,14 +216,18 @@ ServiceConfig::GetMethodParsedConfigVector(const grpc_slice& path) const {
   auto it = parsed_method_configs_map_.find(path);
   if (it != parsed_method_configs_map_.end()) return it->second;
   // If we didn't find a match for the path, try looking for a wildcard
-  // entry (i.e., change "/service/method" to "/service/").
-  UniquePtr<char> path_str(grpc_slice_to_c_string(path));
-  char* sep = strrchr(path_str.get(), '/');
-  if (sep == nullptr) return nullptr;  // Shouldn't ever happen.
-  sep[1] = '\0';
-  grpc_slice wildcard_path = grpc_slice_from_static_string(path_str.get());
-  it = parsed_method_configs_map_.find(wildcard_path);
-  if (it != parsed_method_configs_map_.end()) return it->second;
+  // entry (i.e., change "/service/method" to "/service/").  The wildcard
+  // key is a view into the path itself, so no allocation is needed.
+  if (has_wildcard_method_configs_) {
+    const char* path_start =
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(path));
+    size_t sep = absl::string_view(path_start, GRPC_SLICE_LENGTH(path))
+                     .find_last_of('/');
+    if (sep == absl::string_view::npos) return nullptr;  // Shouldn't happen.
+    it = parsed_method_configs_map_.find(
+        grpc_slice_from_static_buffer(path_start, sep + 1));
+    if (it != parsed_method_configs_map_.end()) return it->second;
+  }
   // Try default method config, if set.
   return default_method_config_vector_;
 }
@@ -111,6 +111,10 @@ class ServiceConfig : public RefCounted<ServiceConfig> {
   std::unordered_map<grpc_slice, const ServiceConfigParser::ParsedConfigVector*,
                      SliceHash>
       parsed_method_configs_map_;
+  // Whether parsed_method_configs_map_ contains any wildcard entries (i.e.,
+  // "/service/" with no method name).  If not, lookups can skip the
+  // second probe on a miss.
+  bool has_wildcard_method_configs_ = false;
   // Default method config.
   const ServiceConfigParser::ParsedConfigVector* default_method_config_vector_ =
       nullptr;
@@ -47,9 +47,11 @@ namespace {
 class ChannelData {
  public:
   explicit ChannelData(grpc_channel_element_args* args) {
-    // Get the enabled and the default algorithms from channel args.
+    // Get the enabled and the default algorithms from channel args. The
+    // algorithms that this build cannot compress with are never enabled.
     enabled_compression_algorithms_bitset_ =
-        grpc_channel_args_compression_algorithm_get_states(args->channel_args);
+        grpc_channel_args_compression_algorithm_get_states(args->channel_args) &
+        grpc_compression_supported_algorithms_bitset();
     default_compression_algorithm_ =
         grpc_channel_args_get_channel_default_compression_algorithm(
             args->channel_args);
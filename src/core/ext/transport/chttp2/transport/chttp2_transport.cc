@@ -335,6 +335,12 @@ static bool read_channel_args(grpc_chttp2_transport* t,
                strcmp(channel_args->args[i].key, GRPC_ARG_ENABLE_CHANNELZ)) {
       channelz_enabled = grpc_channel_arg_get_bool(
           &channel_args->args[i], GRPC_ENABLE_CHANNELZ_DEFAULT);
+    } else if (0 == strcmp(channel_args->args[i].key,
+                           GRPC_ARG_TCP_TRACING_ENABLED)) {
+      if (grpc_channel_arg_get_bool(&channel_args->args[i], false)) {
+        t->network_latency =
+            grpc_core::MakeRefCounted<grpc_core::ConnectionNetworkLatency>();
+      }
     } else {
       static const struct {
         const char* channel_arg_name;
@@ -391,7 +397,8 @@ static bool read_channel_args(grpc_chttp2_transport* t,
             std::string(grpc_endpoint_get_local_address(t->ep)), t->peer_string,
             absl::StrFormat("%s %s", get_vtable()->name, t->peer_string),
             grpc_core::channelz::SocketNode::Security::GetFromChannelArgs(
-                channel_args));
+                channel_args),
+            t->network_latency);
   }
   return enable_bdp;
 }
@@ -1375,7 +1382,9 @@ static void perform_stream_op_locked(void* stream_op,
   GRPC_STATS_INC_HTTP2_OP_BATCHES();
 
   s->context = op->payload->context;
-  s->traced = op->is_traced;
+  s->network_latency = grpc_core::CallNetworkLatency::FromContext(
+      static_cast<grpc_call_context_element*>(s->context));
+  s->traced = op->is_traced || s->network_latency != nullptr;
   if (GRPC_TRACE_FLAG_ENABLED(grpc_http_trace)) {
     gpr_log(GPR_INFO, "perform_stream_op_locked: %s; on_complete = %p",
             grpc_transport_stream_op_batch_string(op).c_str(), op->on_complete);
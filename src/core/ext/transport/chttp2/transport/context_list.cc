@@ -28,13 +28,21 @@ void* (*get_copied_context_fn_g)(void*) = nullptr;
 
 namespace grpc_core {
 void ContextList::Append(ContextList** head, grpc_chttp2_stream* s) {
-  if (get_copied_context_fn_g == nullptr ||
-      write_timestamps_callback_g == nullptr) {
+  const bool has_callback = get_copied_context_fn_g != nullptr &&
+                            write_timestamps_callback_g != nullptr;
+  if (!has_callback && s->network_latency == nullptr) {
     return;
   }
   /* Create a new element in the list and add it at the front */
   ContextList* elem = new ContextList();
-  elem->trace_context_ = get_copied_context_fn_g(s->context);
+  if (has_callback) {
+    elem->has_trace_context_ = true;
+    elem->trace_context_ = get_copied_context_fn_g(s->context);
+  }
+  if (s->network_latency != nullptr) {
+    elem->network_latency_ = s->network_latency->Ref();
+    elem->connection_network_latency_ = s->t->network_latency;
+  }
   elem->byte_offset_ = s->byte_counter;
   elem->next_ = *head;
   *head = elem;
@@ -45,12 +53,18 @@ void ContextList::Execute(void* arg, grpc_core::Timestamps* ts,
   ContextList* head = static_cast<ContextList*>(arg);
   ContextList* to_be_freed;
   while (head != nullptr) {
-    if (write_timestamps_callback_g) {
+    if (write_timestamps_callback_g && head->has_trace_context_) {
       if (ts) {
         ts->byte_offset = static_cast<uint32_t>(head->byte_offset_);
       }
       write_timestamps_callback_g(head->trace_context_, ts, error);
     }
+    /* Timestamps are incomplete when the write was not acked. */
+    if (head->network_latency_ != nullptr && ts != nullptr &&
+        error == GRPC_ERROR_NONE) {
+      head->network_latency_->RecordWrite(
+          *ts, head->connection_network_latency_.get());
+    }
     to_be_freed = head;
     head = head->next_;
     delete to_be_freed;
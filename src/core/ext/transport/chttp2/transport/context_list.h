@@ -30,16 +30,21 @@ namespace grpc_core {
 class ContextList {
  public:
   /* Creates a new element with \a context as the value and appends it to the
-   * list. */
+   * list. If the stream's call is sampled for network latency, the element
+   * also holds a ref to its CallNetworkLatency. */
   static void Append(ContextList** head, grpc_chttp2_stream* s);
 
-  /* Executes a function \a fn with each context in the list and \a ts. It also
-   * frees up the entire list after this operation. It is intended as a callback
-   * and hence does not take a ref on \a error */
+  /* Executes a function \a fn with each context in the list and \a ts, and
+   * records \a ts into the network latency of the elements that have one. It
+   * also frees up the entire list after this operation. It is intended as a
+   * callback and hence does not take a ref on \a error */
   static void Execute(void* arg, grpc_core::Timestamps* ts, grpc_error* error);
 
  private:
+  bool has_trace_context_ = false;
   void* trace_context_ = nullptr;
+  RefCountedPtr<CallNetworkLatency> network_latency_;
+  RefCountedPtr<ConnectionNetworkLatency> connection_network_latency_;
   ContextList* next_ = nullptr;
   size_t byte_offset_ = 0;
 };
@@ -38,6 +38,7 @@
 #include "src/core/ext/transport/chttp2/transport/stream_map.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/compression/stream_compression.h"
+#include "src/core/lib/debug/network_latency.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
 #include "src/core/lib/iomgr/combiner.h"
 #include "src/core/lib/iomgr/endpoint.h"
@@ -489,6 +490,9 @@ struct grpc_chttp2_transport {
   grpc_chttp2_keepalive_state keepalive_state;
   grpc_core::ContextList* cl = nullptr;
   grpc_core::RefCountedPtr<grpc_core::channelz::SocketNode> channelz_socket;
+  /** Network latency of the traced writes on this connection, if
+   * GRPC_ARG_TCP_TRACING_ENABLED is set */
+  grpc_core::RefCountedPtr<grpc_core::ConnectionNetworkLatency> network_latency;
   uint32_t num_messages_in_next_write = 0;
   /** The number of pending induced frames (SETTINGS_ACK, PINGS_ACK and
    * RST_STREAM) in the outgoing buffer (t->qbuf). If this number goes beyond
@@ -511,7 +515,7 @@ struct grpc_chttp2_stream {
                      const void* server_data, grpc_core::Arena* arena);
   ~grpc_chttp2_stream();
 
-  void* context;
+  void* context = nullptr;
   grpc_chttp2_transport* t;
   grpc_stream_refcount* refcount;
   // Reffer is a 0-len structure, simply reffing `t` and `refcount` in its ctor
@@ -647,6 +651,9 @@ struct grpc_chttp2_stream {
   /** Whether bytes stored in unprocessed_incoming_byte_stream is decompressed
    */
   bool unprocessed_incoming_frames_decompressed = false;
+  /** The network latency of the stream's call, if it is sampled; owned by the
+   * call context */
+  grpc_core::CallNetworkLatency* network_latency = nullptr;
   /** Whether the bytes needs to be traced using Fathom */
   bool traced = false;
   /** gRPC header bytes that are already decompressed */
@@ -28,6 +28,7 @@
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 
+#include "src/core/lib/debug/call_phase_tracer.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_string_helpers.h"
 #include "src/core/lib/slice/slice_utils.h"
@@ -633,6 +634,9 @@ static grpc_error* init_header_frame_parser(grpc_chttp2_transport* t,
     }
   } else {
     t->incoming_stream = s;
+    grpc_core::CallPhaseTrace::Record(
+        static_cast<grpc_call_context_element*>(s->context),
+        grpc_core::CallPhase::kFirstByteReceived);
   }
   GPR_DEBUG_ASSERT(s != nullptr);
   s->stats.incoming.framing_bytes += 9;
@@ -27,6 +27,7 @@
 #include <grpc/support/log.h>
 
 #include "src/core/lib/compression/stream_compression.h"
+#include "src/core/lib/debug/call_phase_tracer.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/profiling/timers.h"
 #include "src/core/lib/slice/slice_internal.h"
@@ -467,6 +468,9 @@ class StreamWriteContext {
                                 s_->send_initial_metadata, &hopt, &t_->outbuf);
       grpc_chttp2_reset_ping_clock(t_);
       write_context_->IncInitialMetadataWrites();
+      grpc_core::CallPhaseTrace::Record(
+          static_cast<grpc_call_context_element*>(s_->context),
+          grpc_core::CallPhase::kTransportWriteStarted);
     }
 
     s_->send_initial_metadata = nullptr;
@@ -688,6 +692,9 @@ void grpc_chttp2_end_write(grpc_chttp2_transport* t, grpc_error* error) {
   t->num_messages_in_next_write = 0;
 
   while (grpc_chttp2_list_pop_writing_stream(t, &s)) {
+    grpc_core::CallPhaseTrace::Record(
+        static_cast<grpc_call_context_element*>(s->context),
+        grpc_core::CallPhase::kTransportFlushed);
     if (s->sending_bytes != 0) {
       update_list(t, s, static_cast<int64_t>(s->sending_bytes),
                   &s->on_write_finished_cbs, &s->flow_controlled_bytes_written,
@@ -23,6 +23,8 @@
 #include "src/core/lib/iomgr/sockaddr_utils.h"
 
 #include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_format.h"
 #include "absl/strings/strip.h"
 
 #include <grpc/grpc.h>
@@ -76,12 +78,21 @@ std::string BaseNode::RenderJsonString() {
 
 CallCountingHelper::CallCountingHelper() {
   num_cores_ = GPR_MAX(1, gpr_cpu_num_cores());
-  per_cpu_counter_data_storage_.reserve(num_cores_);
+  per_cpu_counter_data_storage_ =
+      static_cast<AtomicCounterData*>(gpr_malloc_aligned(
+          num_cores_ * sizeof(AtomicCounterData), GPR_CACHELINE_SIZE));
   for (size_t i = 0; i < num_cores_; ++i) {
-    per_cpu_counter_data_storage_.emplace_back();
+    new (&per_cpu_counter_data_storage_[i]) AtomicCounterData();
   }
 }
 
+CallCountingHelper::~CallCountingHelper() {
+  for (size_t i = 0; i < num_cores_; ++i) {
+    per_cpu_counter_data_storage_[i].~AtomicCounterData();
+  }
+  gpr_free_aligned(per_cpu_counter_data_storage_);
+}
+
 void CallCountingHelper::RecordCallStarted() {
   AtomicCounterData& data =
       per_cpu_counter_data_storage_[ExecCtx::Get()->starting_cpu()];
@@ -459,11 +470,13 @@ void PopulateSocketAddressJson(Json::Object* json, const char* name,
 }  // namespace
 
 SocketNode::SocketNode(std::string local, std::string remote, std::string name,
-                       RefCountedPtr<Security> security)
+                       RefCountedPtr<Security> security,
+                       RefCountedPtr<ConnectionNetworkLatency> network_latency)
     : BaseNode(EntityType::kSocket, std::move(name)),
       local_(std::move(local)),
       remote_(std::move(remote)),
-      security_(std::move(security)) {}
+      security_(std::move(security)),
+      network_latency_(std::move(network_latency)) {}
 
 void SocketNode::RecordStreamStartedFromLocal() {
   streams_started_.FetchAdd(1, MemoryOrder::RELAXED);
@@ -542,6 +555,25 @@ Json SocketNode::RenderJson() {
   if (keepalives_sent != 0) {
     data["keepAlivesSent"] = std::to_string(keepalives_sent);
   }
+  if (network_latency_ != nullptr) {
+    Json::Array options;
+    network_latency_->ForEachStage(
+        [&options](NetworkLatencyStage stage,
+                   const CallPhaseTracer::Histogram& histogram) {
+          options.push_back(Json::Object{
+              {"name", absl::StrCat("grpc.network_latency.",
+                                    NetworkLatencyStageName(stage))},
+              {"value",
+               absl::StrFormat("count=%d p50_us=%d p90_us=%d p99_us=%d "
+                               "max_us=%d",
+                               histogram.count(), histogram.Quantile(0.5),
+                               histogram.Quantile(0.9),
+                               histogram.Quantile(0.99),
+                               histogram.Quantile(1))},
+          });
+        });
+    if (!options.empty()) data["option"] = std::move(options);
+  }
   // Create and fill the parent object.
   Json::Object object = {
       {"ref",
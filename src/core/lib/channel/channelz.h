@@ -30,6 +30,7 @@
 #include "absl/types/optional.h"
 
 #include "src/core/lib/channel/channel_trace.h"
+#include "src/core/lib/debug/network_latency.h"
 #include "src/core/lib/gpr/time_precise.h"
 #include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -117,6 +118,10 @@ class BaseNode : public RefCounted<BaseNode> {
 class CallCountingHelper {
  public:
   CallCountingHelper();
+  ~CallCountingHelper();
+
+  CallCountingHelper(const CallCountingHelper&) = delete;
+  CallCountingHelper& operator=(const CallCountingHelper&) = delete;
 
   void RecordCallStarted();
   void RecordCallFailed();
@@ -131,29 +136,14 @@ class CallCountingHelper {
 
   // TODO(soheil): add a proper PerCPU helper and use it here.
   struct AtomicCounterData {
-    // Define the ctors so that we can use this structure in InlinedVector.
-    AtomicCounterData() = default;
-    AtomicCounterData(const AtomicCounterData& that)
-        : calls_started(that.calls_started.Load(MemoryOrder::RELAXED)),
-          calls_succeeded(that.calls_succeeded.Load(MemoryOrder::RELAXED)),
-          calls_failed(that.calls_failed.Load(MemoryOrder::RELAXED)),
-          last_call_started_cycle(
-              that.last_call_started_cycle.Load(MemoryOrder::RELAXED)) {}
-
     Atomic<int64_t> calls_started{0};
     Atomic<int64_t> calls_succeeded{0};
     Atomic<int64_t> calls_failed{0};
     Atomic<gpr_cycle_counter> last_call_started_cycle{0};
     // Make sure the size is exactly one cache line.
-    uint8_t padding[GPR_CACHELINE_SIZE - 3 * sizeof(Atomic<intptr_t>) -
+    uint8_t padding[GPR_CACHELINE_SIZE - 3 * sizeof(Atomic<int64_t>) -
                     sizeof(Atomic<gpr_cycle_counter>)];
   };
-  // TODO(soheilhy,veblush): Revist this after abseil integration.
-  // This has a problem when using abseil inlined_vector because it
-  // carries an alignment attribute properly but our allocator doesn't
-  // respect this. To avoid UBSAN errors, this should be removed with
-  // abseil inlined_vector.
-  // GPR_ALIGN_STRUCT(GPR_CACHELINE_SIZE);
 
   struct CounterData {
     int64_t calls_started = 0;
@@ -165,8 +155,9 @@ class CallCountingHelper {
   // collects the sharded data into one CounterData struct.
   void CollectData(CounterData* out);
 
-  // Really zero-sized, but 0-sized arrays are illegal on MSVC.
-  absl::InlinedVector<AtomicCounterData, 1> per_cpu_counter_data_storage_;
+  // One cell per CPU. The cells are allocated cache line aligned, so that
+  // CPUs never write to the same cache line.
+  AtomicCounterData* per_cpu_counter_data_storage_ = nullptr;
   size_t num_cores_ = 0;
 };
 
@@ -298,8 +289,11 @@ class SocketNode : public BaseNode {
         const grpc_channel_args* args);
   };
 
+  // If \a network_latency is not null, its histograms are rendered as socket
+  // options named "grpc.network_latency.<stage>".
   SocketNode(std::string local, std::string remote, std::string name,
-             RefCountedPtr<Security> security);
+             RefCountedPtr<Security> security,
+             RefCountedPtr<ConnectionNetworkLatency> network_latency = nullptr);
   ~SocketNode() override {}
 
   Json RenderJson() override;
@@ -334,6 +328,7 @@ class SocketNode : public BaseNode {
   std::string local_;
   std::string remote_;
   RefCountedPtr<Security> const security_;
+  RefCountedPtr<ConnectionNetworkLatency> const network_latency_;
 };
 
 // Handles channelz bookkeeping for listen sockets
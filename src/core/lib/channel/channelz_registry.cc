@@ -20,6 +20,7 @@
 
 #include <algorithm>
 #include <cstring>
+#include <vector>
 
 #include "absl/container/inlined_vector.h"
 
@@ -42,7 +43,7 @@ namespace {
 // singleton instance of the registry.
 ChannelzRegistry* g_channelz_registry = nullptr;
 
-const int kPaginationLimit = 100;
+const size_t kPaginationLimit = 100;
 
 }  // anonymous namespace
 
@@ -56,25 +57,28 @@ ChannelzRegistry* ChannelzRegistry::Default() {
 }
 
 void ChannelzRegistry::InternalRegister(BaseNode* node) {
-  MutexLock lock(&mu_);
-  node->uuid_ = ++uuid_generator_;
-  node_map_[node->uuid_] = node;
+  node->uuid_ = uuid_generator_.FetchAdd(1, MemoryOrder::RELAXED) + 1;
+  Shard& shard = ShardFor(node->uuid_);
+  MutexLock lock(&shard.mu);
+  shard.node_map[node->uuid_] = node;
 }
 
 void ChannelzRegistry::InternalUnregister(intptr_t uuid) {
   GPR_ASSERT(uuid >= 1);
-  MutexLock lock(&mu_);
-  GPR_ASSERT(uuid <= uuid_generator_);
-  node_map_.erase(uuid);
+  GPR_ASSERT(uuid <= uuid_generator_.Load(MemoryOrder::RELAXED));
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  shard.node_map.erase(uuid);
 }
 
 RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
-  MutexLock lock(&mu_);
-  if (uuid < 1 || uuid > uuid_generator_) {
+  if (uuid < 1 || uuid > uuid_generator_.Load(MemoryOrder::RELAXED)) {
     return nullptr;
   }
-  auto it = node_map_.find(uuid);
-  if (it == node_map_.end()) return nullptr;
+  Shard& shard = ShardFor(uuid);
+  MutexLock lock(&shard.mu);
+  auto it = shard.node_map.find(uuid);
+  if (it == shard.node_map.end()) return nullptr;
   // Found node.  Return only if its refcount is not zero (i.e., when we
   // know that there is no other thread about to destroy it).
   BaseNode* node = it->second;
@@ -83,88 +87,63 @@ RefCountedPtr<BaseNode> ChannelzRegistry::InternalGet(intptr_t uuid) {
 
 std::string ChannelzRegistry::InternalGetTopChannels(
     intptr_t start_channel_id) {
-  absl::InlinedVector<RefCountedPtr<BaseNode>, 10> top_level_channels;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_channel_id);
-         it != node_map_.end(); ++it) {
-      BaseNode* node = it->second;
-      RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kTopLevelChannel &&
-          (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (top_level_channels.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        top_level_channels.emplace_back(std::move(node_ref));
-      }
-    }
-  }
-  Json::Object object;
-  if (!top_level_channels.empty()) {
-    // Create list of channels.
-    Json::Array array;
-    for (size_t i = 0; i < top_level_channels.size(); ++i) {
-      array.emplace_back(top_level_channels[i]->RenderJson());
-    }
-    object["channel"] = std::move(array);
-  }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
-  Json json(std::move(object));
-  return json.Dump();
+  return InternalGetPage(BaseNode::EntityType::kTopLevelChannel,
+                         start_channel_id, "channel");
 }
 
 std::string ChannelzRegistry::InternalGetServers(intptr_t start_server_id) {
-  absl::InlinedVector<RefCountedPtr<BaseNode>, 10> servers;
-  RefCountedPtr<BaseNode> node_after_pagination_limit;
-  {
-    MutexLock lock(&mu_);
-    for (auto it = node_map_.lower_bound(start_server_id);
-         it != node_map_.end(); ++it) {
+  return InternalGetPage(BaseNode::EntityType::kServer, start_server_id,
+                         "server");
+}
+
+std::string ChannelzRegistry::InternalGetPage(BaseNode::EntityType type,
+                                              intptr_t start_id,
+                                              const char* list_name) {
+  // One node past the pagination limit tells us whether to set the "end"
+  // element. No shard can contribute more than that many nodes to the page.
+  const size_t max_nodes = kPaginationLimit + 1;
+  std::vector<RefCountedPtr<BaseNode>> nodes;
+  for (Shard& shard : shards_) {
+    // Note that we can't unref the nodes while holding the lock, because
+    // this may lead to a deadlock.
+    MutexLock lock(&shard.mu);
+    size_t shard_nodes = 0;
+    for (auto it = shard.node_map.lower_bound(start_id);
+         it != shard.node_map.end() && shard_nodes < max_nodes; ++it) {
       BaseNode* node = it->second;
       RefCountedPtr<BaseNode> node_ref;
-      if (node->type() == BaseNode::EntityType::kServer &&
+      if (node->type() == type &&
           (node_ref = node->RefIfNonZero()) != nullptr) {
-        // Check if we are over pagination limit to determine if we need to set
-        // the "end" element. If we don't go through this block, we know that
-        // when the loop terminates, we have <= to kPaginationLimit.
-        // Note that because we have already increased this node's
-        // refcount, we need to decrease it, but we can't unref while
-        // holding the lock, because this may lead to a deadlock.
-        if (servers.size() == kPaginationLimit) {
-          node_after_pagination_limit = std::move(node_ref);
-          break;
-        }
-        servers.emplace_back(std::move(node_ref));
+        nodes.emplace_back(std::move(node_ref));
+        ++shard_nodes;
       }
     }
   }
+  std::sort(nodes.begin(), nodes.end(),
+            [](const RefCountedPtr<BaseNode>& a,
+               const RefCountedPtr<BaseNode>& b) {
+              return a->uuid() < b->uuid();
+            });
+  const bool end = nodes.size() <= kPaginationLimit;
+  if (!end) nodes.resize(kPaginationLimit);
   Json::Object object;
-  if (!servers.empty()) {
-    // Create list of servers.
+  if (!nodes.empty()) {
     Json::Array array;
-    for (size_t i = 0; i < servers.size(); ++i) {
-      array.emplace_back(servers[i]->RenderJson());
+    for (size_t i = 0; i < nodes.size(); ++i) {
+      array.emplace_back(nodes[i]->RenderJson());
     }
-    object["server"] = std::move(array);
+    object[list_name] = std::move(array);
   }
-  if (node_after_pagination_limit == nullptr) object["end"] = true;
+  if (end) object["end"] = true;
   Json json(std::move(object));
   return json.Dump();
 }
 
 void ChannelzRegistry::InternalLogAllEntities() {
   absl::InlinedVector<RefCountedPtr<BaseNode>, 10> nodes;
-  {
-    MutexLock lock(&mu_);
-    for (auto& p : node_map_) {
+  for (Shard& shard : shards_) {
+    MutexLock lock(&shard.mu);
+    for (auto& p : shard.node_map) {
       RefCountedPtr<BaseNode> node = p.second->RefIfNonZero();
       if (node != nullptr) {
         nodes.emplace_back(std::move(node));
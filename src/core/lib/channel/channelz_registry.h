@@ -28,6 +28,7 @@
 
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/gprpp/sync.h"
 
 namespace grpc_core {
@@ -35,6 +36,10 @@ namespace channelz {
 
 // singleton registry object to track all objects that are needed to support
 // channelz bookkeeping. All objects share globally distributed uuids.
+//
+// Nodes are spread over independently locked shards by uuid, so that the
+// channels, subchannels, servers and sockets that come and go on different
+// threads rarely contend with each other or with channelz queries.
 class ChannelzRegistry {
  public:
   // To be called in grpc_init()
@@ -85,12 +90,27 @@ class ChannelzRegistry {
   std::string InternalGetTopChannels(intptr_t start_channel_id);
   std::string InternalGetServers(intptr_t start_server_id);
 
+  // Renders one page of the nodes of the given type, starting at start_id,
+  // into a list named list_name.
+  std::string InternalGetPage(BaseNode::EntityType type, intptr_t start_id,
+                              const char* list_name);
+
   void InternalLogAllEntities();
 
-  // protects members
-  Mutex mu_;
-  std::map<intptr_t, BaseNode*> node_map_;
-  intptr_t uuid_generator_ = 0;
+  static constexpr size_t kNumShards = 16;
+
+  struct Shard {
+    // protects node_map
+    Mutex mu;
+    std::map<intptr_t, BaseNode*> node_map;
+    // Keeps the locks of neighbouring shards in separate cache lines.
+    char padding[GPR_CACHELINE_SIZE];
+  };
+
+  Shard& ShardFor(intptr_t uuid) { return shards_[uuid % kNumShards]; }
+
+  Shard shards_[kNumShards];
+  Atomic<intptr_t> uuid_generator_{0};
 };
 
 }  // namespace channelz
@@ -38,6 +38,13 @@ typedef enum {
   /// Holds a pointer to ServiceConfigCallData associated with this call.
   GRPC_CONTEXT_SERVICE_CONFIG_CALL_DATA,
 
+  /// Value is a \a grpc_core::CallPhaseTrace if the call is being traced.
+  GRPC_CONTEXT_CALL_PHASE_TRACE,
+
+  /// Value is a \a grpc_core::CallNetworkLatency if the call's writes are
+  /// traced with kernel timestamps.
+  GRPC_CONTEXT_NETWORK_LATENCY,
+
   GRPC_CONTEXT_COUNT
 } grpc_context_index;
 
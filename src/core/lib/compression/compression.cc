@@ -32,7 +32,8 @@
 
 int grpc_compression_algorithm_is_message(
     grpc_compression_algorithm algorithm) {
-  return (algorithm >= GRPC_COMPRESS_DEFLATE && algorithm <= GRPC_COMPRESS_GZIP)
+  return grpc_compression_algorithm_to_message_compression_algorithm(
+             algorithm) != GRPC_MESSAGE_COMPRESS_NONE
              ? 1
              : 0;
 }
@@ -56,6 +57,12 @@ int grpc_compression_algorithm_parse(grpc_slice name,
                                            GRPC_MDSTR_STREAM_SLASH_GZIP)) {
     *algorithm = GRPC_COMPRESS_STREAM_GZIP;
     return 1;
+  } else if (grpc_slice_eq_static_interned(name, GRPC_MDSTR_ZSTD)) {
+    *algorithm = GRPC_COMPRESS_ZSTD;
+    return 1;
+  } else if (grpc_slice_eq_static_interned(name, GRPC_MDSTR_LZ4)) {
+    *algorithm = GRPC_COMPRESS_LZ4;
+    return 1;
   } else {
     return 0;
   }
@@ -78,6 +85,12 @@ int grpc_compression_algorithm_name(grpc_compression_algorithm algorithm,
     case GRPC_COMPRESS_STREAM_GZIP:
       *name = "stream/gzip";
       return 1;
+    case GRPC_COMPRESS_ZSTD:
+      *name = "zstd";
+      return 1;
+    case GRPC_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       return 0;
   }
@@ -142,6 +155,10 @@ grpc_slice grpc_compression_algorithm_slice(
       return GRPC_MDSTR_GZIP;
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDSTR_STREAM_SLASH_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+      return GRPC_MDSTR_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MDSTR_LZ4;
     case GRPC_COMPRESS_ALGORITHMS_COUNT:
       return grpc_empty_slice();
   }
@@ -162,6 +179,12 @@ grpc_compression_algorithm grpc_compression_algorithm_from_slice(
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_STREAM_SLASH_GZIP)) {
     return GRPC_COMPRESS_STREAM_GZIP;
   }
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD)) {
+    return GRPC_COMPRESS_ZSTD;
+  }
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_LZ4)) {
+    return GRPC_COMPRESS_LZ4;
+  }
   return GRPC_COMPRESS_ALGORITHMS_COUNT;
 }
 
@@ -176,6 +199,10 @@ grpc_mdelem grpc_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
     case GRPC_COMPRESS_STREAM_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+      return GRPC_MDELEM_GRPC_ENCODING_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MDELEM_GRPC_ENCODING_LZ4;
     default:
       break;
   }
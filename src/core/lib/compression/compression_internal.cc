@@ -43,6 +43,12 @@ grpc_message_compression_algorithm_from_slice(const grpc_slice& str) {
   if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_GZIP)) {
     return GRPC_MESSAGE_COMPRESS_GZIP;
   }
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_ZSTD)) {
+    return GRPC_MESSAGE_COMPRESS_ZSTD;
+  }
+  if (grpc_slice_eq_static_interned(str, GRPC_MDSTR_LZ4)) {
+    return GRPC_MESSAGE_COMPRESS_LZ4;
+  }
   return GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT;
 }
 
@@ -66,6 +72,10 @@ grpc_mdelem grpc_message_compression_encoding_mdelem(
       return GRPC_MDELEM_GRPC_ENCODING_DEFLATE;
     case GRPC_MESSAGE_COMPRESS_GZIP:
       return GRPC_MDELEM_GRPC_ENCODING_GZIP;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      return GRPC_MDELEM_GRPC_ENCODING_ZSTD;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      return GRPC_MDELEM_GRPC_ENCODING_LZ4;
     default:
       break;
   }
@@ -95,6 +105,10 @@ grpc_compression_algorithm_to_message_compression_algorithm(
       return GRPC_MESSAGE_COMPRESS_DEFLATE;
     case GRPC_COMPRESS_GZIP:
       return GRPC_MESSAGE_COMPRESS_GZIP;
+    case GRPC_COMPRESS_ZSTD:
+      return GRPC_MESSAGE_COMPRESS_ZSTD;
+    case GRPC_COMPRESS_LZ4:
+      return GRPC_MESSAGE_COMPRESS_LZ4;
     default:
       return GRPC_MESSAGE_COMPRESS_NONE;
   }
@@ -111,24 +125,66 @@ grpc_compression_algorithm_to_stream_compression_algorithm(
   }
 }
 
+/* The message algorithms no longer occupy the low bits of a
+ * grpc_compression_algorithm bitset (zstd and lz4 come after stream/gzip), so
+ * the bitsets are converted one algorithm at a time. */
 uint32_t grpc_compression_bitset_to_message_bitset(uint32_t bitset) {
-  return bitset & ((1u << GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT) - 1);
+  uint32_t message_bitset = bitset & 1u;
+  for (int i = 1; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (!GPR_BITGET(bitset, i)) continue;
+    grpc_message_compression_algorithm algorithm =
+        grpc_compression_algorithm_to_message_compression_algorithm(
+            static_cast<grpc_compression_algorithm>(i));
+    if (algorithm != GRPC_MESSAGE_COMPRESS_NONE) {
+      GPR_BITSET(&message_bitset, algorithm);
+    }
+  }
+  return message_bitset;
 }
 
 uint32_t grpc_compression_bitset_to_stream_bitset(uint32_t bitset) {
-  uint32_t identity = (bitset & 1u);
-  uint32_t other_bits =
-      (bitset >> (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1)) &
-      ((1u << GRPC_STREAM_COMPRESS_ALGORITHMS_COUNT) - 2);
-  return identity | other_bits;
+  uint32_t stream_bitset = bitset & 1u;
+  for (int i = 1; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    if (!GPR_BITGET(bitset, i)) continue;
+    grpc_stream_compression_algorithm algorithm =
+        grpc_compression_algorithm_to_stream_compression_algorithm(
+            static_cast<grpc_compression_algorithm>(i));
+    if (algorithm != GRPC_STREAM_COMPRESS_NONE) {
+      GPR_BITSET(&stream_bitset, algorithm);
+    }
+  }
+  return stream_bitset;
 }
 
 uint32_t grpc_compression_bitset_from_message_stream_compression_bitset(
     uint32_t message_bitset, uint32_t stream_bitset) {
-  uint32_t offset_stream_bitset =
-      (stream_bitset & 1u) |
-      ((stream_bitset & (~1u)) << (GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT - 1));
-  return message_bitset | offset_stream_bitset;
+  uint32_t bitset = (message_bitset | stream_bitset) & 1u;
+  for (int i = 1; i < GRPC_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const grpc_compression_algorithm algorithm =
+        static_cast<grpc_compression_algorithm>(i);
+    grpc_message_compression_algorithm message_algorithm =
+        grpc_compression_algorithm_to_message_compression_algorithm(algorithm);
+    grpc_stream_compression_algorithm stream_algorithm =
+        grpc_compression_algorithm_to_stream_compression_algorithm(algorithm);
+    if ((message_algorithm != GRPC_MESSAGE_COMPRESS_NONE &&
+         GPR_BITGET(message_bitset, message_algorithm)) ||
+        (stream_algorithm != GRPC_STREAM_COMPRESS_NONE &&
+         GPR_BITGET(stream_bitset, stream_algorithm))) {
+      GPR_BITSET(&bitset, i);
+    }
+  }
+  return bitset;
+}
+
+uint32_t grpc_compression_supported_algorithms_bitset(void) {
+  uint32_t bitset = (1u << GRPC_COMPRESS_ALGORITHMS_COUNT) - 1;
+#ifndef GRPC_HAVE_ZSTD
+  GPR_BITCLEAR(&bitset, GRPC_COMPRESS_ZSTD);
+#endif
+#ifndef GRPC_HAVE_LZ4
+  GPR_BITCLEAR(&bitset, GRPC_COMPRESS_LZ4);
+#endif
+  return bitset;
 }
 
 int grpc_compression_algorithm_from_message_stream_compression_algorithm(
@@ -163,6 +219,12 @@ int grpc_compression_algorithm_from_message_stream_compression_algorithm(
       case GRPC_MESSAGE_COMPRESS_GZIP:
         *algorithm = GRPC_COMPRESS_GZIP;
         return 1;
+      case GRPC_MESSAGE_COMPRESS_ZSTD:
+        *algorithm = GRPC_COMPRESS_ZSTD;
+        return 1;
+      case GRPC_MESSAGE_COMPRESS_LZ4:
+        *algorithm = GRPC_COMPRESS_LZ4;
+        return 1;
       default:
         *algorithm = GRPC_COMPRESS_NONE;
         return 0;
@@ -188,6 +250,12 @@ int grpc_message_compression_algorithm_name(
     case GRPC_MESSAGE_COMPRESS_GZIP:
       *name = "gzip";
       return 1;
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+      *name = "zstd";
+      return 1;
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+      *name = "lz4";
+      return 1;
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       return 0;
   }
@@ -206,6 +274,9 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
     abort();
   }
 
+  /* Only pick the algorithms that this build can compress with. */
+  accepted_encodings &= grpc_compression_bitset_to_message_bitset(
+      grpc_compression_supported_algorithms_bitset());
   const size_t num_supported =
       GPR_BITCOUNT(accepted_encodings) - 1; /* discard NONE */
   if (level == GRPC_COMPRESS_LEVEL_NONE || num_supported == 0) {
@@ -217,8 +288,10 @@ grpc_message_compression_algorithm grpc_message_compression_algorithm_for_level(
   /* Establish a "ranking" or compression algorithms in increasing order of
    * compression.
    * This is simplistic and we will probably want to introduce other dimensions
-   * in the future (cpu/memory cost, etc). */
+   * in the future (cpu/memory cost, etc). Every message compression algorithm
+   * must be ranked, since the levels index into the accepted ones. */
   const grpc_message_compression_algorithm algos_ranking[] = {
+      GRPC_MESSAGE_COMPRESS_LZ4, GRPC_MESSAGE_COMPRESS_ZSTD,
       GRPC_MESSAGE_COMPRESS_GZIP, GRPC_MESSAGE_COMPRESS_DEFLATE};
 
   /* intersect algos_ranking with the supported ones keeping the ranked order */
@@ -262,6 +335,12 @@ int grpc_message_compression_algorithm_parse(
   } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_GZIP)) {
     *algorithm = GRPC_MESSAGE_COMPRESS_GZIP;
     return 1;
+  } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_ZSTD)) {
+    *algorithm = GRPC_MESSAGE_COMPRESS_ZSTD;
+    return 1;
+  } else if (grpc_slice_eq_static_interned(value, GRPC_MDSTR_LZ4)) {
+    *algorithm = GRPC_MESSAGE_COMPRESS_LZ4;
+    return 1;
   } else {
     return 0;
   }
@@ -34,6 +34,8 @@ typedef enum {
   GRPC_MESSAGE_COMPRESS_NONE = 0,
   GRPC_MESSAGE_COMPRESS_DEFLATE,
   GRPC_MESSAGE_COMPRESS_GZIP,
+  GRPC_MESSAGE_COMPRESS_ZSTD,
+  GRPC_MESSAGE_COMPRESS_LZ4,
   /* TODO(ctiller): snappy */
   GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT
 } grpc_message_compression_algorithm;
@@ -63,6 +65,11 @@ uint32_t grpc_compression_bitset_to_stream_bitset(uint32_t bitset);
 uint32_t grpc_compression_bitset_from_message_stream_compression_bitset(
     uint32_t message_bitset, uint32_t stream_bitset);
 
+/* Returns the bitset of the algorithms that this build of gRPC can compress
+ * and decompress with. zstd and lz4 are only included when gRPC is built with
+ * GRPC_HAVE_ZSTD and GRPC_HAVE_LZ4 respectively. */
+uint32_t grpc_compression_supported_algorithms_bitset(void);
+
 int grpc_compression_algorithm_from_message_stream_compression_algorithm(
     grpc_compression_algorithm* algorithm,
     grpc_message_compression_algorithm message_algorithm,
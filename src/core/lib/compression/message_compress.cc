@@ -20,16 +20,71 @@
 
 #include "src/core/lib/compression/message_compress.h"
 
+#include <stdlib.h>
 #include <string.h>
 
+#include <algorithm>
+#include <utility>
+#include <vector>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
+#include <grpc/support/thd_id.h>
+#include <grpc/support/time.h>
 
 #include <zlib.h>
 
+#ifdef GRPC_HAVE_ZSTD
+#include <zstd.h>
+#endif
+#ifdef GRPC_HAVE_LZ4
+#include <lz4frame.h>
+#endif
+
+#include "src/core/lib/gprpp/global_config.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice_internal.h"
 
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_deflate_compression_level, Z_DEFAULT_COMPRESSION,
+    "The zlib level (1 to 9, or -1 for the zlib default) used to compress "
+    "messages with deflate and gzip.");
+
+#ifdef GRPC_HAVE_ZSTD
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_zstd_compression_level, 0,
+    "The zstd level (1 to 22, negative for faster modes, or 0 for the zstd "
+    "default) used to compress messages with zstd.");
+#endif
+
+/* The first output slice is small so that small messages compress into a
+   single small slice; later ones grow up to MAX_OUTPUT_BLOCK_SIZE so that
+   large messages are not split into thousands of slices. */
 #define OUTPUT_BLOCK_SIZE 1024
+#define MAX_OUTPUT_BLOCK_SIZE (64 * 1024)
+/* The idle contexts are split into 1 << CONTEXT_SHARD_BITS shards. */
+#define CONTEXT_SHARD_BITS 4
+/* The number of idle contexts of each kind kept for reuse by each shard. */
+#define MAX_IDLE_CONTEXTS_PER_SHARD 4
+/* Idle contexts that have not been reused for this long are released. */
+#define MAX_IDLE_CONTEXT_MS 10000
+
+/* Appends \a outbuf, of which the first \a used bytes are filled, to \a output
+   and replaces it with the next output block, at least \a min_size bytes. */
+static void next_output_block(grpc_slice_buffer* output, grpc_slice* outbuf,
+                              size_t used, size_t* block_size,
+                              size_t min_size) {
+  if (used == 0) {
+    grpc_slice_unref_internal(*outbuf);
+  } else {
+    GPR_ASSERT(outbuf->refcount);
+    outbuf->data.refcounted.length = used;
+    grpc_slice_buffer_add_indexed(output, *outbuf);
+  }
+  *block_size = std::max(
+      std::min<size_t>(*block_size * 2, MAX_OUTPUT_BLOCK_SIZE), min_size);
+  *outbuf = GRPC_SLICE_MALLOC(*block_size);
+}
 
 static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
                      grpc_slice_buffer* output,
@@ -37,7 +92,8 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
   int r = Z_STREAM_END; /* Do not fail on an empty input. */
   int flush;
   size_t i;
-  grpc_slice outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+  size_t block_size = OUTPUT_BLOCK_SIZE;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
   const uInt uint_max = ~static_cast<uInt>(0);
 
   GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
@@ -51,8 +107,8 @@ static int zlib_body(z_stream* zs, grpc_slice_buffer* input,
     zs->next_in = GRPC_SLICE_START_PTR(input->slices[i]);
     do {
       if (zs->avail_out == 0) {
-        grpc_slice_buffer_add_indexed(output, outbuf);
-        outbuf = GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE);
+        next_output_block(output, &outbuf, GRPC_SLICE_LENGTH(outbuf),
+                          &block_size, 0);
         GPR_ASSERT(GRPC_SLICE_LENGTH(outbuf) <= uint_max);
         zs->avail_out = static_cast<uInt> GRPC_SLICE_LENGTH(outbuf);
         zs->next_out = GRPC_SLICE_START_PTR(outbuf);
@@ -91,54 +147,588 @@ static void* zalloc_gpr(void* /*opaque*/, unsigned int items,
 
 static void zfree_gpr(void* /*opaque*/, void* address) { gpr_free(address); }
 
+/* Initializing a z_stream allocates and clears its window and, for deflate,
+   its hash tables (about 256KB at the default settings), which costs more
+   than compressing a small message; zstd and lz4 contexts are no cheaper.
+   Contexts are therefore reset and reused across messages rather than
+   created for each one. */
+namespace {
+
+enum ContextKind {
+  kDeflateCompress,
+  kGzipCompress,
+  kZstdCompress,
+  kLz4Compress,
+  kDeflateDecompress,
+  kGzipDecompress,
+  kZstdDecompress,
+  kLz4Decompress,
+  kNumContextKinds,
+};
+
+/* ctx is a z_stream, ZSTD_CCtx, ZSTD_DCtx, LZ4F_cctx or LZ4F_dctx, depending
+   on the kind of the list that holds it. */
+struct IdleContext {
+  void* ctx;
+  gpr_timespec idle_since;
+};
+
+/* Each shard has its own lock, and a thread always uses the same shard, so
+   threads that compress messages concurrently rarely contend. */
+struct ContextShard {
+  grpc_core::Mutex mu;
+  /* Most recently used last. */
+  std::vector<IdleContext> idle[kNumContextKinds];
+};
+
+struct ContextPool {
+  ContextShard shards[1 << CONTEXT_SHARD_BITS];
+};
+
+/* Created on first use and never destroyed, since messages may be compressed
+   during or after grpc_shutdown(). */
+ContextPool* GetContextPool() {
+  static ContextPool* pool = new ContextPool();
+  return pool;
+}
+
+ContextShard* GetContextShard() {
+  /* Thread ids are often aligned addresses, so hash them with a Fibonacci
+     multiplier and use the high bits. */
+  const uint64_t id = static_cast<uint64_t>(gpr_thd_currentid());
+  const size_t index = static_cast<size_t>((id * 0x9e3779b97f4a7c15ull) >>
+                                           (64 - CONTEXT_SHARD_BITS));
+  return &GetContextPool()->shards[index];
+}
+
+int DeflateLevel() {
+  static const int level = [] {
+    int32_t level = GPR_GLOBAL_CONFIG_GET(grpc_deflate_compression_level);
+    if (level != Z_DEFAULT_COMPRESSION &&
+        (level < Z_BEST_SPEED || level > Z_BEST_COMPRESSION)) {
+      gpr_log(GPR_ERROR,
+              "Invalid grpc_deflate_compression_level %d, using the default",
+              level);
+      level = Z_DEFAULT_COMPRESSION;
+    }
+    return static_cast<int>(level);
+  }();
+  return level;
+}
+
+#ifdef GRPC_HAVE_ZSTD
+int ZstdLevel() {
+  static const int level = [] {
+    int32_t level = GPR_GLOBAL_CONFIG_GET(grpc_zstd_compression_level);
+    if (level != 0 && (level < ZSTD_minCLevel() || level > ZSTD_maxCLevel())) {
+      gpr_log(GPR_ERROR,
+              "Invalid grpc_zstd_compression_level %d, using the default",
+              level);
+      level = 0;
+    }
+    return static_cast<int>(level);
+  }();
+  return level;
+}
+#endif /* GRPC_HAVE_ZSTD */
+
+bool IsZlib(ContextKind kind) {
+  return kind == kDeflateCompress || kind == kGzipCompress ||
+         kind == kDeflateDecompress || kind == kGzipDecompress;
+}
+
+bool IsInflate(ContextKind kind) {
+  return kind == kDeflateDecompress || kind == kGzipDecompress;
+}
+
+void* NewContext(ContextKind kind) {
+  if (IsZlib(kind)) {
+    z_stream* zs = static_cast<z_stream*>(gpr_zalloc(sizeof(*zs)));
+    zs->zalloc = zalloc_gpr;
+    zs->zfree = zfree_gpr;
+    const int window_bits =
+        15 | (kind == kGzipCompress || kind == kGzipDecompress ? 16 : 0);
+    int r;
+    if (IsInflate(kind)) {
+      r = inflateInit2(zs, window_bits);
+    } else {
+      r = deflateInit2(zs, DeflateLevel(), Z_DEFLATED, window_bits, 8,
+                       Z_DEFAULT_STRATEGY);
+    }
+    GPR_ASSERT(r == Z_OK);
+    return zs;
+  }
+  switch (kind) {
+#ifdef GRPC_HAVE_ZSTD
+    case kZstdCompress: {
+      ZSTD_CCtx* cctx = ZSTD_createCCtx();
+      GPR_ASSERT(cctx != nullptr);
+      GPR_ASSERT(!ZSTD_isError(
+          ZSTD_CCtx_setParameter(cctx, ZSTD_c_compressionLevel, ZstdLevel())));
+      return cctx;
+    }
+    case kZstdDecompress: {
+      ZSTD_DCtx* dctx = ZSTD_createDCtx();
+      GPR_ASSERT(dctx != nullptr);
+      return dctx;
+    }
+#endif /* GRPC_HAVE_ZSTD */
+#ifdef GRPC_HAVE_LZ4
+    case kLz4Compress: {
+      LZ4F_cctx* cctx;
+      GPR_ASSERT(
+          !LZ4F_isError(LZ4F_createCompressionContext(&cctx, LZ4F_VERSION)));
+      return cctx;
+    }
+    case kLz4Decompress: {
+      LZ4F_dctx* dctx;
+      GPR_ASSERT(
+          !LZ4F_isError(LZ4F_createDecompressionContext(&dctx, LZ4F_VERSION)));
+      return dctx;
+    }
+#endif /* GRPC_HAVE_LZ4 */
+    default:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(return nullptr);
+}
+
+/* Prepares \a ctx, which may have failed mid-message, for the next message.
+   Returns false if it cannot be reused. */
+bool ResetContext(ContextKind kind, void* ctx) {
+  if (IsZlib(kind)) {
+    z_stream* zs = static_cast<z_stream*>(ctx);
+    return (IsInflate(kind) ? inflateReset(zs) : deflateReset(zs)) == Z_OK;
+  }
+  switch (kind) {
+#ifdef GRPC_HAVE_ZSTD
+    case kZstdCompress:
+      return !ZSTD_isError(ZSTD_CCtx_reset(static_cast<ZSTD_CCtx*>(ctx),
+                                           ZSTD_reset_session_only));
+    case kZstdDecompress:
+      return !ZSTD_isError(ZSTD_DCtx_reset(static_cast<ZSTD_DCtx*>(ctx),
+                                           ZSTD_reset_session_only));
+#endif /* GRPC_HAVE_ZSTD */
+#ifdef GRPC_HAVE_LZ4
+    case kLz4Compress:
+      /* LZ4F_compressBegin() starts each frame from a clean state. */
+      return true;
+    case kLz4Decompress:
+      LZ4F_resetDecompressionContext(static_cast<LZ4F_dctx*>(ctx));
+      return true;
+#endif /* GRPC_HAVE_LZ4 */
+    default:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(return false);
+}
+
+void DestroyContext(ContextKind kind, void* ctx) {
+  if (IsZlib(kind)) {
+    z_stream* zs = static_cast<z_stream*>(ctx);
+    if (IsInflate(kind)) {
+      inflateEnd(zs);
+    } else {
+      deflateEnd(zs);
+    }
+    gpr_free(zs);
+    return;
+  }
+  switch (kind) {
+#ifdef GRPC_HAVE_ZSTD
+    case kZstdCompress:
+      ZSTD_freeCCtx(static_cast<ZSTD_CCtx*>(ctx));
+      return;
+    case kZstdDecompress:
+      ZSTD_freeDCtx(static_cast<ZSTD_DCtx*>(ctx));
+      return;
+#endif /* GRPC_HAVE_ZSTD */
+#ifdef GRPC_HAVE_LZ4
+    case kLz4Compress:
+      LZ4F_freeCompressionContext(static_cast<LZ4F_cctx*>(ctx));
+      return;
+    case kLz4Decompress:
+      LZ4F_freeDecompressionContext(static_cast<LZ4F_dctx*>(ctx));
+      return;
+#endif /* GRPC_HAVE_LZ4 */
+    default:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(abort());
+}
+
+/* Moves the contexts of \a shard that have been idle since before \a cutoff
+   (all of them if \a cutoff is null) to \a expired. */
+using ContextList = std::vector<std::pair<ContextKind, void*>>;
+
+void TakeIdleContextsLocked(ContextShard* shard, const gpr_timespec* cutoff,
+                            ContextList* expired) {
+  for (int kind = 0; kind < kNumContextKinds; kind++) {
+    std::vector<IdleContext>& idle = shard->idle[kind];
+    auto it = idle.begin();
+    while (it != idle.end() &&
+           (cutoff == nullptr || gpr_time_cmp(it->idle_since, *cutoff) < 0)) {
+      expired->emplace_back(static_cast<ContextKind>(kind), it->ctx);
+      ++it;
+    }
+    idle.erase(idle.begin(), it);
+  }
+}
+
+void* GetContext(ContextKind kind) {
+  ContextShard* shard = GetContextShard();
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    if (!shard->idle[kind].empty()) {
+      void* ctx = shard->idle[kind].back().ctx;
+      shard->idle[kind].pop_back();
+      return ctx;
+    }
+  }
+  return NewContext(kind);
+}
+
+/* Resets \a ctx and keeps it for the next message of the same kind.
+   Contexts of the shard that have been idle for too long are released at
+   the same time. */
+void PutContext(ContextKind kind, void* ctx) {
+  if (!ResetContext(kind, ctx)) {
+    DestroyContext(kind, ctx);
+    return;
+  }
+  const gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  const gpr_timespec cutoff = gpr_time_sub(
+      now, gpr_time_from_millis(MAX_IDLE_CONTEXT_MS, GPR_TIMESPAN));
+  ContextList expired;
+  ContextShard* shard = GetContextShard();
+  {
+    grpc_core::MutexLock lock(&shard->mu);
+    TakeIdleContextsLocked(shard, &cutoff, &expired);
+    if (shard->idle[kind].size() < MAX_IDLE_CONTEXTS_PER_SHARD) {
+      shard->idle[kind].push_back({ctx, now});
+      ctx = nullptr;
+    }
+  }
+  if (ctx != nullptr) DestroyContext(kind, ctx);
+  for (const auto& p : expired) DestroyContext(p.first, p.second);
+}
+
+}  // namespace
+
+/* Drops the slices appended to \a output since it held \a count_before
+   slices of \a length_before bytes in total. */
+static void truncate_output(grpc_slice_buffer* output, size_t count_before,
+                            size_t length_before) {
+  for (size_t i = count_before; i < output->count; i++) {
+    grpc_slice_unref_internal(output->slices[i]);
+  }
+  output->count = count_before;
+  output->length = length_before;
+}
+
 static int zlib_compress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                          int gzip) {
-  z_stream zs;
+  const ContextKind kind = gzip ? kGzipCompress : kDeflateCompress;
+  z_stream* zs = static_cast<z_stream*>(GetContext(kind));
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = deflateInit2(&zs, Z_DEFAULT_COMPRESSION, Z_DEFLATED, 15 | (gzip ? 16 : 0),
-                   8, Z_DEFAULT_STRATEGY);
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, deflate) && output->length < input->length;
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_slice_unref_internal(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  deflateEnd(&zs);
+  r = zlib_body(zs, input, output, deflate) && output->length < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kind, zs);
   return r;
 }
 
 static int zlib_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output,
                            int gzip) {
-  z_stream zs;
+  const ContextKind kind = gzip ? kGzipDecompress : kDeflateDecompress;
+  z_stream* zs = static_cast<z_stream*>(GetContext(kind));
   int r;
-  size_t i;
   size_t count_before = output->count;
   size_t length_before = output->length;
-  memset(&zs, 0, sizeof(zs));
-  zs.zalloc = zalloc_gpr;
-  zs.zfree = zfree_gpr;
-  r = inflateInit2(&zs, 15 | (gzip ? 16 : 0));
-  GPR_ASSERT(r == Z_OK);
-  r = zlib_body(&zs, input, output, inflate);
-  if (!r) {
-    for (i = count_before; i < output->count; i++) {
-      grpc_slice_unref_internal(output->slices[i]);
-    }
-    output->count = count_before;
-    output->length = length_before;
-  }
-  inflateEnd(&zs);
+  r = zlib_body(zs, input, output, inflate);
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kind, zs);
+  return r;
+}
+
+#ifdef GRPC_HAVE_ZSTD
+static int zstd_compress_body(ZSTD_CCtx* cctx, grpc_slice_buffer* input,
+                              grpc_slice_buffer* output) {
+  size_t block_size = OUTPUT_BLOCK_SIZE;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), block_size, 0};
+  /* Knowing the message size up front lets zstd size its window and tables
+     for it, and records the size in the frame header. */
+  size_t r = ZSTD_CCtx_setPledgedSrcSize(cctx, input->length);
+  for (size_t i = 0; !ZSTD_isError(r) && i <= input->count; i++) {
+    /* After the last slice, flush what zstd holds and end the frame. */
+    const bool end = i == input->count;
+    ZSTD_inBuffer in = {nullptr, 0, 0};
+    if (!end) {
+      in.src = GRPC_SLICE_START_PTR(input->slices[i]);
+      in.size = GRPC_SLICE_LENGTH(input->slices[i]);
+    }
+    do {
+      if (out.pos == out.size) {
+        next_output_block(output, &outbuf, out.pos, &block_size, 0);
+        out = {GRPC_SLICE_START_PTR(outbuf), block_size, 0};
+      }
+      r = ZSTD_compressStream2(cctx, &out, &in,
+                               end ? ZSTD_e_end : ZSTD_e_continue);
+    } while (!ZSTD_isError(r) && (end ? r != 0 : in.pos < in.size));
+  }
+  if (ZSTD_isError(r)) {
+    gpr_log(GPR_INFO, "zstd error: %s", ZSTD_getErrorName(r));
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+static int zstd_decompress_body(ZSTD_DCtx* dctx, grpc_slice_buffer* input,
+                                grpc_slice_buffer* output) {
+  size_t block_size = OUTPUT_BLOCK_SIZE;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
+  ZSTD_outBuffer out = {GRPC_SLICE_START_PTR(outbuf), block_size, 0};
+  size_t r = 0; /* Do not fail on an empty input. */
+  for (size_t i = 0; !ZSTD_isError(r) && i < input->count; i++) {
+    ZSTD_inBuffer in = {GRPC_SLICE_START_PTR(input->slices[i]),
+                        GRPC_SLICE_LENGTH(input->slices[i]), 0};
+    /* A full output block may leave decompressed data inside zstd, so keep
+       going until a block is left partly empty or the frame is complete
+       (calling zstd again would then start another frame). */
+    do {
+      if (out.pos == out.size) {
+        next_output_block(output, &outbuf, out.pos, &block_size, 0);
+        out = {GRPC_SLICE_START_PTR(outbuf), block_size, 0};
+      }
+      r = ZSTD_decompressStream(dctx, &out, &in);
+    } while (!ZSTD_isError(r) &&
+             (in.pos < in.size || (out.pos == out.size && r != 0)));
+  }
+  if (ZSTD_isError(r)) {
+    gpr_log(GPR_INFO, "zstd error: %s", ZSTD_getErrorName(r));
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  if (r != 0) {
+    gpr_log(GPR_INFO, "zstd: truncated frame");
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length = out.pos;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+static int zstd_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  ZSTD_CCtx* cctx = static_cast<ZSTD_CCtx*>(GetContext(kZstdCompress));
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r =
+      zstd_compress_body(cctx, input, output) && output->length < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kZstdCompress, cctx);
+  return r;
+}
+
+static int zstd_decompress(grpc_slice_buffer* input,
+                           grpc_slice_buffer* output) {
+  ZSTD_DCtx* dctx = static_cast<ZSTD_DCtx*>(GetContext(kZstdDecompress));
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = zstd_decompress_body(dctx, input, output);
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kZstdDecompress, dctx);
   return r;
 }
+#endif /* GRPC_HAVE_ZSTD */
+
+#ifdef GRPC_HAVE_LZ4
+/* The largest chunk handed to LZ4F_compressUpdate() at once: one lz4 block. */
+#define LZ4_CHUNK_SIZE (64 * 1024)
+
+/* Output blocks of an lz4 frame being compressed. */
+struct lz4_output {
+  grpc_slice_buffer* output;
+  grpc_slice outbuf;
+  size_t block_size;
+  size_t used;
+};
+
+/* Compresses \a n bytes at \a src into \a out. Returns an lz4 error code on
+   failure. */
+static size_t lz4_compress_update(LZ4F_cctx* cctx,
+                                  const LZ4F_preferences_t* prefs,
+                                  lz4_output* out, const uint8_t* src,
+                                  size_t n) {
+  /* Any chunk of at most one lz4 block compresses into at most its own size
+     plus this much block and frame overhead. */
+  const size_t overhead = LZ4F_compressBound(1, prefs) - 1;
+  while (n > 0) {
+    if (out->block_size - out->used <= overhead) {
+      next_output_block(out->output, &out->outbuf, out->used, &out->block_size,
+                        0);
+      out->used = 0;
+    }
+    const size_t chunk = std::min({n, static_cast<size_t>(LZ4_CHUNK_SIZE),
+                                   out->block_size - out->used - overhead});
+    GPR_DEBUG_ASSERT(LZ4F_compressBound(chunk, prefs) <=
+                     out->block_size - out->used);
+    const size_t r =
+        LZ4F_compressUpdate(cctx, GRPC_SLICE_START_PTR(out->outbuf) + out->used,
+                            out->block_size - out->used, src, chunk, nullptr);
+    if (LZ4F_isError(r)) return r;
+    out->used += r;
+    src += chunk;
+    n -= chunk;
+  }
+  return 0;
+}
+
+static int lz4_compress_body(LZ4F_cctx* cctx, grpc_slice_buffer* input,
+                             grpc_slice_buffer* output) {
+  LZ4F_preferences_t prefs;
+  memset(&prefs, 0, sizeof(prefs));
+  prefs.frameInfo.blockSizeID = LZ4F_max64KB;
+  prefs.frameInfo.contentSize = input->length;
+  /* Without autoFlush, LZ4F_compressBound() must allow for a whole block
+     held back by lz4, which would not fit in the small first output block. */
+  prefs.autoFlush = 1;
+  lz4_output out = {output, GRPC_SLICE_MALLOC(OUTPUT_BLOCK_SIZE),
+                    OUTPUT_BLOCK_SIZE, 0};
+  /* With autoFlush, each call emits its own lz4 block, so slices much
+     smaller than a block are gathered into \a stage first rather than
+     compressed into a block each. */
+  uint8_t* stage = nullptr;
+  size_t staged = 0;
+  size_t r = LZ4F_compressBegin(cctx, GRPC_SLICE_START_PTR(out.outbuf),
+                                out.block_size, &prefs);
+  if (!LZ4F_isError(r)) out.used = r;
+  for (size_t i = 0; !LZ4F_isError(r) && i < input->count; i++) {
+    const uint8_t* src = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t left = GRPC_SLICE_LENGTH(input->slices[i]);
+    if (staged == 0 && left >= LZ4_CHUNK_SIZE / 4) {
+      r = lz4_compress_update(cctx, &prefs, &out, src, left);
+      continue;
+    }
+    if (stage == nullptr) {
+      stage = static_cast<uint8_t*>(gpr_malloc(LZ4_CHUNK_SIZE));
+    }
+    while (!LZ4F_isError(r) && left > 0) {
+      const size_t n = std::min<size_t>(left, LZ4_CHUNK_SIZE - staged);
+      memcpy(stage + staged, src, n);
+      staged += n;
+      src += n;
+      left -= n;
+      if (staged == LZ4_CHUNK_SIZE) {
+        r = lz4_compress_update(cctx, &prefs, &out, stage, staged);
+        staged = 0;
+      }
+    }
+  }
+  if (!LZ4F_isError(r) && staged > 0) {
+    r = lz4_compress_update(cctx, &prefs, &out, stage, staged);
+  }
+  gpr_free(stage);
+  if (!LZ4F_isError(r)) {
+    if (out.block_size - out.used < LZ4F_compressBound(0, &prefs)) {
+      next_output_block(output, &out.outbuf, out.used, &out.block_size, 0);
+      out.used = 0;
+    }
+    r = LZ4F_compressEnd(cctx, GRPC_SLICE_START_PTR(out.outbuf) + out.used,
+                         out.block_size - out.used, nullptr);
+    if (!LZ4F_isError(r)) out.used += r;
+  }
+  if (LZ4F_isError(r)) {
+    gpr_log(GPR_INFO, "lz4 error: %s", LZ4F_getErrorName(r));
+    grpc_slice_unref_internal(out.outbuf);
+    return 0;
+  }
+  GPR_ASSERT(out.outbuf.refcount);
+  out.outbuf.data.refcounted.length = out.used;
+  grpc_slice_buffer_add_indexed(output, out.outbuf);
+  return 1;
+}
+
+static int lz4_decompress_body(LZ4F_dctx* dctx, grpc_slice_buffer* input,
+                               grpc_slice_buffer* output) {
+  size_t block_size = OUTPUT_BLOCK_SIZE;
+  grpc_slice outbuf = GRPC_SLICE_MALLOC(block_size);
+  size_t used = 0;
+  size_t r = 0; /* Do not fail on an empty input. */
+  for (size_t i = 0; !LZ4F_isError(r) && i < input->count; i++) {
+    const uint8_t* src = GRPC_SLICE_START_PTR(input->slices[i]);
+    size_t left = GRPC_SLICE_LENGTH(input->slices[i]);
+    /* As for zstd, a full output block may leave data inside lz4. */
+    do {
+      if (used == block_size) {
+        next_output_block(output, &outbuf, used, &block_size, 0);
+        used = 0;
+      }
+      size_t dst_size = block_size - used;
+      size_t src_size = left;
+      r = LZ4F_decompress(dctx, GRPC_SLICE_START_PTR(outbuf) + used, &dst_size,
+                          src, &src_size, nullptr);
+      if (!LZ4F_isError(r)) {
+        used += dst_size;
+        src += src_size;
+        left -= src_size;
+      }
+    } while (!LZ4F_isError(r) && (left > 0 || (used == block_size && r != 0)));
+  }
+  if (LZ4F_isError(r)) {
+    gpr_log(GPR_INFO, "lz4 error: %s", LZ4F_getErrorName(r));
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  if (r != 0) {
+    gpr_log(GPR_INFO, "lz4: truncated frame");
+    grpc_slice_unref_internal(outbuf);
+    return 0;
+  }
+  GPR_ASSERT(outbuf.refcount);
+  outbuf.data.refcounted.length = used;
+  grpc_slice_buffer_add_indexed(output, outbuf);
+  return 1;
+}
+
+static int lz4_compress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  LZ4F_cctx* cctx = static_cast<LZ4F_cctx*>(GetContext(kLz4Compress));
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r =
+      lz4_compress_body(cctx, input, output) && output->length < input->length;
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kLz4Compress, cctx);
+  return r;
+}
+
+static int lz4_decompress(grpc_slice_buffer* input, grpc_slice_buffer* output) {
+  LZ4F_dctx* dctx = static_cast<LZ4F_dctx*>(GetContext(kLz4Decompress));
+  size_t count_before = output->count;
+  size_t length_before = output->length;
+  int r = lz4_decompress_body(dctx, input, output);
+  if (!r) truncate_output(output, count_before, length_before);
+  PutContext(kLz4Decompress, dctx);
+  return r;
+}
+#endif /* GRPC_HAVE_LZ4 */
+
+size_t grpc_msg_compress_trim_idle_streams(void) {
+  ContextList expired;
+  for (ContextShard& shard : GetContextPool()->shards) {
+    grpc_core::MutexLock lock(&shard.mu);
+    TakeIdleContextsLocked(&shard, nullptr, &expired);
+  }
+  for (const auto& p : expired) DestroyContext(p.first, p.second);
+  return expired.size();
+}
 
 static int copy(grpc_slice_buffer* input, grpc_slice_buffer* output) {
   size_t i;
@@ -159,6 +749,20 @@ static int compress_inner(grpc_message_compression_algorithm algorithm,
       return zlib_compress(input, output, 0);
     case GRPC_MESSAGE_COMPRESS_GZIP:
       return zlib_compress(input, output, 1);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_compress(input, output);
+#else
+      gpr_log(GPR_ERROR, "zstd compression is not available in this build");
+      return 0;
+#endif
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_compress(input, output);
+#else
+      gpr_log(GPR_ERROR, "lz4 compression is not available in this build");
+      return 0;
+#endif
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
@@ -184,6 +788,20 @@ int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
       return zlib_decompress(input, output, 0);
     case GRPC_MESSAGE_COMPRESS_GZIP:
       return zlib_decompress(input, output, 1);
+    case GRPC_MESSAGE_COMPRESS_ZSTD:
+#ifdef GRPC_HAVE_ZSTD
+      return zstd_decompress(input, output);
+#else
+      gpr_log(GPR_ERROR, "zstd decompression is not available in this build");
+      return 0;
+#endif
+    case GRPC_MESSAGE_COMPRESS_LZ4:
+#ifdef GRPC_HAVE_LZ4
+      return lz4_decompress(input, output);
+#else
+      gpr_log(GPR_ERROR, "lz4 decompression is not available in this build");
+      return 0;
+#endif
     case GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT:
       break;
   }
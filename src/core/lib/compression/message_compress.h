@@ -37,4 +37,9 @@ int grpc_msg_compress(grpc_message_compression_algorithm algorithm,
 int grpc_msg_decompress(grpc_message_compression_algorithm algorithm,
                         grpc_slice_buffer* input, grpc_slice_buffer* output);
 
+/* Releases the compression contexts (zlib streams and zstd and lz4 contexts)
+   that are idle and kept for reuse by later messages. Returns the number of
+   contexts released. */
+size_t grpc_msg_compress_trim_idle_streams(void);
+
 #endif /* GRPC_CORE_LIB_COMPRESSION_MESSAGE_COMPRESS_H */
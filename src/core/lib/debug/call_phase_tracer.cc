@@ -0,0 +1,300 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/call_phase_tracer.h"
+
+#include <math.h>
+
+#include <algorithm>
+#include <map>
+
+#include <grpc/support/sync.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/gpr/tls.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/slice/slice_utils.h"
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_call_phase_trace_sample_rate, 1000,
+    "Trace the lifecycle phases of 1 in this many client calls. 0 disables "
+    "call phase tracing.");
+
+namespace grpc_core {
+
+namespace {
+
+constexpr int kNumPhases = static_cast<int>(CallPhase::kNumPhases);
+
+// Capacity of each thread's ring of finished traces.
+constexpr size_t kRingSize = 256;
+// Rings are never freed, since there is no portable hook for thread exit.
+// Threads beyond this many drop their traces.
+constexpr size_t kMaxRings = 1024;
+// Calls to methods beyond this many are aggregated under one label.
+constexpr size_t kMaxMethods = 128;
+constexpr char kOtherMethods[] = "other";
+
+struct FinishedTrace {
+  std::string method;
+  // Microseconds from the creation of the call, or -1 for phases that were
+  // not reached.
+  int64_t phase_latency[kNumPhases];
+};
+
+// A single-producer, single-consumer ring: only the owning thread pushes, and
+// only a scrape, under the tracer's mutex, drains.
+class TraceRing {
+ public:
+  bool Push(FinishedTrace* trace) {
+    size_t head = head_.Load(MemoryOrder::RELAXED);
+    if (head - tail_.Load(MemoryOrder::ACQUIRE) == kRingSize) return false;
+    std::swap(traces_[head % kRingSize], *trace);
+    head_.Store(head + 1, MemoryOrder::RELEASE);
+    return true;
+  }
+
+  template <typename F>
+  void Drain(F f) {
+    size_t tail = tail_.Load(MemoryOrder::RELAXED);
+    const size_t head = head_.Load(MemoryOrder::ACQUIRE);
+    for (; tail != head; ++tail) f(traces_[tail % kRingSize]);
+    tail_.Store(tail, MemoryOrder::RELEASE);
+  }
+
+ private:
+  FinishedTrace traces_[kRingSize];
+  Atomic<size_t> head_{0};
+  // Keeps the producer's and the consumer's index on separate cache lines.
+  char padding_[GPR_CACHELINE_SIZE];
+  Atomic<size_t> tail_{0};
+};
+
+struct TracerState {
+  Mutex mu;
+  std::vector<TraceRing*> rings;
+  std::map<std::string, std::vector<CallPhaseTracer::Histogram>> histograms;
+};
+
+// Created on first use and never destroyed, so that traces survive
+// grpc_shutdown() and calls destroyed after it do not crash.
+TracerState* GetTracerState() {
+  static TracerState* state = new TracerState();
+  return state;
+}
+
+Atomic<int32_t> g_sample_rate{0};
+Atomic<int64_t> g_dropped{0};
+gpr_once g_tls_once = GPR_ONCE_INIT;
+// Calls this thread creates before the next sampled one, or 0 if it has not
+// created any.
+GPR_TLS_DECL(g_countdown);
+// This thread's TraceRing, if it has finished a trace.
+GPR_TLS_DECL(g_ring);
+
+void InitTls() {
+  gpr_tls_init(&g_countdown);
+  gpr_tls_init(&g_ring);
+}
+
+TraceRing* GetThreadRing() {
+  TraceRing* ring = reinterpret_cast<TraceRing*>(gpr_tls_get(&g_ring));
+  if (ring != nullptr) return ring;
+  TracerState* state = GetTracerState();
+  MutexLock lock(&state->mu);
+  if (state->rings.size() >= kMaxRings) return nullptr;
+  ring = new TraceRing();
+  state->rings.push_back(ring);
+  gpr_tls_set(&g_ring, reinterpret_cast<intptr_t>(ring));
+  return ring;
+}
+
+}  // namespace
+
+const char* CallPhaseName(CallPhase phase) {
+  switch (phase) {
+    case CallPhase::kFilterStackEntered:
+      return "filter_stack_entered";
+    case CallPhase::kLbPicked:
+      return "lb_picked";
+    case CallPhase::kTransportWriteStarted:
+      return "transport_write_started";
+    case CallPhase::kTransportFlushed:
+      return "transport_flushed";
+    case CallPhase::kFirstByteReceived:
+      return "first_byte_received";
+    case CallPhase::kMessageDelivered:
+      return "message_delivered";
+    case CallPhase::kCompleted:
+      return "completed";
+    case CallPhase::kNumPhases:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+//
+// CallPhaseTrace
+//
+
+CallPhaseTrace* CallPhaseTrace::MaybeCreate(Arena* arena,
+                                            const grpc_slice& method,
+                                            gpr_cycle_counter start_time) {
+  const int32_t sample_rate = g_sample_rate.Load(MemoryOrder::RELAXED);
+  if (sample_rate <= 0) return nullptr;
+  intptr_t countdown = gpr_tls_get(&g_countdown);
+  if (countdown == 0) countdown = sample_rate;
+  if (countdown > 1) {
+    gpr_tls_set(&g_countdown, countdown - 1);
+    return nullptr;
+  }
+  gpr_tls_set(&g_countdown, sample_rate);
+  return arena->New<CallPhaseTrace>(std::string(StringViewFromSlice(method)),
+                                    start_time);
+}
+
+void CallPhaseTrace::Destroy(void* arg) {
+  CallPhaseTrace* trace = static_cast<CallPhaseTrace*>(arg);
+  trace->Record(CallPhase::kCompleted);
+  FinishedTrace finished;
+  finished.method = std::move(trace->method_);
+  for (int i = 0; i < kNumPhases; i++) {
+    const gpr_cycle_counter timestamp =
+        trace->timestamps_[i].Load(MemoryOrder::RELAXED);
+    finished.phase_latency[i] =
+        timestamp == 0 ? -1
+                       : static_cast<int64_t>(gpr_timespec_to_micros(
+                             gpr_cycle_counter_sub(timestamp,
+                                                   trace->start_time_)));
+  }
+  // The arena is freed later, without running destructors.
+  trace->~CallPhaseTrace();
+  TraceRing* ring = GetThreadRing();
+  if (ring == nullptr || !ring->Push(&finished)) {
+    g_dropped.FetchAdd(1, MemoryOrder::RELAXED);
+  }
+}
+
+//
+// CallPhaseTracer::Histogram
+//
+
+namespace {
+
+constexpr int64_t kExactBuckets = 32;
+constexpr int64_t kSubBuckets = 16;
+// About 12.7 days in microseconds; larger values are clamped.
+constexpr int64_t kMaxValue = (int64_t{1} << 40) - 1;
+// Values up to kMaxValue need shifts up to 36 to fit below kExactBuckets.
+constexpr size_t kNumBuckets = kExactBuckets + 36 * kSubBuckets;
+
+}  // namespace
+
+size_t CallPhaseTracer::Histogram::BucketFor(int64_t value) {
+  if (value < kExactBuckets) return value < 0 ? 0 : static_cast<size_t>(value);
+  value = std::min(value, kMaxValue);
+  int shift = 0;
+  while ((value >> shift) >= kExactBuckets) shift++;
+  // value >> shift is now in [kSubBuckets, kExactBuckets).
+  return static_cast<size_t>(kExactBuckets + (shift - 1) * kSubBuckets +
+                             ((value >> shift) - kSubBuckets));
+}
+
+int64_t CallPhaseTracer::Histogram::BucketUpperBound(size_t bucket) {
+  const int64_t b = static_cast<int64_t>(bucket);
+  if (b < kExactBuckets) return b;
+  const int64_t shift = (b - kExactBuckets) / kSubBuckets + 1;
+  const int64_t mantissa = (b - kExactBuckets) % kSubBuckets + kSubBuckets;
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void CallPhaseTracer::Histogram::Add(int64_t value) {
+  if (buckets_.empty()) buckets_.resize(kNumBuckets);
+  buckets_[BucketFor(value)]++;
+  count_++;
+  sum_ += value;
+}
+
+int64_t CallPhaseTracer::Histogram::Quantile(double quantile) const {
+  if (count_ == 0) return 0;
+  const int64_t rank = std::max<int64_t>(
+      1, static_cast<int64_t>(ceil(quantile * static_cast<double>(count_))));
+  int64_t seen = 0;
+  for (size_t i = 0; i < buckets_.size(); i++) {
+    seen += buckets_[i];
+    if (seen >= rank) return BucketUpperBound(i);
+  }
+  return BucketUpperBound(buckets_.size() - 1);
+}
+
+//
+// CallPhaseTracer
+//
+
+void CallPhaseTracer::Init() {
+  gpr_once_init(&g_tls_once, InitTls);
+  g_sample_rate.Store(GPR_GLOBAL_CONFIG_GET(grpc_call_phase_trace_sample_rate),
+                      MemoryOrder::RELAXED);
+}
+
+void CallPhaseTracer::SetSampleRateForTesting(int32_t sample_rate) {
+  gpr_once_init(&g_tls_once, InitTls);
+  g_sample_rate.Store(sample_rate, MemoryOrder::RELAXED);
+  gpr_tls_set(&g_countdown, 1);
+}
+
+void CallPhaseTracer::ForEachHistogram(
+    const std::function<void(const std::string& method, CallPhase phase,
+                             const Histogram& histogram)>& f) {
+  TracerState* state = GetTracerState();
+  MutexLock lock(&state->mu);
+  for (TraceRing* ring : state->rings) {
+    ring->Drain([state](const FinishedTrace& trace) {
+      auto it = state->histograms.find(trace.method);
+      if (it == state->histograms.end()) {
+        std::string method = state->histograms.size() < kMaxMethods
+                                 ? trace.method
+                                 : std::string(kOtherMethods);
+        it = state->histograms
+                 .emplace(method, std::vector<Histogram>(kNumPhases))
+                 .first;
+      }
+      for (int i = 0; i < kNumPhases; i++) {
+        if (trace.phase_latency[i] >= 0) {
+          it->second[i].Add(trace.phase_latency[i]);
+        }
+      }
+    });
+  }
+  for (const auto& p : state->histograms) {
+    for (int i = 0; i < kNumPhases; i++) {
+      if (p.second[i].count() > 0) {
+        f(p.first, static_cast<CallPhase>(i), p.second[i]);
+      }
+    }
+  }
+}
+
+int64_t CallPhaseTracer::dropped() {
+  return g_dropped.Load(MemoryOrder::RELAXED);
+}
+
+}  // namespace grpc_core
@@ -0,0 +1,161 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_DEBUG_CALL_PHASE_TRACER_H
+#define GRPC_CORE_LIB_DEBUG_CALL_PHASE_TRACER_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+#include <grpc/slice.h>
+
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/gpr/time_precise.h"
+#include "src/core/lib/gprpp/arena.h"
+#include "src/core/lib/gprpp/atomic.h"
+#include "src/core/lib/gprpp/global_config.h"
+
+// 1 in this many client calls is traced; 0 disables tracing.
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_call_phase_trace_sample_rate);
+
+namespace grpc_core {
+
+// Phases of a client call's life, in the order they normally happen. Each is
+// timed from the creation of the call.
+enum class CallPhase {
+  // The first batch was passed down the filter stack.
+  kFilterStackEntered,
+  // The LB policy picked a subchannel.
+  kLbPicked,
+  // The transport started writing the call's initial metadata.
+  kTransportWriteStarted,
+  // The first write that included the call's data was flushed.
+  kTransportFlushed,
+  // The first frame from the server was received.
+  kFirstByteReceived,
+  // The first message was delivered to the application.
+  kMessageDelivered,
+  // The call was destroyed.
+  kCompleted,
+  kNumPhases,
+};
+
+const char* CallPhaseName(CallPhase phase);
+
+// The phase timestamps of one sampled call. It lives in the call's arena and
+// is reachable by every layer through GRPC_CONTEXT_CALL_PHASE_TRACE. Each
+// phase is recorded once, from whichever thread reaches it first, and only
+// read when the call is destroyed.
+class CallPhaseTrace {
+ public:
+  // Returns a trace for a new client call to \a method if the call is
+  // sampled, or nullptr. Sampling is decided by a per-thread countdown, so
+  // unsampled calls cost a thread-local decrement.
+  static CallPhaseTrace* MaybeCreate(Arena* arena, const grpc_slice& method,
+                                     gpr_cycle_counter start_time);
+
+  CallPhaseTrace(std::string method, gpr_cycle_counter start_time)
+      : method_(std::move(method)), start_time_(start_time) {}
+
+  // The context destroy function: records kCompleted and hands the trace to
+  // the current thread's ring buffer.
+  static void Destroy(void* trace);
+
+  static void Record(const grpc_call_context_element* context,
+                     CallPhase phase) {
+    if (context == nullptr) return;
+    CallPhaseTrace* trace = static_cast<CallPhaseTrace*>(
+        context[GRPC_CONTEXT_CALL_PHASE_TRACE].value);
+    if (trace != nullptr) trace->Record(phase);
+  }
+
+  // Phases may be reached concurrently, e.g. kFilterStackEntered on an
+  // application thread while a poller records kFirstByteReceived, so each
+  // timestamp is only set by the thread that changes it from 0.
+  void Record(CallPhase phase) {
+    Atomic<gpr_cycle_counter>& timestamp =
+        timestamps_[static_cast<int>(phase)];
+    gpr_cycle_counter expected = 0;
+    if (timestamp.Load(MemoryOrder::RELAXED) != expected) return;
+    timestamp.CompareExchangeStrong(&expected, gpr_get_cycle_counter(),
+                                    MemoryOrder::RELAXED,
+                                    MemoryOrder::RELAXED);
+  }
+
+ private:
+  std::string method_;
+  const gpr_cycle_counter start_time_;
+  Atomic<gpr_cycle_counter>
+      timestamps_[static_cast<int>(CallPhase::kNumPhases)];
+};
+
+// Aggregates finished traces into per-method, per-phase latency histograms.
+//
+// Finished traces are pushed to a per-thread, single-producer ring buffer
+// without locking; they are moved into the histograms only when the tracer is
+// scraped. If a thread's ring is full, its traces are dropped and counted
+// until the next scrape.
+class CallPhaseTracer {
+ public:
+  // A log-linear histogram in the style of HdrHistogram: values below 32 are
+  // counted exactly, and each power of two above that is split into 16
+  // buckets, so quantiles are within about 6% of the true value.
+  class Histogram {
+   public:
+    void Add(int64_t value);
+    // Returns the upper bound of the bucket holding the \a quantile-th value,
+    // or 0 if the histogram is empty.
+    int64_t Quantile(double quantile) const;
+    int64_t count() const { return count_; }
+    int64_t sum() const { return sum_; }
+
+   private:
+    static size_t BucketFor(int64_t value);
+    static int64_t BucketUpperBound(size_t bucket);
+
+    // Allocated by the first Add().
+    std::vector<int64_t> buckets_;
+    int64_t count_ = 0;
+    int64_t sum_ = 0;
+  };
+
+  static void Init();
+
+  // For tests: changes the sample rate, and restarts the current thread's
+  // countdown so that the next call it creates is sampled.
+  static void SetSampleRateForTesting(int32_t sample_rate);
+
+  // Moves finished traces into the histograms, and calls \a f with the
+  // method, phase and histogram of every phase that has been reached by
+  // some call, in method order. Latencies are in microseconds.
+  static void ForEachHistogram(
+      const std::function<void(const std::string& method, CallPhase phase,
+                               const Histogram& histogram)>& f);
+
+  // Number of traces dropped because a ring was full.
+  static int64_t dropped();
+};
+
+}  // namespace grpc_core
+
+#endif /* GRPC_CORE_LIB_DEBUG_CALL_PHASE_TRACER_H */
@@ -0,0 +1,176 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/debug/network_latency.h"
+
+#include <algorithm>
+#include <map>
+#include <vector>
+
+#include <grpc/support/time.h>
+
+namespace grpc_core {
+
+namespace {
+
+// Calls to methods beyond this many are aggregated under one label.
+constexpr size_t kMaxMethods = 128;
+constexpr char kOtherMethods[] = "other";
+// The label of server calls whose method is not known yet.
+constexpr char kUnknownMethod[] = "unknown";
+
+struct MethodHistograms {
+  Mutex mu;
+  std::map<std::string, std::vector<CallPhaseTracer::Histogram>> histograms;
+};
+
+// Created on first use and never destroyed, since timestamps may arrive
+// during or after grpc_shutdown().
+MethodHistograms* GetMethodHistograms() {
+  static MethodHistograms* method_histograms = new MethodHistograms();
+  return method_histograms;
+}
+
+// Returns the microseconds from \a start to \a end, or 0 if the clocks went
+// backwards.
+int64_t MicrosBetween(gpr_timespec start, gpr_timespec end) {
+  const double micros = gpr_timespec_to_micros(gpr_time_sub(end, start));
+  return micros > 0 ? static_cast<int64_t>(micros) : 0;
+}
+
+}  // namespace
+
+const char* NetworkLatencyStageName(NetworkLatencyStage stage) {
+  switch (stage) {
+    case NetworkLatencyStage::kQueuedInKernel:
+      return "queued_in_kernel";
+    case NetworkLatencyStage::kOnWire:
+      return "on_wire";
+    case NetworkLatencyStage::kUntilAcked:
+      return "until_acked";
+    case NetworkLatencyStage::kNumStages:
+      break;
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+//
+// ConnectionNetworkLatency
+//
+
+void ConnectionNetworkLatency::Record(
+    const int64_t (&latency)[kNumNetworkLatencyStages]) {
+  MutexLock lock(&mu_);
+  for (int i = 0; i < kNumNetworkLatencyStages; i++) {
+    histograms_[i].Add(latency[i]);
+  }
+}
+
+void ConnectionNetworkLatency::ForEachStage(
+    const std::function<void(NetworkLatencyStage stage,
+                             const CallPhaseTracer::Histogram& histogram)>& f) {
+  MutexLock lock(&mu_);
+  for (int i = 0; i < kNumNetworkLatencyStages; i++) {
+    if (histograms_[i].count() > 0) {
+      f(static_cast<NetworkLatencyStage>(i), histograms_[i]);
+    }
+  }
+}
+
+//
+// CallNetworkLatency
+//
+
+RefCountedPtr<CallNetworkLatency> CallNetworkLatency::MaybeCreate(
+    int32_t sample_rate, gpr_atm* call_count) {
+  if (sample_rate <= 0) return nullptr;
+  if (gpr_atm_no_barrier_fetch_add(call_count, 1) % sample_rate != 0) {
+    return nullptr;
+  }
+  return MakeRefCounted<CallNetworkLatency>();
+}
+
+void CallNetworkLatency::Destroy(void* latency) {
+  static_cast<CallNetworkLatency*>(latency)->Unref();
+}
+
+void CallNetworkLatency::SetMethod(std::string method) {
+  MutexLock lock(&mu_);
+  method_ = std::move(method);
+}
+
+void CallNetworkLatency::RecordWrite(const Timestamps& ts,
+                                     ConnectionNetworkLatency* connection) {
+  int64_t latency[kNumNetworkLatencyStages];
+  latency[static_cast<int>(NetworkLatencyStage::kQueuedInKernel)] =
+      MicrosBetween(ts.sendmsg_time.time, ts.sent_time.time);
+  latency[static_cast<int>(NetworkLatencyStage::kOnWire)] =
+      MicrosBetween(ts.sent_time.time, ts.acked_time.time);
+  latency[static_cast<int>(NetworkLatencyStage::kUntilAcked)] =
+      MicrosBetween(ts.sendmsg_time.time, ts.acked_time.time);
+  std::string method;
+  {
+    MutexLock lock(&mu_);
+    stats_.traced_writes++;
+    for (int i = 0; i < kNumNetworkLatencyStages; i++) {
+      stats_.total_us[i] += latency[i];
+      stats_.max_us[i] = std::max(stats_.max_us[i], latency[i]);
+    }
+    method = method_.empty() ? kUnknownMethod : method_;
+  }
+  if (connection != nullptr) connection->Record(latency);
+  MethodHistograms* method_histograms = GetMethodHistograms();
+  MutexLock lock(&method_histograms->mu);
+  auto it = method_histograms->histograms.find(method);
+  if (it == method_histograms->histograms.end()) {
+    if (method_histograms->histograms.size() >= kMaxMethods) {
+      method = kOtherMethods;
+    }
+    it = method_histograms->histograms
+             .emplace(method, std::vector<CallPhaseTracer::Histogram>(
+                                  kNumNetworkLatencyStages))
+             .first;
+  }
+  for (int i = 0; i < kNumNetworkLatencyStages; i++) {
+    it->second[i].Add(latency[i]);
+  }
+}
+
+CallNetworkLatency::Stats CallNetworkLatency::stats() {
+  MutexLock lock(&mu_);
+  return stats_;
+}
+
+void CallNetworkLatency::ForEachMethodHistogram(
+    const std::function<void(const std::string& method,
+                             NetworkLatencyStage stage,
+                             const CallPhaseTracer::Histogram& histogram)>& f) {
+  MethodHistograms* method_histograms = GetMethodHistograms();
+  MutexLock lock(&method_histograms->mu);
+  for (const auto& p : method_histograms->histograms) {
+    for (int i = 0; i < kNumNetworkLatencyStages; i++) {
+      if (p.second[i].count() > 0) {
+        f(p.first, static_cast<NetworkLatencyStage>(i), p.second[i]);
+      }
+    }
+  }
+}
+
+}  // namespace grpc_core
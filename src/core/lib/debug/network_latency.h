@@ -0,0 +1,129 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_DEBUG_NETWORK_LATENCY_H
+#define GRPC_CORE_LIB_DEBUG_NETWORK_LATENCY_H
+
+#include <grpc/support/port_platform.h>
+
+#include <stdint.h>
+
+#include <functional>
+#include <string>
+
+#include "src/core/lib/channel/context.h"
+#include "src/core/lib/debug/call_phase_tracer.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/buffer_list.h"
+
+namespace grpc_core {
+
+// Stages of a write traced with kernel timestamps (SCM_TIMESTAMPING).
+enum class NetworkLatencyStage {
+  // From sendmsg() until the kernel handed the last byte to the NIC: time
+  // spent in the socket's send buffer and in the packet scheduler.
+  kQueuedInKernel,
+  // From the NIC handoff until the peer acked the last byte.
+  kOnWire,
+  // From sendmsg() until the peer acked the last byte.
+  kUntilAcked,
+  kNumStages,
+};
+
+const char* NetworkLatencyStageName(NetworkLatencyStage stage);
+
+constexpr int kNumNetworkLatencyStages =
+    static_cast<int>(NetworkLatencyStage::kNumStages);
+
+// Network latency histograms of one connection, rendered by its channelz
+// socket. Latencies are in microseconds.
+class ConnectionNetworkLatency : public RefCounted<ConnectionNetworkLatency> {
+ public:
+  void Record(const int64_t (&latency)[kNumNetworkLatencyStages]);
+
+  // Calls \a f with every stage that has been recorded.
+  void ForEachStage(
+      const std::function<void(NetworkLatencyStage stage,
+                               const CallPhaseTracer::Histogram& histogram)>&
+          f);
+
+ private:
+  Mutex mu_;
+  CallPhaseTracer::Histogram histograms_[kNumNetworkLatencyStages];
+};
+
+// The network latency of one sampled RPC's writes. It is created with the
+// call, stored in GRPC_CONTEXT_NETWORK_LATENCY, and referenced by each of the
+// call's writes that the transport traces, since their timestamps usually
+// arrive after the write completes and may arrive after the call is gone.
+class CallNetworkLatency : public RefCounted<CallNetworkLatency> {
+ public:
+  struct Stats {
+    // Number of writes whose timestamps have arrived.
+    int64_t traced_writes = 0;
+    // For each stage, the total and the largest latency of those writes, in
+    // microseconds.
+    int64_t total_us[kNumNetworkLatencyStages] = {};
+    int64_t max_us[kNumNetworkLatencyStages] = {};
+  };
+
+  // Returns a new instance for 1 in \a sample_rate calls, as counted by
+  // \a call_count, and nullptr for the others or if \a sample_rate is 0.
+  static RefCountedPtr<CallNetworkLatency> MaybeCreate(
+      int32_t sample_rate, gpr_atm* call_count);
+
+  // Returns the instance of the call owning \a context, if it is sampled.
+  static CallNetworkLatency* FromContext(
+      const grpc_call_context_element* context) {
+    if (context == nullptr) return nullptr;
+    return static_cast<CallNetworkLatency*>(
+        context[GRPC_CONTEXT_NETWORK_LATENCY].value);
+  }
+
+  // The context destroy function: drops the call's ref.
+  static void Destroy(void* latency);
+
+  // Sets the method that the per-method histograms are keyed by. Server calls
+  // only learn it after they are created.
+  void SetMethod(std::string method);
+
+  // Records the timestamps of one of the call's writes into the call's stats,
+  // the per-method histograms and \a connection, if not null.
+  void RecordWrite(const Timestamps& ts, ConnectionNetworkLatency* connection);
+
+  Stats stats();
+
+  // Calls \a f with every method and stage that has been recorded, in method
+  // order. Latencies are in microseconds.
+  static void ForEachMethodHistogram(
+      const std::function<void(const std::string& method,
+                               NetworkLatencyStage stage,
+                               const CallPhaseTracer::Histogram& histogram)>&
+          f);
+
+ private:
+  Mutex mu_;
+  std::string method_;
+  Stats stats_;
+};
+
+}  // namespace grpc_core
+
+#endif /* GRPC_CORE_LIB_DEBUG_NETWORK_LATENCY_H */
@@ -20,19 +20,26 @@
 
 #include "src/core/lib/debug/stats.h"
 
+#include <ctype.h>
 #include <inttypes.h>
 #include <string.h>
 
+#include <algorithm>
+#include <map>
 #include <vector>
 
+#include "absl/strings/str_cat.h"
 #include "absl/strings/str_format.h"
 #include "absl/strings/str_join.h"
 
 #include <grpc/support/alloc.h>
 #include <grpc/support/string_util.h>
 
+#include "src/core/lib/debug/call_phase_tracer.h"
+#include "src/core/lib/debug/network_latency.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/sync.h"
 
 grpc_stats_data* grpc_stats_per_cpu_storage = nullptr;
 static size_t g_num_cores;
@@ -170,3 +177,200 @@ std::string grpc_stats_data_as_json(const grpc_stats_data* data) {
   parts.push_back("}");
   return absl::StrJoin(parts, "");
 }
+
+namespace {
+
+// Registry of grpc_core::StatsCounter objects. Counters may be created before
+// grpc_init(), so it is created on first use and never destroyed.
+struct CounterRegistry {
+  grpc_core::Mutex mu;
+  std::vector<const grpc_core::StatsCounter*> counters;
+};
+
+CounterRegistry* GetCounterRegistry() {
+  static CounterRegistry* registry = new CounterRegistry();
+  return registry;
+}
+
+std::string OpenMetricsName(std::string name) {
+  for (size_t i = 0; i < name.size(); i++) {
+    unsigned char c = static_cast<unsigned char>(name[i]);
+    if (!(isalpha(c) || c == '_' || c == ':' || (i > 0 && isdigit(c)))) {
+      name[i] = '_';
+    }
+  }
+  if (name.empty()) name = "_";
+  return name;
+}
+
+std::string OpenMetricsEscape(const std::string& text) {
+  std::string escaped;
+  for (char c : text) {
+    switch (c) {
+      case '\\':
+        escaped += "\\\\";
+        break;
+      case '"':
+        escaped += "\\\"";
+        break;
+      case '\n':
+        escaped += "\\n";
+        break;
+      default:
+        escaped += c;
+    }
+  }
+  return escaped;
+}
+
+void AddOpenMetricsCounter(std::vector<std::string>* parts,
+                           const std::string& name, const std::string& help,
+                           int64_t value) {
+  parts->push_back(absl::StrCat("# TYPE ", name, " counter\n"));
+  parts->push_back(
+      absl::StrCat("# HELP ", name, " ", OpenMetricsEscape(help), "\n"));
+  parts->push_back(absl::StrCat(name, "_total ", value, "\n"));
+}
+
+// Appends the quantiles, sum and count of \a histogram, whose values are in
+// microseconds, as the sample of summary \a name with \a labels. The family's
+// metadata is appended first if \a *has_samples is false, and it is set.
+void AddOpenMetricsSummary(
+    std::vector<std::string>* parts, const char* name, const char* help,
+    const std::string& labels,
+    const grpc_core::CallPhaseTracer::Histogram& histogram,
+    bool* has_samples) {
+  if (!*has_samples) {
+    *has_samples = true;
+    parts->push_back(absl::StrCat("# TYPE ", name, " summary\n"));
+    parts->push_back(absl::StrCat("# UNIT ", name, " seconds\n"));
+    parts->push_back(absl::StrCat("# HELP ", name, " ", help, "\n"));
+  }
+  for (double quantile : {0.5, 0.9, 0.99, 0.999}) {
+    parts->push_back(absl::StrCat(
+        name, "{", labels, ",quantile=\"", quantile, "\"} ",
+        static_cast<double>(histogram.Quantile(quantile)) / 1e6, "\n"));
+  }
+  parts->push_back(absl::StrCat(name, "_sum{", labels, "} ",
+                                static_cast<double>(histogram.sum()) / 1e6,
+                                "\n"));
+  parts->push_back(
+      absl::StrCat(name, "_count{", labels, "} ", histogram.count(), "\n"));
+}
+
+}  // namespace
+
+std::string grpc_stats_data_as_openmetrics(const grpc_stats_data* data) {
+  std::vector<std::string> parts;
+  for (size_t i = 0; i < GRPC_STATS_COUNTER_COUNT; i++) {
+    AddOpenMetricsCounter(&parts,
+                          absl::StrCat("grpc_", grpc_stats_counter_name[i]),
+                          grpc_stats_counter_doc[i], data->counters[i]);
+  }
+  for (size_t i = 0; i < GRPC_STATS_HISTOGRAM_COUNT; i++) {
+    std::string name = absl::StrCat("grpc_", grpc_stats_histogram_name[i]);
+    parts.push_back(absl::StrCat("# TYPE ", name, " histogram\n"));
+    parts.push_back(absl::StrCat("# HELP ", name, " ",
+                                 OpenMetricsEscape(grpc_stats_histogram_doc[i]),
+                                 "\n"));
+    // Bucket j counts integer values in [boundary[j], boundary[j + 1]), so
+    // its upper bound is boundary[j + 1] - 1. The last bucket is unbounded.
+    const int num_buckets = grpc_stats_histo_buckets[i];
+    const int* boundaries = grpc_stats_histo_bucket_boundaries[i];
+    int64_t cumulative = 0;
+    for (int j = 0; j < num_buckets; j++) {
+      cumulative += data->histograms[grpc_stats_histo_start[i] + j];
+      std::string le = j + 1 < num_buckets
+                           ? absl::StrCat(boundaries[j + 1] - 1)
+                           : std::string("+Inf");
+      parts.push_back(
+          absl::StrCat(name, "_bucket{le=\"", le, "\"} ", cumulative, "\n"));
+    }
+  }
+  // Quantiles of the time from the creation of sampled client calls to each
+  // of their phases.
+  bool has_call_phases = false;
+  grpc_core::CallPhaseTracer::ForEachHistogram(
+      [&parts, &has_call_phases](
+          const std::string& method, grpc_core::CallPhase phase,
+          const grpc_core::CallPhaseTracer::Histogram& histogram) {
+        AddOpenMetricsSummary(
+            &parts, "grpc_call_phase_latency_seconds",
+            "Time from the creation of sampled client calls to each phase of "
+            "their lifecycle.",
+            absl::StrCat("method=\"", OpenMetricsEscape(method),
+                         "\",phase=\"", grpc_core::CallPhaseName(phase), "\""),
+            histogram, &has_call_phases);
+      });
+  AddOpenMetricsCounter(&parts, "grpc_call_phase_traces_dropped",
+                        "Call phase traces dropped because a thread's buffer "
+                        "was full.",
+                        grpc_core::CallPhaseTracer::dropped());
+  // Quantiles of the kernel-measured latency of the writes of calls sampled
+  // by GRPC_ARG_TCP_TRACING_ENABLED.
+  bool has_network_latency = false;
+  grpc_core::CallNetworkLatency::ForEachMethodHistogram(
+      [&parts, &has_network_latency](
+          const std::string& method, grpc_core::NetworkLatencyStage stage,
+          const grpc_core::CallPhaseTracer::Histogram& histogram) {
+        AddOpenMetricsSummary(
+            &parts, "grpc_network_latency_seconds",
+            "Kernel-measured latency of the writes of sampled calls, from "
+            "sendmsg() to the NIC and to the peer's ack.",
+            absl::StrCat("method=\"", OpenMetricsEscape(method),
+                         "\",stage=\"",
+                         grpc_core::NetworkLatencyStageName(stage), "\""),
+            histogram, &has_network_latency);
+      });
+  // Sum the registered counters by name, so that each family appears once.
+  std::map<std::string, std::pair<std::string, int64_t>> registered;
+  {
+    CounterRegistry* registry = GetCounterRegistry();
+    grpc_core::MutexLock lock(&registry->mu);
+    for (const grpc_core::StatsCounter* counter : registry->counters) {
+      auto it = registered.emplace(counter->name(),
+                                   std::make_pair(counter->help(), 0)).first;
+      it->second.second += counter->Value();
+    }
+  }
+  for (const auto& p : registered) {
+    AddOpenMetricsCounter(&parts, p.first, p.second.first, p.second.second);
+  }
+  parts.push_back("# EOF\n");
+  return absl::StrJoin(parts, "");
+}
+
+namespace grpc_core {
+
+StatsCounter::StatsCounter(std::string name, std::string help)
+    : name_(OpenMetricsName(std::move(name))),
+      help_(std::move(help)),
+      num_cells_(GPR_MAX(1, gpr_cpu_num_cores())),
+      cells_(static_cast<Cell*>(
+          gpr_malloc_aligned(num_cells_ * sizeof(Cell), GPR_CACHELINE_SIZE))) {
+  for (size_t i = 0; i < num_cells_; i++) new (&cells_[i]) Cell();
+  CounterRegistry* registry = GetCounterRegistry();
+  MutexLock lock(&registry->mu);
+  registry->counters.push_back(this);
+}
+
+StatsCounter::~StatsCounter() {
+  {
+    CounterRegistry* registry = GetCounterRegistry();
+    MutexLock lock(&registry->mu);
+    registry->counters.erase(std::find(registry->counters.begin(),
+                                       registry->counters.end(), this));
+  }
+  for (size_t i = 0; i < num_cells_; i++) cells_[i].~Cell();
+  gpr_free_aligned(cells_);
+}
+
+int64_t StatsCounter::Value() const {
+  int64_t value = 0;
+  for (size_t i = 0; i < num_cells_; i++) {
+    value += cells_[i].value.Load(MemoryOrder::RELAXED);
+  }
+  return value;
+}
+
+}  // namespace grpc_core
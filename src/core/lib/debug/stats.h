@@ -24,7 +24,9 @@
 #include <string>
 
 #include <grpc/support/atm.h>
+#include <grpc/support/cpu.h>
 #include "src/core/lib/debug/stats_data.h"
+#include "src/core/lib/gprpp/atomic.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 
 typedef struct grpc_stats_data {
@@ -67,4 +69,55 @@ double grpc_stats_histo_percentile(const grpc_stats_data* stats,
 size_t grpc_stats_histo_count(const grpc_stats_data* stats,
                               grpc_stats_histograms histogram);
 
+/* Renders \a data, followed by the call phase latencies collected by
+   grpc_core::CallPhaseTracer, the per-method network latencies collected by
+   grpc_core::CallNetworkLatency and the current values of all registered
+   grpc_core::StatsCounter objects, in the OpenMetrics text exposition format.
+   Counters and histograms are prefixed with "grpc_". Histograms have no sum,
+   since only bucket counts are kept. */
+std::string grpc_stats_data_as_openmetrics(const grpc_stats_data* data);
+
+namespace grpc_core {
+
+// A counter registered at runtime, for example by an application, that is
+// exported along with the built-in counters.
+//
+// Like the built-in counters, it is kept per-CPU: Increment() touches only
+// the current CPU's cache line, and Value() sums the CPUs' cells without
+// locking. Unlike them, it is collected in all builds.
+class StatsCounter {
+ public:
+  // \a name is sanitized to a valid OpenMetrics name. Counters with the same
+  // name are exported as one, with their values summed.
+  StatsCounter(std::string name, std::string help);
+  ~StatsCounter();
+
+  StatsCounter(const StatsCounter&) = delete;
+  StatsCounter& operator=(const StatsCounter&) = delete;
+
+  const std::string& name() const { return name_; }
+  const std::string& help() const { return help_; }
+
+  void Increment(int64_t delta = 1) {
+    cells_[gpr_cpu_current_cpu() % num_cells_].value.FetchAdd(
+        delta, MemoryOrder::RELAXED);
+  }
+
+  int64_t Value() const;
+
+ private:
+  struct Cell {
+    Atomic<int64_t> value{0};
+    char padding[GPR_CACHELINE_SIZE - sizeof(Atomic<int64_t>)];
+  };
+
+  const std::string name_;
+  const std::string help_;
+  const size_t num_cells_;
+  // One cell per CPU, each on its own cache line.
+  Cell* cells_;
+};
+
+}  // namespace grpc_core
+
 #endif
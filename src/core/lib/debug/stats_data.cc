@@ -124,6 +124,7 @@ const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT] = {
     "cq_ev_queue_trylock_failures",
     "cq_ev_queue_trylock_successes",
     "cq_ev_queue_transient_pop_failures",
+    "security_handshake_queue_timeouts",
 };
 const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "Number of client side calls created by this process",
@@ -251,6 +252,8 @@ const char* grpc_stats_counter_doc[GRPC_STATS_COUNTER_COUNT] = {
     "queue.",
     "Number of times NULL was popped out of completion queue's event queue "
     "even though the event queue was not empty",
+    "Number of offloaded security handshakes that failed because they waited "
+    "longer than the queue timeout to be admitted",
 };
 const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "call_initial_size",
@@ -266,6 +269,8 @@ const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT] = {
     "http2_send_trailing_metadata_per_write",
     "http2_send_flowctl_per_write",
     "server_cqs_checked",
+    "security_handshake_queue_time",
+    "security_handshake_time",
 };
 const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     "Initial size of the grpc_call arena created at call start",
@@ -283,6 +288,9 @@ const char* grpc_stats_histogram_doc[GRPC_STATS_HISTOGRAM_COUNT] = {
     // NOLINTNEXTLINE(bugprone-suspicious-missing-comma)
     "How many completion queues were checked looking for a CQ that had "
     "requested the incoming call",
+    "Time in microseconds that an offloaded security handshake waited to be "
+    "admitted to the handshake offload pool",
+    "Time in microseconds taken by a successful security handshake",
 };
 const int grpc_stats_table_0[65] = {
     0,      1,      2,      3,      4,     5,     7,     9,     11,    14,
@@ -351,6 +359,22 @@ const uint8_t grpc_stats_table_7[102] = {
     42, 42, 43, 44, 44, 45, 46, 46, 47, 48, 48, 49, 49, 50, 50, 51, 51};
 const int grpc_stats_table_8[9] = {0, 1, 2, 4, 7, 13, 23, 39, 64};
 const uint8_t grpc_stats_table_9[9] = {0, 0, 1, 2, 2, 3, 4, 4, 5};
+const int grpc_stats_table_10[65] = {
+    0,        1,       2,       3,       4,       6,       8,       11,
+    14,       18,      23,      30,      39,      50,      64,      82,
+    105,      134,     171,     218,     277,     352,     447,     568,
+    721,      916,     1163,    1477,    1875,    2380,    3021,    3835,
+    4868,     6179,    7843,    9955,    12635,   16036,   20353,   25832,
+    32785,    41610,   52810,   67024,   85064,   107959,  137017,  173895,
+    220699,   280100,  355489,  451169,  572601,  726716,  922311,  1170550,
+    1485602,  1885449, 2392914, 3036962, 3854353, 4891743, 6208344, 7879305,
+    10000000};
+const uint8_t grpc_stats_table_11[83] = {
+    0,  0,  1,  1,  2,  3,  3,  4,  5,  6,  6,  7,  8,  8,  9,  9,  10, 11,
+    12, 12, 13, 14, 15, 15, 16, 17, 18, 18, 19, 20, 20, 21, 22, 23, 23, 24,
+    25, 26, 26, 27, 28, 28, 29, 30, 31, 31, 32, 33, 34, 34, 35, 35, 36, 37,
+    38, 38, 39, 40, 41, 41, 42, 43, 44, 44, 45, 46, 47, 47, 48, 49, 49, 50,
+    51, 52, 52, 53, 54, 55, 55, 56, 57, 58, 58};
 void grpc_stats_inc_call_initial_size(int value) {
   value = GPR_CLAMP(value, 0, 262144);
   if (value < 6) {
@@ -662,17 +686,67 @@ void grpc_stats_inc_server_cqs_checked(int value) {
       GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
       grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_8, 8));
 }
-const int grpc_stats_histo_buckets[13] = {64, 128, 64, 64, 64, 64, 64,
-                                          64, 64,  64, 64, 64, 8};
-const int grpc_stats_histo_start[13] = {0,   64,  192, 256, 320, 384, 448,
-                                        512, 576, 640, 704, 768, 832};
-const int* const grpc_stats_histo_bucket_boundaries[13] = {
+void grpc_stats_inc_security_handshake_queue_time(int value) {
+  value = GPR_CLAMP(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME, value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(
+        GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME, bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+void grpc_stats_inc_security_handshake_time(int value) {
+  value = GPR_CLAMP(value, 0, 10000000);
+  if (value < 5) {
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME,
+                             value);
+    return;
+  }
+  union {
+    double dbl;
+    uint64_t uint;
+  } _val, _bkt;
+  _val.dbl = value;
+  if (_val.uint < 4682617712558473216ull) {
+    int bucket =
+        grpc_stats_table_11[((_val.uint - 4617315517961601024ull) >> 50)] + 5;
+    _bkt.dbl = grpc_stats_table_10[bucket];
+    bucket -= (_val.uint < _bkt.uint);
+    GRPC_STATS_INC_HISTOGRAM(GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME,
+                             bucket);
+    return;
+  }
+  GRPC_STATS_INC_HISTOGRAM(
+      GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME,
+      grpc_stats_histo_find_bucket_slow(value, grpc_stats_table_10, 64));
+}
+const int grpc_stats_histo_buckets[15] = {64, 128, 64, 64, 64, 64, 64, 64,
+                                          64, 64,  64, 64, 8,  64, 64};
+const int grpc_stats_histo_start[15] = {0,   64,  192, 256, 320, 384, 448, 512,
+                                        576, 640, 704, 768, 832, 840, 904};
+const int* const grpc_stats_histo_bucket_boundaries[15] = {
     grpc_stats_table_0, grpc_stats_table_2, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_4,
     grpc_stats_table_6, grpc_stats_table_4, grpc_stats_table_6,
     grpc_stats_table_6, grpc_stats_table_6, grpc_stats_table_6,
-    grpc_stats_table_8};
-void (*const grpc_stats_inc_histogram[13])(int x) = {
+    grpc_stats_table_8, grpc_stats_table_10, grpc_stats_table_10};
+void (*const grpc_stats_inc_histogram[15])(int x) = {
     grpc_stats_inc_call_initial_size,
     grpc_stats_inc_poll_events_returned,
     grpc_stats_inc_tcp_write_size,
@@ -685,4 +759,6 @@ void (*const grpc_stats_inc_histogram[13])(int x) = {
     grpc_stats_inc_http2_send_message_per_write,
     grpc_stats_inc_http2_send_trailing_metadata_per_write,
     grpc_stats_inc_http2_send_flowctl_per_write,
-    grpc_stats_inc_server_cqs_checked};
+    grpc_stats_inc_server_cqs_checked,
+    grpc_stats_inc_security_handshake_queue_time,
+    grpc_stats_inc_security_handshake_time};
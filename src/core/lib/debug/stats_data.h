@@ -125,6 +125,7 @@ typedef enum {
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_FAILURES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES,
   GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES,
+  GRPC_STATS_COUNTER_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS,
   GRPC_STATS_COUNTER_COUNT
 } grpc_stats_counters;
 extern const char* grpc_stats_counter_name[GRPC_STATS_COUNTER_COUNT];
@@ -143,6 +144,8 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_TRAILING_METADATA_PER_WRITE,
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED,
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME,
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME,
   GRPC_STATS_HISTOGRAM_COUNT
 } grpc_stats_histograms;
 extern const char* grpc_stats_histogram_name[GRPC_STATS_HISTOGRAM_COUNT];
@@ -174,7 +177,11 @@ typedef enum {
   GRPC_STATS_HISTOGRAM_HTTP2_SEND_FLOWCTL_PER_WRITE_BUCKETS = 64,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_FIRST_SLOT = 832,
   GRPC_STATS_HISTOGRAM_SERVER_CQS_CHECKED_BUCKETS = 8,
-  GRPC_STATS_HISTOGRAM_BUCKETS = 840
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME_FIRST_SLOT = 840,
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME_FIRST_SLOT = 904,
+  GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_TIME_BUCKETS = 64,
+  GRPC_STATS_HISTOGRAM_BUCKETS = 968
 } grpc_stats_histogram_constants;
 #if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED() \
@@ -395,6 +402,8 @@ typedef enum {
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRYLOCK_SUCCESSES)
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES() \
   GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES)
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS() \
+  GRPC_STATS_INC_COUNTER(GRPC_STATS_COUNTER_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS)
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value) \
   grpc_stats_inc_call_initial_size((int)(value))
 void grpc_stats_inc_call_initial_size(int value);
@@ -434,6 +443,12 @@ void grpc_stats_inc_http2_send_flowctl_per_write(int value);
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value) \
   grpc_stats_inc_server_cqs_checked((int)(value))
 void grpc_stats_inc_server_cqs_checked(int value);
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIME(value) \
+  grpc_stats_inc_security_handshake_queue_time((int)(value))
+void grpc_stats_inc_security_handshake_queue_time(int value);
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_TIME(value) \
+  grpc_stats_inc_security_handshake_time((int)(value))
+void grpc_stats_inc_security_handshake_time(int value);
 #else
 #define GRPC_STATS_INC_CLIENT_CALLS_CREATED()
 #define GRPC_STATS_INC_SERVER_CALLS_CREATED()
@@ -533,6 +548,7 @@ void grpc_stats_inc_server_cqs_checked(int value);
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_FAILURES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRYLOCK_SUCCESSES()
 #define GRPC_STATS_INC_CQ_EV_QUEUE_TRANSIENT_POP_FAILURES()
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS()
 #define GRPC_STATS_INC_CALL_INITIAL_SIZE(value)
 #define GRPC_STATS_INC_POLL_EVENTS_RETURNED(value)
 #define GRPC_STATS_INC_TCP_WRITE_SIZE(value)
@@ -546,10 +562,12 @@ void grpc_stats_inc_server_cqs_checked(int value);
 #define GRPC_STATS_INC_HTTP2_SEND_TRAILING_METADATA_PER_WRITE(value)
 #define GRPC_STATS_INC_HTTP2_SEND_FLOWCTL_PER_WRITE(value)
 #define GRPC_STATS_INC_SERVER_CQS_CHECKED(value)
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIME(value)
+#define GRPC_STATS_INC_SECURITY_HANDSHAKE_TIME(value)
 #endif /* defined(GRPC_COLLECT_STATS) || !defined(NDEBUG) */
-extern const int grpc_stats_histo_buckets[13];
-extern const int grpc_stats_histo_start[13];
-extern const int* const grpc_stats_histo_bucket_boundaries[13];
-extern void (*const grpc_stats_inc_histogram[13])(int x);
+extern const int grpc_stats_histo_buckets[15];
+extern const int grpc_stats_histo_start[15];
+extern const int* const grpc_stats_histo_bucket_boundaries[15];
+extern void (*const grpc_stats_inc_histogram[15])(int x);
 
 #endif /* GRPC_CORE_LIB_DEBUG_STATS_DATA_H */
@@ -95,4 +95,5 @@ server_requested_calls_per_iteration:FLOAT,
 server_slowpath_requests_queued_per_iteration:FLOAT,
 cq_ev_queue_trylock_failures_per_iteration:FLOAT,
 cq_ev_queue_trylock_successes_per_iteration:FLOAT,
-cq_ev_queue_transient_pop_failures_per_iteration:FLOAT
+cq_ev_queue_transient_pop_failures_per_iteration:FLOAT,
+security_handshake_queue_timeouts_per_iteration:FLOAT
@@ -63,6 +63,9 @@ typedef enum {
 #define GRPC_IAM_AUTHORITY_SELECTOR_METADATA_KEY "x-goog-iam-authority-selector"
 
 #define GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS 60
+/* Cached tokens are refreshed in the background starting up to this long
+   before they stop being used. */
+#define GRPC_SECURE_TOKEN_BACKGROUND_REFRESH_SECS 300
 
 #define GRPC_COMPUTE_ENGINE_METADATA_HOST "metadata.google.internal."
 #define GRPC_COMPUTE_ENGINE_METADATA_TOKEN_PATH \
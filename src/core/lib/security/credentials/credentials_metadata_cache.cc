@@ -0,0 +1,216 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpc/support/port_platform.h>
+
+#include "src/core/lib/security/credentials/credentials_metadata_cache.h"
+
+#include <algorithm>
+#include <map>
+
+#include <openssl/sha.h>
+
+#include "absl/strings/escaping.h"
+#include "absl/strings/str_cat.h"
+
+#include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
+
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/security/credentials/credentials.h"
+
+namespace grpc_core {
+
+namespace {
+
+// The registry of shared entries is split into independently locked shards,
+// so that creating credentials for different keys rarely contends.
+constexpr size_t kNumRegistryShards = 16;
+
+struct RegistryShard {
+  Mutex mu;
+  std::map<std::string, CredentialsMetadataCache::Entry*> entries;
+};
+
+RegistryShard& RegistryShardFor(const std::string& key) {
+  static RegistryShard* shards = new RegistryShard[kNumRegistryShards];
+  return shards[std::hash<std::string>()(key) % kNumRegistryShards];
+}
+
+// Orders the tokens of a snapshot by audience.
+struct AudienceLess {
+  template <typename T>
+  bool operator()(const std::pair<std::string, T>& token,
+                  absl::string_view audience) const {
+    return absl::string_view(token.first) < audience;
+  }
+  template <typename T>
+  bool operator()(const std::pair<std::string, T>& a,
+                  const std::pair<std::string, T>& b) const {
+    return a.first < b.first;
+  }
+};
+
+}  // namespace
+
+//
+// CredentialsMetadataCache::Entry
+//
+
+CredentialsMetadataCache::Entry::Entry(std::string key)
+    : key_(std::move(key)),
+      num_reader_cells_(GPR_MAX(1, gpr_cpu_num_cores())),
+      reader_cells_(static_cast<ReaderCell*>(gpr_malloc_aligned(
+          num_reader_cells_ * sizeof(ReaderCell), GPR_CACHELINE_SIZE))),
+      snapshot_(new Snapshot()) {
+  for (size_t i = 0; i < num_reader_cells_; i++) {
+    new (&reader_cells_[i]) ReaderCell();
+  }
+}
+
+CredentialsMetadataCache::Entry::~Entry() {
+  if (registered_) {
+    RegistryShard& shard = RegistryShardFor(key_);
+    MutexLock lock(&shard.mu);
+    auto it = shard.entries.find(key_);
+    // The key may already belong to a new entry that was created while this
+    // one was being destroyed.
+    if (it != shard.entries.end() && it->second == this) {
+      shard.entries.erase(it);
+    }
+  }
+  // No lookups can be in progress once the last ref is gone.
+  const Snapshot* snapshot = snapshot_.load(std::memory_order_relaxed);
+  for (const auto& p : *snapshot) delete p.second;
+  delete snapshot;
+  for (const Snapshot* s : retired_snapshots_) delete s;
+  for (Token* token : retired_tokens_) delete token;
+  for (size_t i = 0; i < num_reader_cells_; i++) {
+    reader_cells_[i].~ReaderCell();
+  }
+  gpr_free_aligned(reader_cells_);
+}
+
+CredentialsMetadataCache::Entry::Result CredentialsMetadataCache::Entry::Get(
+    absl::string_view audience, grpc_mdelem* md) {
+  const grpc_millis now = ExecCtx::Get()->Now();
+  Result result = Result::kMiss;
+  // Registering as a reader before loading the snapshot keeps writers from
+  // freeing it, or any token in it, until the reader is done. The same cell
+  // is decremented even if the thread moves to another CPU meanwhile.
+  ReaderCell& cell =
+      reader_cells_[gpr_cpu_current_cpu() % num_reader_cells_];
+  cell.count.fetch_add(1, std::memory_order_seq_cst);
+  const Snapshot* snapshot = snapshot_.load(std::memory_order_seq_cst);
+  auto it = std::lower_bound(snapshot->begin(), snapshot->end(), audience,
+                             AudienceLess());
+  if (it != snapshot->end() && it->first == audience &&
+      now < it->second->usable_until) {
+    Token* token = it->second;
+    *md = GRPC_MDELEM_REF(token->md);
+    result = Result::kHit;
+    if (now >= token->refresh_time &&
+        !token->refresh_started.load(std::memory_order_relaxed) &&
+        !token->refresh_started.exchange(true, std::memory_order_relaxed)) {
+      result = Result::kHitRefresh;
+    }
+  }
+  cell.count.fetch_sub(1, std::memory_order_release);
+  return result;
+}
+
+void CredentialsMetadataCache::Entry::Put(absl::string_view audience,
+                                          grpc_mdelem md,
+                                          grpc_millis expiration) {
+  const grpc_millis now = ExecCtx::Get()->Now();
+  Token* token = new Token();
+  token->md = GRPC_MDELEM_REF(md);
+  token->usable_until =
+      expiration - GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS * GPR_MS_PER_SEC;
+  // Short-lived tokens start refreshing halfway through their usable life.
+  token->refresh_time =
+      token->usable_until -
+      std::min<grpc_millis>(
+          GRPC_SECURE_TOKEN_BACKGROUND_REFRESH_SECS * GPR_MS_PER_SEC,
+          std::max<grpc_millis>(0, (token->usable_until - now) / 2));
+  MutexLock lock(&mu_);
+  const Snapshot* old_snapshot = snapshot_.load(std::memory_order_relaxed);
+  Snapshot* snapshot = new Snapshot();
+  for (const auto& p : *old_snapshot) {
+    if (p.first == audience || p.second->usable_until <= now) {
+      retired_tokens_.push_back(p.second);
+    } else {
+      snapshot->push_back(p);
+    }
+  }
+  snapshot->emplace_back(std::string(audience), token);
+  std::sort(snapshot->begin(), snapshot->end(), AudienceLess());
+  snapshot_.store(snapshot, std::memory_order_seq_cst);
+  retired_snapshots_.push_back(old_snapshot);
+  ReclaimLocked();
+}
+
+void CredentialsMetadataCache::Entry::ReclaimLocked() {
+  // Any lookup that started before the retired data was unpublished is
+  // counted here until it is done. If some are in progress, the data is
+  // freed by a later Put() or by the destructor instead.
+  for (size_t i = 0; i < num_reader_cells_; i++) {
+    if (reader_cells_[i].count.load(std::memory_order_seq_cst) != 0) return;
+  }
+  for (const Snapshot* s : retired_snapshots_) delete s;
+  retired_snapshots_.clear();
+  for (Token* token : retired_tokens_) delete token;
+  retired_tokens_.clear();
+}
+
+//
+// CredentialsMetadataCache
+//
+
+std::string CredentialsMetadataCache::MakeKey(
+    absl::string_view type, std::initializer_list<absl::string_view> fields) {
+  std::string data;
+  for (absl::string_view field : fields) {
+    absl::StrAppend(&data, field.size(), ":", field);
+  }
+  uint8_t digest[SHA256_DIGEST_LENGTH];
+  SHA256(reinterpret_cast<const uint8_t*>(data.data()), data.size(), digest);
+  return absl::StrCat(
+      type, ":",
+      absl::BytesToHexString(absl::string_view(
+          reinterpret_cast<const char*>(digest), sizeof(digest))));
+}
+
+RefCountedPtr<CredentialsMetadataCache::Entry>
+CredentialsMetadataCache::GetOrCreateEntry(std::string key,
+                                           Entry* (*create)(std::string)) {
+  RegistryShard& shard = RegistryShardFor(key);
+  MutexLock lock(&shard.mu);
+  auto it = shard.entries.find(key);
+  if (it != shard.entries.end()) {
+    // The entry may be in the process of being destroyed.
+    RefCountedPtr<Entry> entry = it->second->RefIfNonZero();
+    if (entry != nullptr) return entry;
+  }
+  Entry* entry = create(std::move(key));
+  entry->registered_ = true;
+  shard.entries[entry->key()] = entry;
+  return RefCountedPtr<Entry>(entry);
+}
+
+}  // namespace grpc_core
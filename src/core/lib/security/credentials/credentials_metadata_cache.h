@@ -0,0 +1,150 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#ifndef GRPC_CORE_LIB_SECURITY_CREDENTIALS_CREDENTIALS_METADATA_CACHE_H
+#define GRPC_CORE_LIB_SECURITY_CREDENTIALS_CREDENTIALS_METADATA_CACHE_H
+
+#include <grpc/support/port_platform.h>
+
+#include <atomic>
+#include <functional>
+#include <initializer_list>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "absl/strings/string_view.h"
+
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/transport/metadata.h"
+
+namespace grpc_core {
+
+// A process-wide cache of the metadata that call credentials attach to calls.
+//
+// Call credentials objects that would produce the same metadata, such as
+// separately created credentials for the same service account, share an
+// entry by using the same key, so that a token is fetched or signed once per
+// process rather than once per credentials object.
+class CredentialsMetadataCache {
+ public:
+  // The tokens of one set of credentials, one per audience. Credentials whose
+  // token does not depend on the call use the empty audience.
+  //
+  // Looking up a token never blocks or allocates: the tokens are published
+  // as an immutable snapshot, which writers replace under a mutex. Replaced
+  // snapshots and tokens are freed once no lookup that may still be using
+  // them is in progress. Lookups are counted per CPU, so concurrent lookups
+  // on different CPUs do not write to a shared cache line.
+  class Entry : public RefCounted<Entry> {
+   public:
+    enum class Result {
+      // There is no usable token; the caller must get one and Put() it.
+      kMiss,
+      // The token is usable.
+      kHit,
+      // The token is usable, but is due to be refreshed. The caller should
+      // start a refresh in the background and Put() the new token. Only one
+      // lookup per token gets this result.
+      kHitRefresh,
+    };
+
+    explicit Entry(std::string key);
+    ~Entry() override;
+
+    const std::string& key() const { return key_; }
+
+    // Looks up the token for \a audience. Unless the result is kMiss, sets
+    // \a md to a new ref to the token's metadata.
+    Result Get(absl::string_view audience, grpc_mdelem* md);
+
+    // Makes \a md (taking a new ref) the token for \a audience. The token is
+    // used until GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS before \a
+    // expiration, and a background refresh is requested some time before
+    // that. Tokens of other audiences that are no longer usable are dropped.
+    void Put(absl::string_view audience, grpc_mdelem md,
+             grpc_millis expiration);
+
+   private:
+    friend class CredentialsMetadataCache;
+
+    struct Token {
+      ~Token() { GRPC_MDELEM_UNREF(md); }
+
+      grpc_mdelem md;
+      grpc_millis refresh_time;
+      grpc_millis usable_until;
+      std::atomic<bool> refresh_started{false};
+    };
+    // Sorted by audience, so that it can be searched for an
+    // absl::string_view without building a std::string.
+    using Snapshot = std::vector<std::pair<std::string, Token*>>;
+
+    // Counts the lookups in progress that started on one CPU.
+    struct ReaderCell {
+      std::atomic<intptr_t> count{0};
+      char padding[GPR_CACHELINE_SIZE - sizeof(std::atomic<intptr_t>)];
+    };
+
+    // Frees retired snapshots and tokens if no lookup is in progress.
+    void ReclaimLocked();
+
+    const std::string key_;
+    bool registered_ = false;
+    // One cell per CPU, each on its own cache line.
+    const size_t num_reader_cells_;
+    ReaderCell* reader_cells_;
+    std::atomic<const Snapshot*> snapshot_;
+
+    Mutex mu_;
+    std::vector<const Snapshot*> retired_snapshots_;
+    std::vector<Token*> retired_tokens_;
+  };
+
+  // Returns the key of the entry shared by credentials of \a type whose
+  // metadata is determined by \a fields. The fields are length-prefixed, so
+  // that different fields never produce the same key, and hashed, so that
+  // secrets in them are not kept in the process-wide registry.
+  static std::string MakeKey(absl::string_view type,
+                             std::initializer_list<absl::string_view> fields);
+
+  // Returns the entry for \a key, creating it with T's constructor (which
+  // takes the key) if there is none. Entries are shared for as long as any
+  // credentials object holds a ref. Entries with an empty key are never
+  // shared.
+  template <typename T>
+  static RefCountedPtr<T> GetOrCreate(std::string key) {
+    if (key.empty()) return MakeRefCounted<T>(std::move(key));
+    RefCountedPtr<Entry> entry = GetOrCreateEntry(
+        std::move(key), [](std::string k) -> Entry* {
+          return new T(std::move(k));
+        });
+    return RefCountedPtr<T>(static_cast<T*>(entry.release()));
+  }
+
+ private:
+  static RefCountedPtr<Entry> GetOrCreateEntry(std::string key,
+                                               Entry* (*create)(std::string));
+};
+
+}  // namespace grpc_core
+
+#endif /* GRPC_CORE_LIB_SECURITY_CREDENTIALS_CREDENTIALS_METADATA_CACHE_H */
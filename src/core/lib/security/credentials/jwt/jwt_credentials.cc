@@ -39,64 +39,98 @@
 
 using grpc_core::Json;
 
-void grpc_service_account_jwt_access_credentials::reset_cache() {
-  GRPC_MDELEM_UNREF(cached_.jwt_md);
-  cached_.jwt_md = GRPC_MDNULL;
-  if (cached_.service_url != nullptr) {
-    gpr_free(cached_.service_url);
-    cached_.service_url = nullptr;
-  }
-  cached_.jwt_expiration = gpr_inf_past(GPR_CLOCK_REALTIME);
-}
+// Serializes signing, so that concurrent calls that miss the cache for the
+// same service URL sign a single JWT.
+class grpc_service_account_jwt_access_credentials::TokenCache
+    : public grpc_core::CredentialsMetadataCache::Entry {
+ public:
+  explicit TokenCache(std::string key) : Entry(std::move(key)) {}
+
+  grpc_core::Mutex* signing_mu() { return &signing_mu_; }
+
+ private:
+  grpc_core::Mutex signing_mu_;
+};
+
+namespace {
+
+struct BackgroundRefresh {
+  grpc_core::RefCountedPtr<grpc_call_credentials> creds;
+  std::string service_url;
+};
+
+}  // namespace
 
 grpc_service_account_jwt_access_credentials::
     ~grpc_service_account_jwt_access_credentials() {
   grpc_auth_json_key_destruct(&key_);
-  reset_cache();
-  gpr_mu_destroy(&cache_mu_);
+}
+
+grpc_mdelem grpc_service_account_jwt_access_credentials::SignAndCacheJwt(
+    const char* service_url, bool only_if_missing) {
+  grpc_core::MutexLock lock(cache_->signing_mu());
+  if (only_if_missing) {
+    // Another call may have signed one while this one waited for the lock.
+    grpc_mdelem jwt_md = GRPC_MDNULL;
+    switch (cache_->Get(service_url, &jwt_md)) {
+      case grpc_core::CredentialsMetadataCache::Entry::Result::kHit:
+        return jwt_md;
+      case grpc_core::CredentialsMetadataCache::Entry::Result::kHitRefresh:
+        // Refresh it now rather than in the background.
+        GRPC_MDELEM_UNREF(jwt_md);
+        break;
+      case grpc_core::CredentialsMetadataCache::Entry::Result::kMiss:
+        break;
+    }
+  }
+  char* jwt =
+      grpc_jwt_encode_and_sign(&key_, service_url, jwt_lifetime_, nullptr);
+  if (jwt == nullptr) return GRPC_MDNULL;
+  std::string md_value = absl::StrCat("Bearer ", jwt);
+  gpr_free(jwt);
+  grpc_mdelem jwt_md = grpc_mdelem_from_slices(
+      grpc_slice_from_static_string(GRPC_AUTHORIZATION_METADATA_KEY),
+      grpc_slice_from_cpp_string(std::move(md_value)));
+  cache_->Put(service_url, jwt_md,
+              grpc_core::ExecCtx::Get()->Now() +
+                  jwt_lifetime_.tv_sec * GPR_MS_PER_SEC +
+                  jwt_lifetime_.tv_nsec / GPR_NS_PER_MS);
+  return jwt_md;
+}
+
+void grpc_service_account_jwt_access_credentials::OnBackgroundRefresh(
+    void* arg, grpc_error* /*error*/) {
+  BackgroundRefresh* refresh = static_cast<BackgroundRefresh*>(arg);
+  grpc_service_account_jwt_access_credentials* creds =
+      static_cast<grpc_service_account_jwt_access_credentials*>(
+          refresh->creds.get());
+  // On failure, the current JWT is used until it expires, and then signed
+  // again by the call that misses the cache.
+  GRPC_MDELEM_UNREF(creds->SignAndCacheJwt(refresh->service_url.c_str(),
+                                            /*only_if_missing=*/false));
+  delete refresh;
 }
 
 bool grpc_service_account_jwt_access_credentials::get_request_metadata(
     grpc_polling_entity* /*pollent*/, grpc_auth_metadata_context context,
     grpc_credentials_mdelem_array* md_array,
     grpc_closure* /*on_request_metadata*/, grpc_error** error) {
-  gpr_timespec refresh_threshold = gpr_time_from_seconds(
-      GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS, GPR_TIMESPAN);
-
-  /* See if we can return a cached jwt. */
+  using Result = grpc_core::CredentialsMetadataCache::Entry::Result;
+  /* See if we can return a cached jwt. This does not take any lock. */
   grpc_mdelem jwt_md = GRPC_MDNULL;
-  {
-    gpr_mu_lock(&cache_mu_);
-    if (cached_.service_url != nullptr &&
-        strcmp(cached_.service_url, context.service_url) == 0 &&
-        !GRPC_MDISNULL(cached_.jwt_md) &&
-        (gpr_time_cmp(
-             gpr_time_sub(cached_.jwt_expiration, gpr_now(GPR_CLOCK_REALTIME)),
-             refresh_threshold) > 0)) {
-      jwt_md = GRPC_MDELEM_REF(cached_.jwt_md);
-    }
-    gpr_mu_unlock(&cache_mu_);
-  }
-
-  if (GRPC_MDISNULL(jwt_md)) {
-    char* jwt = nullptr;
+  Result result = cache_->Get(context.service_url, &jwt_md);
+  if (result == Result::kHitRefresh) {
+    /* Sign the replacement once this call has its metadata. */
+    BackgroundRefresh* refresh = new BackgroundRefresh;
+    refresh->creds = Ref();
+    refresh->service_url = context.service_url;
+    grpc_core::ExecCtx::Run(
+        DEBUG_LOCATION,
+        GRPC_CLOSURE_CREATE(OnBackgroundRefresh, refresh, nullptr),
+        GRPC_ERROR_NONE);
+  } else if (result == Result::kMiss) {
     /* Generate a new jwt. */
-    gpr_mu_lock(&cache_mu_);
-    reset_cache();
-    jwt = grpc_jwt_encode_and_sign(&key_, context.service_url, jwt_lifetime_,
-                                   nullptr);
-    if (jwt != nullptr) {
-      std::string md_value = absl::StrCat("Bearer ", jwt);
-      gpr_free(jwt);
-      cached_.jwt_expiration =
-          gpr_time_add(gpr_now(GPR_CLOCK_REALTIME), jwt_lifetime_);
-      cached_.service_url = gpr_strdup(context.service_url);
-      cached_.jwt_md = grpc_mdelem_from_slices(
-          grpc_slice_from_static_string(GRPC_AUTHORIZATION_METADATA_KEY),
-          grpc_slice_from_cpp_string(std::move(md_value)));
-      jwt_md = GRPC_MDELEM_REF(cached_.jwt_md);
-    }
-    gpr_mu_unlock(&cache_mu_);
+    jwt_md = SignAndCacheJwt(context.service_url, /*only_if_missing=*/true);
   }
 
   if (!GRPC_MDISNULL(jwt_md)) {
@@ -125,8 +159,11 @@ grpc_service_account_jwt_access_credentials::
     token_lifetime = grpc_max_auth_token_lifetime();
   }
   jwt_lifetime_ = token_lifetime;
-  gpr_mu_init(&cache_mu_);
-  reset_cache();
+  cache_ = grpc_core::CredentialsMetadataCache::GetOrCreate<TokenCache>(
+      grpc_core::CredentialsMetadataCache::MakeKey(
+          "jwt", {key_.client_email, key_.private_key_id,
+                  absl::StrCat(jwt_lifetime_.tv_sec, ".",
+                               jwt_lifetime_.tv_nsec)}));
 }
 
 grpc_core::RefCountedPtr<grpc_call_credentials>
@@ -28,6 +28,7 @@
 #include "absl/strings/str_format.h"
 #include "absl/time/time.h"
 #include "src/core/lib/security/credentials/credentials.h"
+#include "src/core/lib/security/credentials/credentials_metadata_cache.h"
 #include "src/core/lib/security/credentials/jwt/json_token.h"
 
 class grpc_service_account_jwt_access_credentials
@@ -57,16 +58,17 @@ class grpc_service_account_jwt_access_credentials
   };
 
  private:
-  void reset_cache();
-
-  // Have a simple cache for now with just 1 entry. We could have a map based on
-  // the service_url for a more sophisticated one.
-  gpr_mu cache_mu_;
-  struct {
-    grpc_mdelem jwt_md = GRPC_MDNULL;
-    char* service_url = nullptr;
-    gpr_timespec jwt_expiration;
-  } cached_;
+  class TokenCache;
+
+  // Signs a JWT for \a service_url and adds it to the cache, unless \a
+  // only_if_missing is set and a usable one is already cached. Returns a ref
+  // to the JWT's metadata, or GRPC_MDNULL on failure.
+  grpc_mdelem SignAndCacheJwt(const char* service_url, bool only_if_missing);
+  static void OnBackgroundRefresh(void* arg, grpc_error* error);
+
+  // JWTs are cached per service URL, and shared with every other credentials
+  // object for the same key and lifetime.
+  grpc_core::RefCountedPtr<TokenCache> cache_;
 
   grpc_auth_json_key key_;
   gpr_timespec jwt_lifetime_;
@@ -23,6 +23,12 @@
 #include <limits.h>
 #include <string.h>
 
+#include <deque>
+#include <map>
+#include <string>
+#include <utility>
+#include <vector>
+
 #include <grpc/support/alloc.h>
 #include <grpc/support/log.h>
 #include <grpc/support/string_util.h>
@@ -32,10 +38,20 @@ extern "C" {
 #include <openssl/bn.h>
 #include <openssl/pem.h>
 #include <openssl/rsa.h>
+#include <openssl/sha.h>
 }
 
+#include "absl/strings/ascii.h"
+#include "absl/strings/match.h"
+#include "absl/strings/numbers.h"
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
+#include "src/core/lib/gprpp/ref_counted.h"
+#include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/http/httpcli.h"
 #include "src/core/lib/iomgr/polling_entity.h"
 #include "src/core/lib/slice/b64.h"
@@ -327,25 +343,244 @@ grpc_jwt_verifier_status grpc_jwt_claims_check(const grpc_jwt_claims* claims,
   return GRPC_JWT_VERIFIER_OK;
 }
 
-/* --- verifier_cb_ctx object. --- */
+/* --- Verifier cache. --- */
+
+struct verifier_cb_ctx;
+
+static EVP_PKEY* find_verification_key(const Json& json, const char* header_alg,
+                                       const char* header_kid);
+
+namespace grpc_core {
+namespace {
+
+// Maximum number of URLs, and of verified tokens, that are remembered.
+constexpr size_t kMaxCachedUrls = 256;
+constexpr size_t kMaxVerifiedTokens = 1024;
+
+// A cached key set that lacks a requested key is fetched again, in case the
+// issuer has rotated its keys, if it is at least this old.
+constexpr grpc_millis kKeySetMinRefetchInterval = 30 * GPR_MS_PER_SEC;
+
+// The keys fetched from one URL. Keys are parsed on first use.
+class JwtKeySet : public RefCounted<JwtKeySet> {
+ public:
+  JwtKeySet(Json json, grpc_millis fetch_time, grpc_millis expiration)
+      : json_(std::move(json)),
+        fetch_time_(fetch_time),
+        expiration_(expiration) {}
+
+  ~JwtKeySet() override {
+    for (const auto& p : keys_) EVP_PKEY_free(p.second);
+  }
+
+  grpc_millis fetch_time() const { return fetch_time_; }
+  grpc_millis expiration() const { return expiration_; }
+
+  // Returns the key for \a alg and \a kid, or nullptr if there is none. The
+  // key is owned by the key set. Only keys that are found are kept, so that
+  // tokens naming made up keys cannot grow the key set.
+  EVP_PKEY* Find(const char* alg, const char* kid) {
+    MutexLock lock(&mu_);
+    std::string name = absl::StrCat(alg, " ", kid);
+    auto it = keys_.find(name);
+    if (it != keys_.end()) return it->second;
+    EVP_PKEY* key = find_verification_key(json_, alg, kid);
+    if (key != nullptr) keys_.emplace(std::move(name), key);
+    return key;
+  }
+
+ private:
+  const Json json_;
+  const grpc_millis fetch_time_;
+  const grpc_millis expiration_;
+  Mutex mu_;
+  std::map<std::string, EVP_PKEY*> keys_;
+};
+
+enum class JwtFetchType { kOpenIdConfig, kKeys };
+
+// What verifying tokens needs from the network: the jwks_uri of openid
+// configurations and the key sets, each kept until its TTL runs out. Also
+// remembers which tokens have a verified signature, so that verifying the
+// same token again is cheap, and merges concurrent fetches of the same URL.
+// URLs are stored without their https:// scheme. Fetches are made under the
+// cache's HTTP context, so that they may outlive the verifier.
+class JwtVerifierCache : public RefCounted<JwtVerifierCache> {
+ public:
+  JwtVerifierCache() { grpc_httpcli_context_init(&http_ctx_); }
+  ~JwtVerifierCache() override { grpc_httpcli_context_destroy(&http_ctx_); }
+
+  grpc_httpcli_context* http_ctx() { return &http_ctx_; }
+
+  bool GetJwksUrl(const std::string& openid_url, std::string* jwks_url) {
+    MutexLock lock(&mu_);
+    auto it = jwks_urls_.find(openid_url);
+    if (it == jwks_urls_.end() ||
+        ExecCtx::Get()->Now() >= it->second.expiration) {
+      return false;
+    }
+    *jwks_url = it->second.jwks_url;
+    return true;
+  }
+
+  void SetJwksUrl(const std::string& openid_url, std::string jwks_url,
+                  grpc_millis expiration) {
+    MutexLock lock(&mu_);
+    PruneLocked(&jwks_urls_, [](const JwksUrl& entry) {
+      return entry.expiration;
+    });
+    jwks_urls_[openid_url] = {std::move(jwks_url), expiration};
+  }
+
+  // Returns the key set fetched from \a url if it is still valid, unless it
+  // lacks the key for \a alg and \a kid and may be fetched again.
+  RefCountedPtr<JwtKeySet> GetKeySet(const std::string& url, const char* alg,
+                                     const char* kid) {
+    RefCountedPtr<JwtKeySet> keys;
+    {
+      MutexLock lock(&mu_);
+      auto it = key_sets_.find(url);
+      if (it == key_sets_.end()) return nullptr;
+      keys = it->second;
+    }
+    const grpc_millis now = ExecCtx::Get()->Now();
+    if (now >= keys->expiration()) return nullptr;
+    if (keys->Find(alg, kid) == nullptr &&
+        now - keys->fetch_time() >= kKeySetMinRefetchInterval) {
+      return nullptr;
+    }
+    return keys;
+  }
+
+  void SetKeySet(const std::string& url, RefCountedPtr<JwtKeySet> keys) {
+    MutexLock lock(&mu_);
+    PruneLocked(&key_sets_, [](const RefCountedPtr<JwtKeySet>& entry) {
+      return entry->expiration();
+    });
+    key_sets_[url] = std::move(keys);
+  }
+
+  // Tokens are identified by the hash of their signed data and signature.
+  bool IsVerifiedToken(const std::string& token_hash) {
+    MutexLock lock(&mu_);
+    auto it = verified_tokens_.find(token_hash);
+    return it != verified_tokens_.end() &&
+           ExecCtx::Get()->Now() < it->second;
+  }
+
+  void AddVerifiedToken(const std::string& token_hash,
+                        grpc_millis expiration) {
+    MutexLock lock(&mu_);
+    auto it = verified_tokens_.find(token_hash);
+    if (it != verified_tokens_.end()) {
+      it->second = expiration;
+      return;
+    }
+    verified_tokens_.emplace(token_hash, expiration);
+    verified_token_order_.push_back(token_hash);
+    // Forget the least recently added tokens first.
+    while (verified_tokens_.size() > kMaxVerifiedTokens) {
+      verified_tokens_.erase(verified_token_order_.front());
+      verified_token_order_.pop_front();
+    }
+  }
+
+  // Adds \a ctx to the verifications waiting for \a url to be fetched.
+  // Returns true if there were none, in which case the caller must fetch it
+  // and then continue every waiting verification.
+  bool AddFetchWaiter(JwtFetchType type, const std::string& url,
+                      verifier_cb_ctx* ctx) {
+    MutexLock lock(&mu_);
+    std::vector<verifier_cb_ctx*>& waiters = pending_fetches_[{type, url}];
+    waiters.push_back(ctx);
+    return waiters.size() == 1;
+  }
+
+  std::vector<verifier_cb_ctx*> TakeFetchWaiters(JwtFetchType type,
+                                                 const std::string& url) {
+    MutexLock lock(&mu_);
+    auto it = pending_fetches_.find({type, url});
+    GPR_ASSERT(it != pending_fetches_.end());
+    std::vector<verifier_cb_ctx*> waiters = std::move(it->second);
+    pending_fetches_.erase(it);
+    return waiters;
+  }
+
+ private:
+  struct JwksUrl {
+    std::string jwks_url;
+    grpc_millis expiration;
+  };
+
+  // Makes room for a new entry by dropping expired ones, or the first one if
+  // none has expired.
+  template <typename T, typename GetExpiration>
+  static void PruneLocked(std::map<std::string, T>* entries,
+                          GetExpiration get_expiration) {
+    if (entries->size() < kMaxCachedUrls) return;
+    const grpc_millis now = ExecCtx::Get()->Now();
+    for (auto it = entries->begin(); it != entries->end();) {
+      if (now >= get_expiration(it->second)) {
+        it = entries->erase(it);
+      } else {
+        ++it;
+      }
+    }
+    if (entries->size() >= kMaxCachedUrls) entries->erase(entries->begin());
+  }
 
-typedef enum {
-  HTTP_RESPONSE_OPENID = 0,
-  HTTP_RESPONSE_KEYS,
-  HTTP_RESPONSE_COUNT /* must be last */
-} http_response_index;
+  grpc_httpcli_context http_ctx_;
+  Mutex mu_;
+  std::map<std::string, JwksUrl> jwks_urls_;
+  std::map<std::string, RefCountedPtr<JwtKeySet>> key_sets_;
+  std::map<std::string, grpc_millis> verified_tokens_;
+  std::deque<std::string> verified_token_order_;
+  std::map<std::pair<JwtFetchType, std::string>,
+           std::vector<verifier_cb_ctx*>>
+      pending_fetches_;
+};
+
+}  // namespace
+}  // namespace grpc_core
+
+/* --- grpc_jwt_verifier object. --- */
+
+/* Clock skew defaults to one minute. */
+gpr_timespec grpc_jwt_verifier_clock_skew = {60, 0, GPR_TIMESPAN};
+
+/* Max delay defaults to one minute. */
+grpc_millis grpc_jwt_verifier_max_delay = 60 * GPR_MS_PER_SEC;
+
+/* Cache TTL defaults to one hour. */
+grpc_millis grpc_jwt_verifier_cache_ttl = 3600 * GPR_MS_PER_SEC;
+
+struct email_key_mapping {
+  char* email_domain;
+  char* key_url_prefix;
+};
+struct grpc_jwt_verifier {
+  email_key_mapping* mappings;
+  size_t num_mappings; /* Should be very few, linear search ok. */
+  size_t allocated_mappings;
+  grpc_core::JwtVerifierCache* cache;
+};
+
+/* --- verifier_cb_ctx object. --- */
 
 struct verifier_cb_ctx {
-  grpc_jwt_verifier* verifier;
+  /* Holds a ref, so that fetches may complete after the verifier is gone.
+     Nothing else of the verifier may be used once a fetch is started. */
+  grpc_core::JwtVerifierCache* cache;
   grpc_polling_entity pollent;
   jose_header* header;
   grpc_jwt_claims* claims;
   char* audience;
   grpc_slice signature;
   grpc_slice signed_data;
+  /* SHA-256 of the signed data and signature. */
+  unsigned char token_hash[SHA256_DIGEST_LENGTH];
   void* user_data;
   grpc_jwt_verification_done_cb user_cb;
-  grpc_http_response responses[HTTP_RESPONSE_COUNT];
 };
 /* Takes ownership of the header, claims and signature. */
 static verifier_cb_ctx* verifier_cb_ctx_create(
@@ -357,13 +592,19 @@ static verifier_cb_ctx* verifier_cb_ctx_create(
   grpc_core::ExecCtx exec_ctx;
   verifier_cb_ctx* ctx =
       static_cast<verifier_cb_ctx*>(gpr_zalloc(sizeof(verifier_cb_ctx)));
-  ctx->verifier = verifier;
+  ctx->cache = verifier->cache->Ref().release();
   ctx->pollent = grpc_polling_entity_create_from_pollset(pollset);
   ctx->header = header;
   ctx->audience = gpr_strdup(audience);
   ctx->claims = claims;
   ctx->signature = signature;
   ctx->signed_data = grpc_slice_from_copied_buffer(signed_jwt, signed_jwt_len);
+  SHA256_CTX sha256;
+  SHA256_Init(&sha256);
+  SHA256_Update(&sha256, signed_jwt, signed_jwt_len);
+  SHA256_Update(&sha256, GRPC_SLICE_START_PTR(signature),
+                GRPC_SLICE_LENGTH(signature));
+  SHA256_Final(ctx->token_hash, &sha256);
   ctx->user_data = user_data;
   ctx->user_cb = cb;
 
@@ -376,31 +617,32 @@ void verifier_cb_ctx_destroy(verifier_cb_ctx* ctx) {
   grpc_slice_unref_internal(ctx->signature);
   grpc_slice_unref_internal(ctx->signed_data);
   jose_header_destroy(ctx->header);
-  for (size_t i = 0; i < HTTP_RESPONSE_COUNT; i++) {
-    grpc_http_response_destroy(&ctx->responses[i]);
-  }
+  ctx->cache->Unref();
   /* TODO: see what to do with claims... */
   gpr_free(ctx);
 }
 
-/* --- grpc_jwt_verifier object. --- */
-
-/* Clock skew defaults to one minute. */
-gpr_timespec grpc_jwt_verifier_clock_skew = {60, 0, GPR_TIMESPAN};
-
-/* Max delay defaults to one minute. */
-grpc_millis grpc_jwt_verifier_max_delay = 60 * GPR_MS_PER_SEC;
+static std::string verifier_cb_ctx_token_hash(const verifier_cb_ctx* ctx) {
+  return std::string(reinterpret_cast<const char*>(ctx->token_hash),
+                     sizeof(ctx->token_hash));
+}
 
-struct email_key_mapping {
-  char* email_domain;
-  char* key_url_prefix;
-};
-struct grpc_jwt_verifier {
-  email_key_mapping* mappings;
-  size_t num_mappings; /* Should be very few, linear search ok. */
-  size_t allocated_mappings;
-  grpc_httpcli_context http_ctx;
-};
+/* Checks the claims if the signature is valid, reports the result and
+   destroys ctx. */
+static void verifier_cb_ctx_done(verifier_cb_ctx* ctx,
+                                 grpc_jwt_verifier_status status) {
+  grpc_jwt_claims* claims = nullptr;
+  if (status == GRPC_JWT_VERIFIER_OK) {
+    status = grpc_jwt_claims_check(ctx->claims, ctx->audience);
+    if (status == GRPC_JWT_VERIFIER_OK) {
+      /* Pass ownership. */
+      claims = ctx->claims;
+      ctx->claims = nullptr;
+    }
+  }
+  ctx->user_cb(ctx->user_data, status, claims);
+  verifier_cb_ctx_destroy(ctx);
+}
 
 static Json json_from_http(const grpc_httpcli_response* response) {
   if (response == nullptr) {
@@ -627,93 +869,166 @@ end:
   return result;
 }
 
-static void on_keys_retrieved(void* user_data, grpc_error* /*error*/) {
-  verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
-  Json json = json_from_http(&ctx->responses[HTTP_RESPONSE_KEYS]);
-  EVP_PKEY* verification_key = nullptr;
-  grpc_jwt_verifier_status status = GRPC_JWT_VERIFIER_GENERIC_ERROR;
-  grpc_jwt_claims* claims = nullptr;
+/* Returns how long the contents of response may be cached for, as limited
+   by the no-cache, no-store and max-age directives of its Cache-Control
+   headers (RFC 7234 section 5.2). Other directives are ignored. */
+static grpc_millis cache_ttl_from_http(const grpc_httpcli_response* response) {
+  grpc_millis ttl = grpc_jwt_verifier_cache_ttl;
+  for (size_t i = 0; i < response->hdr_count; i++) {
+    const grpc_http_header& header = response->hdrs[i];
+    if (gpr_stricmp(header.key, "cache-control") != 0) continue;
+    for (absl::string_view directive : absl::StrSplit(header.value, ',')) {
+      directive = absl::StripAsciiWhitespace(directive);
+      std::pair<absl::string_view, absl::string_view> name_value =
+          absl::StrSplit(directive, absl::MaxSplits('=', 1));
+      absl::string_view name = absl::StripAsciiWhitespace(name_value.first);
+      absl::string_view value = absl::StripAsciiWhitespace(name_value.second);
+      if (absl::EqualsIgnoreCase(name, "no-store") ||
+          absl::EqualsIgnoreCase(name, "no-cache")) {
+        return 0;
+      }
+      if (!absl::EqualsIgnoreCase(name, "max-age")) continue;
+      /* The value may be quoted, and an invalid one means stale. */
+      if (value.size() >= 2 && value.front() == '"' && value.back() == '"') {
+        value = value.substr(1, value.size() - 2);
+      }
+      int64_t max_age;
+      if (!absl::SimpleAtoi(value, &max_age) || max_age < 0) return 0;
+      if (max_age < ttl / GPR_MS_PER_SEC) ttl = max_age * GPR_MS_PER_SEC;
+    }
+  }
+  return GPR_MAX(ttl, 0);
+}
 
-  if (json.type() == Json::Type::JSON_NULL) {
-    status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
-    goto end;
+static bool jwks_url_from_openid_config(const Json& json,
+                                        std::string* jwks_url) {
+  const Json* cur = find_property_by_name(json, "jwks_uri");
+  if (cur == nullptr) {
+    gpr_log(GPR_ERROR, "Could not find jwks_uri in openid config.");
+    return false;
   }
-  verification_key =
-      find_verification_key(json, ctx->header->alg, ctx->header->kid);
+  const char* jwks_uri = validate_string_field(*cur, "jwks_uri");
+  if (jwks_uri == nullptr) return false;
+  if (strstr(jwks_uri, "https://") != jwks_uri) {
+    gpr_log(GPR_ERROR, "Invalid non https jwks_uri: %s.", jwks_uri);
+    return false;
+  }
+  *jwks_url = jwks_uri + 8;
+  return true;
+}
+
+static void verify_with_key_set(verifier_cb_ctx* ctx,
+                                grpc_core::JwtKeySet* keys) {
+  EVP_PKEY* verification_key = keys->Find(ctx->header->alg, ctx->header->kid);
   if (verification_key == nullptr) {
     gpr_log(GPR_ERROR, "Could not find verification key with kid %s.",
             ctx->header->kid);
-    status = GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR;
-    goto end;
+    verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR);
+    return;
   }
-
   if (!verify_jwt_signature(verification_key, ctx->header->alg, ctx->signature,
                             ctx->signed_data)) {
-    status = GRPC_JWT_VERIFIER_BAD_SIGNATURE;
-    goto end;
+    verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_BAD_SIGNATURE);
+    return;
   }
+  /* The signature need not be checked again for as long as both the token
+     and the key are valid. */
+  ctx->cache->AddVerifiedToken(
+      verifier_cb_ctx_token_hash(ctx),
+      GPR_MIN(grpc_timespec_to_millis_round_down(ctx->claims->exp),
+              keys->expiration()));
+  verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_OK);
+}
 
-  status = grpc_jwt_claims_check(ctx->claims, ctx->audience);
-  if (status == GRPC_JWT_VERIFIER_OK) {
-    /* Pass ownership. */
-    claims = ctx->claims;
-    ctx->claims = nullptr;
-  }
+struct jwt_fetch {
+  ~jwt_fetch() { grpc_http_response_destroy(&response); }
 
-end:
-  EVP_PKEY_free(verification_key);
-  ctx->user_cb(ctx->user_data, status, claims);
-  verifier_cb_ctx_destroy(ctx);
-}
+  grpc_core::RefCountedPtr<grpc_core::JwtVerifierCache> cache;
+  grpc_core::JwtFetchType type;
+  std::string url;
+  grpc_closure closure;
+  grpc_http_response response;
+};
 
-static void on_openid_config_retrieved(void* user_data, grpc_error* /*error*/) {
-  verifier_cb_ctx* ctx = static_cast<verifier_cb_ctx*>(user_data);
-  const grpc_http_response* response = &ctx->responses[HTTP_RESPONSE_OPENID];
-  Json json = json_from_http(response);
+static void on_fetch_done(void* user_data, grpc_error* error);
+
+/* Fetches url for ctx, unless it is being fetched already. Either way, ctx
+   is continued once the fetch is done. */
+static void start_fetch(verifier_cb_ctx* ctx, grpc_core::JwtFetchType type,
+                        const std::string& url) {
+  if (!ctx->cache->AddFetchWaiter(type, url, ctx)) return;
+  jwt_fetch* fetch = new jwt_fetch();
+  fetch->cache = ctx->cache->Ref();
+  fetch->type = type;
+  fetch->url = url;
+  size_t slash = url.find('/');
+  std::string host = url.substr(0, slash);
+  std::string path = slash == std::string::npos ? "" : url.substr(slash);
   grpc_httpcli_request req;
-  const char* jwks_uri;
-  grpc_resource_quota* resource_quota = nullptr;
-  const Json* cur;
-
-  /* TODO(jboeuf): Cache the jwks_uri in order to avoid this hop next time. */
-  if (json.type() == Json::Type::JSON_NULL) goto error;
-  cur = find_property_by_name(json, "jwks_uri");
-  if (cur == nullptr) {
-    gpr_log(GPR_ERROR, "Could not find jwks_uri in openid config.");
-    goto error;
-  }
-  jwks_uri = validate_string_field(*cur, "jwks_uri");
-  if (jwks_uri == nullptr) goto error;
-  if (strstr(jwks_uri, "https://") != jwks_uri) {
-    gpr_log(GPR_ERROR, "Invalid non https jwks_uri: %s.", jwks_uri);
-    goto error;
-  }
-  jwks_uri += 8;
+  memset(&req, 0, sizeof(grpc_httpcli_request));
   req.handshaker = &grpc_httpcli_ssl;
-  req.host = gpr_strdup(jwks_uri);
-  req.http.path = const_cast<char*>(strchr(jwks_uri, '/'));
-  if (req.http.path == nullptr) {
-    req.http.path = const_cast<char*>("");
-  } else {
-    *(req.host + (req.http.path - jwks_uri)) = '\0';
-  }
+  req.host = const_cast<char*>(host.c_str());
+  req.http.path = const_cast<char*>(path.c_str());
 
   /* TODO(ctiller): Carry the resource_quota in ctx and share it with the host
      channel. This would allow us to cancel an authentication query when under
      extreme memory pressure. */
-  resource_quota = grpc_resource_quota_create("jwt_verifier");
+  grpc_resource_quota* resource_quota =
+      grpc_resource_quota_create("jwt_verifier");
   grpc_httpcli_get(
-      &ctx->verifier->http_ctx, &ctx->pollent, resource_quota, &req,
+      ctx->cache->http_ctx(), &ctx->pollent, resource_quota, &req,
       grpc_core::ExecCtx::Get()->Now() + grpc_jwt_verifier_max_delay,
-      GRPC_CLOSURE_CREATE(on_keys_retrieved, ctx, grpc_schedule_on_exec_ctx),
-      &ctx->responses[HTTP_RESPONSE_KEYS]);
+      GRPC_CLOSURE_INIT(&fetch->closure, on_fetch_done, fetch,
+                        grpc_schedule_on_exec_ctx),
+      &fetch->response);
   grpc_resource_quota_unref_internal(resource_quota);
-  gpr_free(req.host);
-  return;
+}
 
-error:
-  ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR, nullptr);
-  verifier_cb_ctx_destroy(ctx);
+/* Takes ownership of ctx. */
+static void get_keys_and_verify(verifier_cb_ctx* ctx, const std::string& url) {
+  grpc_core::RefCountedPtr<grpc_core::JwtKeySet> keys =
+      ctx->cache->GetKeySet(url, ctx->header->alg, ctx->header->kid);
+  if (keys != nullptr) {
+    verify_with_key_set(ctx, keys.get());
+    return;
+  }
+  start_fetch(ctx, grpc_core::JwtFetchType::kKeys, url);
+}
+
+static void on_fetch_done(void* user_data, grpc_error* /*error*/) {
+  std::unique_ptr<jwt_fetch> fetch(static_cast<jwt_fetch*>(user_data));
+  Json json = json_from_http(&fetch->response);
+  const grpc_millis expiration =
+      grpc_core::ExecCtx::Get()->Now() + cache_ttl_from_http(&fetch->response);
+  if (fetch->type == grpc_core::JwtFetchType::kOpenIdConfig) {
+    std::string jwks_url;
+    bool ok = json.type() != Json::Type::JSON_NULL &&
+              jwks_url_from_openid_config(json, &jwks_url);
+    if (ok) fetch->cache->SetJwksUrl(fetch->url, jwks_url, expiration);
+    for (verifier_cb_ctx* ctx :
+         fetch->cache->TakeFetchWaiters(fetch->type, fetch->url)) {
+      if (ok) {
+        get_keys_and_verify(ctx, jwks_url);
+      } else {
+        verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR);
+      }
+    }
+    return;
+  }
+  grpc_core::RefCountedPtr<grpc_core::JwtKeySet> keys;
+  if (json.type() != Json::Type::JSON_NULL) {
+    keys = grpc_core::MakeRefCounted<grpc_core::JwtKeySet>(
+        std::move(json), grpc_core::ExecCtx::Get()->Now(), expiration);
+    fetch->cache->SetKeySet(fetch->url, keys);
+  }
+  for (verifier_cb_ctx* ctx :
+       fetch->cache->TakeFetchWaiters(fetch->type, fetch->url)) {
+    if (keys != nullptr) {
+      verify_with_key_set(ctx, keys.get());
+    } else {
+      verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR);
+    }
+  }
 }
 
 static email_key_mapping* verifier_get_mapping(grpc_jwt_verifier* v,
@@ -761,16 +1076,12 @@ const char* grpc_jwt_issuer_email_domain(const char* issuer) {
 }
 
 /* Takes ownership of ctx. */
-static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
+static void retrieve_key_and_verify(grpc_jwt_verifier* verifier,
+                                    verifier_cb_ctx* ctx) {
   const char* email_domain;
-  grpc_closure* http_cb;
-  char* path_prefix = nullptr;
   const char* iss;
-  grpc_httpcli_request req;
-  grpc_resource_quota* resource_quota = nullptr;
-  memset(&req, 0, sizeof(grpc_httpcli_request));
-  req.handshaker = &grpc_httpcli_ssl;
-  http_response_index rsp_idx;
+  std::string openid_url;
+  std::string jwks_url;
 
   GPR_ASSERT(ctx != nullptr && ctx->header != nullptr &&
              ctx->claims != nullptr);
@@ -792,54 +1103,25 @@ static void retrieve_key_and_verify(verifier_cb_ctx* ctx) {
   email_domain = grpc_jwt_issuer_email_domain(iss);
   if (email_domain != nullptr) {
     email_key_mapping* mapping;
-    GPR_ASSERT(ctx->verifier != nullptr);
-    mapping = verifier_get_mapping(ctx->verifier, email_domain);
+    mapping = verifier_get_mapping(verifier, email_domain);
     if (mapping == nullptr) {
       gpr_log(GPR_ERROR, "Missing mapping for issuer email.");
       goto error;
     }
-    req.host = gpr_strdup(mapping->key_url_prefix);
-    path_prefix = strchr(req.host, '/');
-    if (path_prefix == nullptr) {
-      gpr_asprintf(&req.http.path, "/%s", iss);
-    } else {
-      *(path_prefix++) = '\0';
-      gpr_asprintf(&req.http.path, "/%s/%s", path_prefix, iss);
-    }
-    http_cb =
-        GRPC_CLOSURE_CREATE(on_keys_retrieved, ctx, grpc_schedule_on_exec_ctx);
-    rsp_idx = HTTP_RESPONSE_KEYS;
+    get_keys_and_verify(ctx, absl::StrCat(mapping->key_url_prefix, "/", iss));
+    return;
+  }
+  openid_url = absl::StrCat(strstr(iss, "https://") == iss ? iss + 8 : iss,
+                            GRPC_OPENID_CONFIG_URL_SUFFIX);
+  if (ctx->cache->GetJwksUrl(openid_url, &jwks_url)) {
+    get_keys_and_verify(ctx, jwks_url);
   } else {
-    req.host = gpr_strdup(strstr(iss, "https://") == iss ? iss + 8 : iss);
-    path_prefix = strchr(req.host, '/');
-    if (path_prefix == nullptr) {
-      req.http.path = gpr_strdup(GRPC_OPENID_CONFIG_URL_SUFFIX);
-    } else {
-      *(path_prefix++) = 0;
-      gpr_asprintf(&req.http.path, "/%s%s", path_prefix,
-                   GRPC_OPENID_CONFIG_URL_SUFFIX);
-    }
-    http_cb = GRPC_CLOSURE_CREATE(on_openid_config_retrieved, ctx,
-                                  grpc_schedule_on_exec_ctx);
-    rsp_idx = HTTP_RESPONSE_OPENID;
+    start_fetch(ctx, grpc_core::JwtFetchType::kOpenIdConfig, openid_url);
   }
-
-  /* TODO(ctiller): Carry the resource_quota in ctx and share it with the host
-     channel. This would allow us to cancel an authentication query when under
-     extreme memory pressure. */
-  resource_quota = grpc_resource_quota_create("jwt_verifier");
-  grpc_httpcli_get(
-      &ctx->verifier->http_ctx, &ctx->pollent, resource_quota, &req,
-      grpc_core::ExecCtx::Get()->Now() + grpc_jwt_verifier_max_delay, http_cb,
-      &ctx->responses[rsp_idx]);
-  grpc_resource_quota_unref_internal(resource_quota);
-  gpr_free(req.host);
-  gpr_free(req.http.path);
   return;
 
 error:
-  ctx->user_cb(ctx->user_data, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR, nullptr);
-  verifier_cb_ctx_destroy(ctx);
+  verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_KEY_RETRIEVAL_ERROR);
 }
 
 void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
@@ -854,6 +1136,7 @@ void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
   size_t signed_jwt_len;
   const char* cur = jwt;
   Json json;
+  verifier_cb_ctx* ctx = nullptr;
 
   GPR_ASSERT(verifier != nullptr && jwt != nullptr && audience != nullptr &&
              cb != nullptr);
@@ -876,9 +1159,14 @@ void grpc_jwt_verifier_verify(grpc_jwt_verifier* verifier,
   cur = dot + 1;
   signature = grpc_base64_decode(cur, 1);
   if (GRPC_SLICE_IS_EMPTY(signature)) goto error;
-  retrieve_key_and_verify(
-      verifier_cb_ctx_create(verifier, pollset, header, claims, audience,
-                             signature, jwt, signed_jwt_len, user_data, cb));
+  ctx = verifier_cb_ctx_create(verifier, pollset, header, claims, audience,
+                               signature, jwt, signed_jwt_len, user_data, cb);
+  if (verifier->cache->IsVerifiedToken(verifier_cb_ctx_token_hash(ctx))) {
+    /* Only the claims need checking. */
+    verifier_cb_ctx_done(ctx, GRPC_JWT_VERIFIER_OK);
+    return;
+  }
+  retrieve_key_and_verify(verifier, ctx);
   return;
 
 error:
@@ -892,7 +1180,7 @@ grpc_jwt_verifier* grpc_jwt_verifier_create(
     size_t num_mappings) {
   grpc_jwt_verifier* v =
       static_cast<grpc_jwt_verifier*>(gpr_zalloc(sizeof(grpc_jwt_verifier)));
-  grpc_httpcli_context_init(&v->http_ctx);
+  v->cache = new grpc_core::JwtVerifierCache();
 
   /* We know at least of one mapping. */
   v->allocated_mappings = 1 + num_mappings;
@@ -914,7 +1202,7 @@ grpc_jwt_verifier* grpc_jwt_verifier_create(
 void grpc_jwt_verifier_destroy(grpc_jwt_verifier* v) {
   size_t i;
   if (v == nullptr) return;
-  grpc_httpcli_context_destroy(&v->http_ctx);
+  v->cache->Unref();
   if (v->mappings != nullptr) {
     for (i = 0; i < v->num_mappings; i++) {
       gpr_free(v->mappings[i].email_domain);
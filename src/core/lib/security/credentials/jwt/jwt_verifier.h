@@ -83,6 +83,9 @@ struct grpc_jwt_verifier_email_domain_key_url_mapping {
 /* Globals to control the verifier. Not thread-safe. */
 extern gpr_timespec grpc_jwt_verifier_clock_skew;
 extern grpc_millis grpc_jwt_verifier_max_delay;
+/* Openid configurations and keys are cached for at most this long, or for
+   less if the issuer says so with Cache-Control. */
+extern grpc_millis grpc_jwt_verifier_cache_ttl;
 
 /* The verifier can be created with some custom mappings to help with key
    discovery in the case where the issuer is an email address.
@@ -124,13 +124,33 @@ void grpc_auth_refresh_token_destruct(grpc_auth_refresh_token* refresh_token) {
 // Oauth2 Token Fetcher credentials.
 //
 
+// State shared by all credentials objects with the same cache key: the cached
+// token, and the fetch in progress with the requests waiting for it.
+struct grpc_oauth2_token_fetcher_credentials::TokenState
+    : public grpc_core::CredentialsMetadataCache::Entry {
+  explicit TokenState(std::string key)
+      : Entry(std::move(key)),
+        pollent(grpc_polling_entity_create_from_pollset_set(
+            grpc_pollset_set_create())) {
+    gpr_mu_init(&mu);
+    grpc_httpcli_context_init(&httpcli_context);
+  }
+
+  ~TokenState() override {
+    gpr_mu_destroy(&mu);
+    grpc_pollset_set_destroy(grpc_polling_entity_pollset_set(&pollent));
+    grpc_httpcli_context_destroy(&httpcli_context);
+  }
+
+  gpr_mu mu;
+  bool token_fetch_pending = false;
+  grpc_oauth2_pending_get_request_metadata* pending_requests = nullptr;
+  grpc_httpcli_context httpcli_context;
+  grpc_polling_entity pollent;
+};
+
 grpc_oauth2_token_fetcher_credentials::
-    ~grpc_oauth2_token_fetcher_credentials() {
-  GRPC_MDELEM_UNREF(access_token_md_);
-  gpr_mu_destroy(&mu_);
-  grpc_pollset_set_destroy(grpc_polling_entity_pollset_set(&pollent_));
-  grpc_httpcli_context_destroy(&httpcli_context_);
-}
+    ~grpc_oauth2_token_fetcher_credentials() = default;
 
 grpc_credentials_status
 grpc_oauth2_token_fetcher_credentials_parse_server_response(
@@ -239,18 +259,18 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
           ? grpc_oauth2_token_fetcher_credentials_parse_server_response(
                 &r->response, &access_token_md, &token_lifetime)
           : GRPC_CREDENTIALS_ERROR;
-  // Update cache and grab list of pending requests.
-  gpr_mu_lock(&mu_);
-  token_fetch_pending_ = false;
-  access_token_md_ = GRPC_MDELEM_REF(access_token_md);
-  token_expiration_ =
-      status == GRPC_CREDENTIALS_OK
-          ? gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
-                         gpr_time_from_millis(token_lifetime, GPR_TIMESPAN))
-          : gpr_inf_past(GPR_CLOCK_MONOTONIC);
-  grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
-  pending_requests_ = nullptr;
-  gpr_mu_unlock(&mu_);
+  // Update cache and grab list of pending requests. If a background refresh
+  // failed, the current token keeps being used until it expires.
+  gpr_mu_lock(&state_->mu);
+  state_->token_fetch_pending = false;
+  if (status == GRPC_CREDENTIALS_OK) {
+    state_->Put(absl::string_view(), access_token_md,
+                grpc_core::ExecCtx::Get()->Now() + token_lifetime);
+  }
+  grpc_oauth2_pending_get_request_metadata* pending_request =
+      state_->pending_requests;
+  state_->pending_requests = nullptr;
+  gpr_mu_unlock(&state_->mu);
   // Invoke callbacks for all pending requests.
   while (pending_request != nullptr) {
     grpc_error* new_error = GRPC_ERROR_NONE;
@@ -264,7 +284,8 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
     grpc_core::ExecCtx::Run(DEBUG_LOCATION,
                             pending_request->on_request_metadata, new_error);
     grpc_polling_entity_del_from_pollset_set(
-        pending_request->pollent, grpc_polling_entity_pollset_set(&pollent_));
+        pending_request->pollent,
+        grpc_polling_entity_pollset_set(&state_->pollent));
     grpc_oauth2_pending_get_request_metadata* prev = pending_request;
     pending_request = pending_request->next;
     gpr_free(prev);
@@ -274,30 +295,59 @@ void grpc_oauth2_token_fetcher_credentials::on_http_response(
   grpc_credentials_metadata_request_destroy(r);
 }
 
+grpc_core::CredentialsMetadataCache::Entry::Result
+grpc_oauth2_token_fetcher_credentials::AddCachedToken(
+    grpc_credentials_mdelem_array* md_array) {
+  grpc_mdelem cached_access_token_md = GRPC_MDNULL;
+  grpc_core::CredentialsMetadataCache::Entry::Result result =
+      state_->Get(absl::string_view(), &cached_access_token_md);
+  if (result != grpc_core::CredentialsMetadataCache::Entry::Result::kMiss) {
+    grpc_credentials_mdelem_array_add(md_array, cached_access_token_md);
+    GRPC_MDELEM_UNREF(cached_access_token_md);
+  }
+  return result;
+}
+
+void grpc_oauth2_token_fetcher_credentials::StartBackgroundFetch() {
+  gpr_mu_lock(&state_->mu);
+  bool start_fetch = !state_->token_fetch_pending;
+  state_->token_fetch_pending = true;
+  gpr_mu_unlock(&state_->mu);
+  if (start_fetch) StartFetch();
+}
+
+void grpc_oauth2_token_fetcher_credentials::StartFetch() {
+  // A background fetch has no pending request whose pollent would drive it.
+  // It makes progress through whichever threads poll the process's fds, and
+  // if it has not completed once the token expires, the requests that then
+  // wait for it are added to the pollset_set.
+  Ref().release();
+  fetch_oauth2(grpc_credentials_metadata_request_create(this->Ref()),
+               &state_->httpcli_context, &state_->pollent,
+               on_oauth2_token_fetcher_http_response,
+               grpc_core::ExecCtx::Get()->Now() +
+                   GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS * GPR_MS_PER_SEC);
+}
+
 bool grpc_oauth2_token_fetcher_credentials::get_request_metadata(
     grpc_polling_entity* pollent, grpc_auth_metadata_context /*context*/,
     grpc_credentials_mdelem_array* md_array, grpc_closure* on_request_metadata,
     grpc_error** /*error*/) {
-  // Check if we can use the cached token.
-  grpc_millis refresh_threshold =
-      GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS * GPR_MS_PER_SEC;
-  grpc_mdelem cached_access_token_md = GRPC_MDNULL;
-  gpr_mu_lock(&mu_);
-  if (!GRPC_MDISNULL(access_token_md_) &&
-      gpr_time_cmp(
-          gpr_time_sub(token_expiration_, gpr_now(GPR_CLOCK_MONOTONIC)),
-          gpr_time_from_seconds(GRPC_SECURE_TOKEN_REFRESH_THRESHOLD_SECS,
-                                GPR_TIMESPAN)) > 0) {
-    cached_access_token_md = GRPC_MDELEM_REF(access_token_md_);
-  }
-  if (!GRPC_MDISNULL(cached_access_token_md)) {
-    gpr_mu_unlock(&mu_);
-    grpc_credentials_mdelem_array_add(md_array, cached_access_token_md);
-    GRPC_MDELEM_UNREF(cached_access_token_md);
+  using Result = grpc_core::CredentialsMetadataCache::Entry::Result;
+  // Check if we can use the cached token. This does not take any lock.
+  Result result = AddCachedToken(md_array);
+  if (result == Result::kHitRefresh) StartBackgroundFetch();
+  if (result != Result::kMiss) return true;
+  // Couldn't get the token from the cache.
+  // Add request to pending_requests and start a new fetch if needed.
+  gpr_mu_lock(&state_->mu);
+  // A fetch may have completed since the lookup.
+  result = AddCachedToken(md_array);
+  if (result != Result::kMiss) {
+    gpr_mu_unlock(&state_->mu);
+    if (result == Result::kHitRefresh) StartBackgroundFetch();
     return true;
   }
-  // Couldn't get the token from the cache.
-  // Add request to pending_requests_ and start a new fetch if needed.
   grpc_oauth2_pending_get_request_metadata* pending_request =
       static_cast<grpc_oauth2_pending_get_request_metadata*>(
           gpr_malloc(sizeof(*pending_request)));
@@ -305,37 +355,32 @@ bool grpc_oauth2_token_fetcher_credentials::get_request_metadata(
   pending_request->on_request_metadata = on_request_metadata;
   pending_request->pollent = pollent;
   grpc_polling_entity_add_to_pollset_set(
-      pollent, grpc_polling_entity_pollset_set(&pollent_));
-  pending_request->next = pending_requests_;
-  pending_requests_ = pending_request;
+      pollent, grpc_polling_entity_pollset_set(&state_->pollent));
+  pending_request->next = state_->pending_requests;
+  state_->pending_requests = pending_request;
   bool start_fetch = false;
-  if (!token_fetch_pending_) {
-    token_fetch_pending_ = true;
+  if (!state_->token_fetch_pending) {
+    state_->token_fetch_pending = true;
     start_fetch = true;
   }
-  gpr_mu_unlock(&mu_);
-  if (start_fetch) {
-    Ref().release();
-    fetch_oauth2(grpc_credentials_metadata_request_create(this->Ref()),
-                 &httpcli_context_, &pollent_,
-                 on_oauth2_token_fetcher_http_response,
-                 grpc_core::ExecCtx::Get()->Now() + refresh_threshold);
-  }
+  gpr_mu_unlock(&state_->mu);
+  if (start_fetch) StartFetch();
   return false;
 }
 
 void grpc_oauth2_token_fetcher_credentials::cancel_get_request_metadata(
     grpc_credentials_mdelem_array* md_array, grpc_error* error) {
-  gpr_mu_lock(&mu_);
+  gpr_mu_lock(&state_->mu);
   grpc_oauth2_pending_get_request_metadata* prev = nullptr;
-  grpc_oauth2_pending_get_request_metadata* pending_request = pending_requests_;
+  grpc_oauth2_pending_get_request_metadata* pending_request =
+      state_->pending_requests;
   while (pending_request != nullptr) {
     if (pending_request->md_array == md_array) {
       // Remove matching pending request from the list.
       if (prev != nullptr) {
         prev->next = pending_request->next;
       } else {
-        pending_requests_ = pending_request->next;
+        state_->pending_requests = pending_request->next;
       }
       // Invoke the callback immediately with an error.
       grpc_core::ExecCtx::Run(DEBUG_LOCATION,
@@ -347,18 +392,15 @@ void grpc_oauth2_token_fetcher_credentials::cancel_get_request_metadata(
     prev = pending_request;
     pending_request = pending_request->next;
   }
-  gpr_mu_unlock(&mu_);
+  gpr_mu_unlock(&state_->mu);
   GRPC_ERROR_UNREF(error);
 }
 
-grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials()
+grpc_oauth2_token_fetcher_credentials::grpc_oauth2_token_fetcher_credentials(
+    std::string cache_key)
     : grpc_call_credentials(GRPC_CALL_CREDENTIALS_TYPE_OAUTH2),
-      token_expiration_(gpr_inf_past(GPR_CLOCK_MONOTONIC)),
-      pollent_(grpc_polling_entity_create_from_pollset_set(
-          grpc_pollset_set_create())) {
-  gpr_mu_init(&mu_);
-  grpc_httpcli_context_init(&httpcli_context_);
-}
+      state_(grpc_core::CredentialsMetadataCache::GetOrCreate<TokenState>(
+          std::move(cache_key))) {}
 
 std::string grpc_oauth2_token_fetcher_credentials::debug_string() {
   return "OAuth2TokenFetcherCredentials";
@@ -373,7 +415,10 @@ namespace {
 class grpc_compute_engine_token_fetcher_credentials
     : public grpc_oauth2_token_fetcher_credentials {
  public:
-  grpc_compute_engine_token_fetcher_credentials() = default;
+  // Every compute engine credentials object gets the token of the VM's
+  // default service account.
+  grpc_compute_engine_token_fetcher_credentials()
+      : grpc_oauth2_token_fetcher_credentials("oauth2:compute_engine") {}
   ~grpc_compute_engine_token_fetcher_credentials() override = default;
 
  protected:
@@ -466,7 +511,12 @@ void grpc_google_refresh_token_credentials::fetch_oauth2(
 
 grpc_google_refresh_token_credentials::grpc_google_refresh_token_credentials(
     grpc_auth_refresh_token refresh_token)
-    : refresh_token_(refresh_token) {}
+    : grpc_oauth2_token_fetcher_credentials(
+          grpc_core::CredentialsMetadataCache::MakeKey(
+              "oauth2:refresh_token",
+              {refresh_token.client_id, refresh_token.client_secret,
+               refresh_token.refresh_token})),
+      refresh_token_(refresh_token) {}
 
 grpc_core::RefCountedPtr<grpc_call_credentials>
 grpc_refresh_token_credentials_create_from_auth_refresh_token(
@@ -540,7 +590,8 @@ class StsTokenFetcherCredentials
  public:
   StsTokenFetcherCredentials(URI sts_url,
                              const grpc_sts_credentials_options* options)
-      : sts_url_(std::move(sts_url)),
+      : grpc_oauth2_token_fetcher_credentials(CacheKey(options)),
+        sts_url_(std::move(sts_url)),
         resource_(gpr_strdup(options->resource)),
         audience_(gpr_strdup(options->audience)),
         scope_(gpr_strdup(options->scope)),
@@ -550,6 +601,22 @@ class StsTokenFetcherCredentials
         actor_token_path_(gpr_strdup(options->actor_token_path)),
         actor_token_type_(gpr_strdup(options->actor_token_type)) {}
 
+  // Credentials with the same options exchange the same subject token for the
+  // same token.
+  static std::string CacheKey(const grpc_sts_credentials_options* options) {
+    auto field = [](const char* option) {
+      return option == nullptr ? absl::string_view() : option;
+    };
+    return grpc_core::CredentialsMetadataCache::MakeKey(
+        "oauth2:sts",
+        {field(options->token_exchange_service_uri), field(options->resource),
+         field(options->audience), field(options->scope),
+         field(options->requested_token_type),
+         field(options->subject_token_path),
+         field(options->subject_token_type), field(options->actor_token_path),
+         field(options->actor_token_type)});
+  }
+
   std::string debug_string() override {
     return absl::StrFormat(
         "StsTokenFetcherCredentials{Path:%s,Authority:%s,%s}", sts_url_.path(),
@@ -26,6 +26,7 @@
 #include <grpc/grpc_security.h>
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/security/credentials/credentials.h"
+#include "src/core/lib/security/credentials/credentials_metadata_cache.h"
 #include "src/core/lib/uri/uri_parser.h"
 
 // Constants.
@@ -71,7 +72,10 @@ struct grpc_oauth2_pending_get_request_metadata {
 
 class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
  public:
-  grpc_oauth2_token_fetcher_credentials();
+  // Credentials objects created with the same non-empty \a cache_key share
+  // their token across the process (see CredentialsMetadataCache), so the key
+  // must identify everything that the fetched token depends on.
+  explicit grpc_oauth2_token_fetcher_credentials(std::string cache_key = "");
   ~grpc_oauth2_token_fetcher_credentials() override;
 
   bool get_request_metadata(grpc_polling_entity* pollent,
@@ -94,13 +98,16 @@ class grpc_oauth2_token_fetcher_credentials : public grpc_call_credentials {
                             grpc_millis deadline) = 0;
 
  private:
-  gpr_mu mu_;
-  grpc_mdelem access_token_md_ = GRPC_MDNULL;
-  gpr_timespec token_expiration_;
-  bool token_fetch_pending_ = false;
-  grpc_oauth2_pending_get_request_metadata* pending_requests_ = nullptr;
-  grpc_httpcli_context httpcli_context_;
-  grpc_polling_entity pollent_;
+  struct TokenState;
+
+  // Adds the cached token to \a md_array, if there is a usable one.
+  grpc_core::CredentialsMetadataCache::Entry::Result AddCachedToken(
+      grpc_credentials_mdelem_array* md_array);
+  // Starts a fetch for a token that is still usable but due to be refreshed.
+  void StartBackgroundFetch();
+  void StartFetch();
+
+  grpc_core::RefCountedPtr<TokenState> state_;
 };
 
 // Google refresh token credentials.
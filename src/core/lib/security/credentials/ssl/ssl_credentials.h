@@ -23,6 +23,7 @@
 #include "src/core/lib/security/credentials/credentials.h"
 
 #include "src/core/lib/security/security_connector/ssl/ssl_security_connector.h"
+#include "src/core/lib/security/security_connector/ssl_utils.h"
 
 class grpc_ssl_credentials : public grpc_channel_credentials {
  public:
@@ -49,6 +50,9 @@ class grpc_ssl_credentials : public grpc_channel_credentials {
                     const grpc_ssl_verify_peer_options* verify_options);
 
   grpc_ssl_config config_;
+  // Channels sharing sessions must trust the same roots and present the same
+  // identity, so the shared session cache is scoped to these credentials.
+  grpc_core::SharedSslSessionCache shared_session_cache_;
 };
 
 struct grpc_ssl_server_certificate_config {
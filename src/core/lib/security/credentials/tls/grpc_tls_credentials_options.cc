@@ -145,6 +145,34 @@ void grpc_tls_credentials_options_set_server_authorization_check_config(
   options->set_server_authorization_check_config(config->Ref());
 }
 
+grpc_tls_session_ticket_keys* grpc_tls_session_ticket_keys_create(void) {
+  GRPC_API_TRACE("grpc_tls_session_ticket_keys_create()", 0, ());
+  return reinterpret_cast<grpc_tls_session_ticket_keys*>(
+      tsi_ssl_session_ticket_keys_create());
+}
+
+int grpc_tls_session_ticket_keys_set(grpc_tls_session_ticket_keys* keys,
+                                     const char** key_data, size_t key_size,
+                                     size_t num_keys) {
+  GPR_ASSERT(keys != nullptr);
+  return tsi_ssl_session_ticket_keys_set(
+             reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys), key_data,
+             key_size, num_keys) == TSI_OK;
+}
+
+void grpc_tls_session_ticket_keys_release(grpc_tls_session_ticket_keys* keys) {
+  GRPC_API_TRACE("grpc_tls_session_ticket_keys_release(keys=%p)", 1, (keys));
+  tsi_ssl_session_ticket_keys_unref(
+      reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys));
+}
+
+void grpc_tls_credentials_options_set_session_ticket_keys(
+    grpc_tls_credentials_options* options, grpc_tls_session_ticket_keys* keys) {
+  GPR_ASSERT(options != nullptr);
+  options->set_session_ticket_keys(
+      reinterpret_cast<tsi_ssl_session_ticket_keys*>(keys));
+}
+
 grpc_tls_server_authorization_check_config*
 grpc_tls_server_authorization_check_config_create(
     const void* config_user_data,
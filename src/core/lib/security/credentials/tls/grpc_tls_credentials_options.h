@@ -101,7 +101,11 @@ struct grpc_tls_server_authorization_check_config
 struct grpc_tls_credentials_options
     : public grpc_core::RefCounted<grpc_tls_credentials_options> {
  public:
-  ~grpc_tls_credentials_options() override = default;
+  ~grpc_tls_credentials_options() override {
+    if (session_ticket_keys_ != nullptr) {
+      tsi_ssl_session_ticket_keys_unref(session_ticket_keys_);
+    }
+  }
 
   // Getters for member fields.
   grpc_ssl_client_certificate_request_type cert_request_type() const {
@@ -125,6 +129,9 @@ struct grpc_tls_credentials_options
   const std::string& root_cert_name() { return root_cert_name_; }
   bool watch_identity_pair() { return watch_identity_pair_; }
   const std::string& identity_cert_name() { return identity_cert_name_; }
+  tsi_ssl_session_ticket_keys* session_ticket_keys() const {
+    return session_ticket_keys_;
+  }
 
   // Setters for member fields.
   void set_cert_request_type(
@@ -173,6 +180,15 @@ struct grpc_tls_credentials_options
   void set_identity_cert_name(std::string identity_cert_name) {
     identity_cert_name_ = std::move(identity_cert_name);
   }
+  // Sets the keys used to encrypt and decrypt session tickets on the server
+  // side. Takes a new ref to |keys|.
+  void set_session_ticket_keys(tsi_ssl_session_ticket_keys* keys) {
+    if (keys != nullptr) tsi_ssl_session_ticket_keys_ref(keys);
+    if (session_ticket_keys_ != nullptr) {
+      tsi_ssl_session_ticket_keys_unref(session_ticket_keys_);
+    }
+    session_ticket_keys_ = keys;
+  }
 
  private:
   grpc_ssl_client_certificate_request_type cert_request_type_ =
@@ -188,6 +204,7 @@ struct grpc_tls_credentials_options
   std::string root_cert_name_;
   bool watch_identity_pair_ = false;
   std::string identity_cert_name_;
+  tsi_ssl_session_ticket_keys* session_ticket_keys_ = nullptr;
 };
 
 #endif  // GRPC_CORE_LIB_SECURITY_CREDENTIALS_TLS_GRPC_TLS_CREDENTIALS_OPTIONS_H
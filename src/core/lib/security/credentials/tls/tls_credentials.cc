@@ -28,6 +28,7 @@
 #include <grpc/support/string_util.h>
 
 #include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/security/security_connector/ssl_utils.h"
 #include "src/core/lib/security/security_connector/tls/tls_security_connector.h"
 
 #define GRPC_CREDENTIALS_TYPE_TLS "Tls"
@@ -70,18 +71,14 @@ TlsCredentials::create_security_connector(
     const char* target_name, const grpc_channel_args* args,
     grpc_channel_args** new_args) {
   const char* overridden_target_name = nullptr;
-  tsi_ssl_session_cache* ssl_session_cache = nullptr;
+  tsi_ssl_session_cache* ssl_session_cache =
+      grpc_ssl_session_cache_from_channel_args(args, &shared_session_cache_);
   for (size_t i = 0; args != nullptr && i < args->num_args; i++) {
     grpc_arg* arg = &args->args[i];
     if (strcmp(arg->key, GRPC_SSL_TARGET_NAME_OVERRIDE_ARG) == 0 &&
         arg->type == GRPC_ARG_STRING) {
       overridden_target_name = arg->value.string;
     }
-    if (strcmp(arg->key, GRPC_SSL_SESSION_CACHE_ARG) == 0 &&
-        arg->type == GRPC_ARG_POINTER) {
-      ssl_session_cache =
-          static_cast<tsi_ssl_session_cache*>(arg->value.pointer.p);
-    }
   }
   grpc_core::RefCountedPtr<grpc_channel_security_connector> sc =
       grpc_core::TlsChannelSecurityConnector::CreateTlsChannelSecurityConnector(
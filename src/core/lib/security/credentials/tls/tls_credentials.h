@@ -25,6 +25,7 @@
 
 #include "src/core/lib/security/credentials/credentials.h"
 #include "src/core/lib/security/credentials/tls/grpc_tls_credentials_options.h"
+#include "src/core/lib/security/security_connector/ssl_utils.h"
 
 class TlsCredentials final : public grpc_channel_credentials {
  public:
@@ -42,6 +43,8 @@ class TlsCredentials final : public grpc_channel_credentials {
 
  private:
   grpc_core::RefCountedPtr<grpc_tls_credentials_options> options_;
+  // Sessions are only shared between channels of these credentials.
+  grpc_core::SharedSslSessionCache shared_session_cache_;
 };
 
 class TlsServerCredentials final : public grpc_server_credentials {
@@ -446,6 +446,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     const char* pem_root_certs,
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
+    tsi_ssl_session_ticket_keys* session_ticket_keys,
     tsi_ssl_server_handshaker_factory** handshaker_factory) {
   size_t num_alpn_protocols = 0;
   const char** alpn_protocol_strings =
@@ -461,6 +462,7 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
   options.num_alpn_protocols = static_cast<uint16_t>(num_alpn_protocols);
   options.min_tls_version = min_tls_version;
   options.max_tls_version = max_tls_version;
+  options.session_ticket_keys = session_ticket_keys;
   const tsi_result result =
       tsi_create_ssl_server_handshaker_factory_with_options(&options,
                                                             handshaker_factory);
@@ -504,6 +506,41 @@ static int grpc_ssl_session_cache_arg_cmp(void* p, void* q) {
   return GPR_ICMP(p, q);
 }
 
+/* Large enough to be sharded, and to hold a session for every target of
+   processes that talk to many backends. */
+#define GRPC_SSL_SHARED_SESSION_CACHE_CAPACITY 4096
+
+namespace grpc_core {
+
+SharedSslSessionCache::~SharedSslSessionCache() {
+  if (cache_ != nullptr) tsi_ssl_session_cache_unref(cache_);
+}
+
+tsi_ssl_session_cache* SharedSslSessionCache::Get() {
+  MutexLock lock(&mu_);
+  if (cache_ == nullptr) {
+    cache_ = tsi_ssl_session_cache_create_lru(
+        GRPC_SSL_SHARED_SESSION_CACHE_CAPACITY);
+  }
+  return cache_;
+}
+
+}  // namespace grpc_core
+
+tsi_ssl_session_cache* grpc_ssl_session_cache_from_channel_args(
+    const grpc_channel_args* args,
+    grpc_core::SharedSslSessionCache* shared_cache) {
+  tsi_ssl_session_cache* cache =
+      grpc_channel_args_find_pointer<tsi_ssl_session_cache>(
+          args, GRPC_SSL_SESSION_CACHE_ARG);
+  if (cache != nullptr) return cache;
+  if (!grpc_channel_args_find_bool(args, GRPC_SSL_SESSION_CACHE_SHARED_ARG,
+                                   false)) {
+    return nullptr;
+  }
+  return shared_cache->Get();
+}
+
 grpc_arg grpc_ssl_session_cache_create_channel_arg(
     grpc_ssl_session_cache* cache) {
   static const grpc_arg_pointer_vtable vtable = {
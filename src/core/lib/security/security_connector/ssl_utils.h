@@ -31,6 +31,7 @@
 
 #include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/iomgr/error.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 #include "src/core/lib/security/security_connector/ssl_utils_config.h"
@@ -98,8 +99,37 @@ grpc_security_status grpc_ssl_tsi_server_handshaker_factory_init(
     const char* pem_root_certs,
     grpc_ssl_client_certificate_request_type client_certificate_request,
     tsi_tls_version min_tls_version, tsi_tls_version max_tls_version,
+    tsi_ssl_session_ticket_keys* session_ticket_keys,
     tsi_ssl_server_handshaker_factory** handshaker_factory);
 
+namespace grpc_core {
+
+// The client session cache shared by the channels of one channel
+// credentials object that set GRPC_SSL_SESSION_CACHE_SHARED_ARG. It is
+// created on first use.
+class SharedSslSessionCache {
+ public:
+  SharedSslSessionCache() = default;
+  ~SharedSslSessionCache();
+
+  // The caller does not get a reference.
+  tsi_ssl_session_cache* Get();
+
+ private:
+  Mutex mu_;
+  tsi_ssl_session_cache* cache_ = nullptr;
+};
+
+}  // namespace grpc_core
+
+/* Returns the client session cache to use for a channel with \a args: the
+   cache set with GRPC_SSL_SESSION_CACHE_ARG, otherwise \a shared_cache if
+   GRPC_SSL_SESSION_CACHE_SHARED_ARG is set, otherwise nullptr. The caller
+   does not get a reference. */
+tsi_ssl_session_cache* grpc_ssl_session_cache_from_channel_args(
+    const grpc_channel_args* args,
+    grpc_core::SharedSslSessionCache* shared_cache);
+
 /* Exposed for testing only. */
 grpc_core::RefCountedPtr<grpc_auth_context> grpc_ssl_peer_to_auth_context(
     const tsi_peer* peer, const char* transport_security_type);
@@ -84,6 +84,8 @@ class TlsChannelSecurityConnector final
     return pem_key_cert_pair_list_;
   }
 
+  tsi_ssl_session_cache* SessionCacheForTesting() { return ssl_session_cache_; }
+
  private:
   // A watcher that watches certificate updates from
   // grpc_tls_certificate_distributor. It will never outlive
@@ -22,17 +22,24 @@
 
 #include <stdbool.h>
 #include <string.h>
+#include <algorithm>
+#include <deque>
 #include <limits>
 
 #include <grpc/slice_buffer.h>
 #include <grpc/support/alloc.h>
+#include <grpc/support/cpu.h>
 #include <grpc/support/log.h>
+#include <grpc/support/time.h>
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/handshaker.h"
 #include "src/core/lib/channel/handshaker_registry.h"
+#include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gprpp/ref_counted_ptr.h"
+#include "src/core/lib/gprpp/sync.h"
+#include "src/core/lib/iomgr/executor/threadpool.h"
 #include "src/core/lib/security/context/security_context.h"
 #include "src/core/lib/security/transport/secure_endpoint.h"
 #include "src/core/lib/security/transport/tsi_error.h"
@@ -41,10 +48,71 @@
 
 #define GRPC_INITIAL_HANDSHAKE_BUFFER_SIZE 256
 
+// The default ThreadPool stack is too small for handshake crypto.
+#define GRPC_HANDSHAKE_OFFLOAD_STACK_SIZE (256 * 1024)
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_security_handshake_offload_threads, 0,
+    "Number of threads that run offloaded security handshakes. 0 means one "
+    "thread per core.");
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_security_handshake_offload_max_concurrent, 0,
+    "Maximum number of offloaded server security handshakes in progress at "
+    "once. Further handshakes wait to be admitted in arrival order. 0 means "
+    "no limit.");
+
+GPR_GLOBAL_CONFIG_DEFINE_INT32(
+    grpc_security_handshake_offload_queue_timeout_ms, 10000,
+    "Offloaded security handshakes that waited longer than this many "
+    "milliseconds to be admitted fail instead of starting.");
+
 namespace grpc_core {
 
 namespace {
 
+class SecurityHandshaker;
+
+// Runs the TSI handshaker steps of offloaded handshakes on dedicated threads,
+// so that handshake crypto does not delay I/O for established connections on
+// the polling threads, and bounds the number of offloaded server handshakes
+// in progress at once. Handshakes beyond that bound wait in arrival order and
+// are admitted as earlier handshakes finish.
+class HandshakeOffloadPool {
+ public:
+  static HandshakeOffloadPool* Get() {
+    static HandshakeOffloadPool* pool = new HandshakeOffloadPool();
+    return pool;
+  }
+
+  // Runs \a step on one of the pool's threads.
+  void Run(grpc_experimental_completion_queue_functor* step) {
+    threads_.Add(step);
+  }
+
+  // Returns true if \a handshaker may start now. Otherwise it is queued, and
+  // its OnAdmitted() is called once an earlier handshake finishes.
+  bool Admit(SecurityHandshaker* handshaker);
+  // Removes a queued \a handshaker. Returns false if it was already admitted.
+  bool Cancel(SecurityHandshaker* handshaker);
+  // Called when an admitted handshake finishes, to admit the next one.
+  void Release();
+
+  gpr_timespec queue_timeout() const { return queue_timeout_; }
+
+ private:
+  HandshakeOffloadPool();
+  static int NumThreads();
+
+  const int max_concurrent_;
+  const gpr_timespec queue_timeout_;
+  ThreadPool threads_;
+
+  Mutex mu_;
+  int active_ = 0;
+  std::deque<SecurityHandshaker*> waiting_;
+};
+
 class SecurityHandshaker : public Handshaker {
  public:
   SecurityHandshaker(tsi_handshaker* handshaker,
@@ -57,9 +125,18 @@ class SecurityHandshaker : public Handshaker {
                    HandshakerArgs* args) override;
   const char* name() const override { return "security"; }
 
+  // Starts a handshake that was waiting to be admitted to the offload pool.
+  void OnAdmitted();
+
  private:
+  struct OffloadedStep : public grpc_experimental_completion_queue_functor {
+    SecurityHandshaker* handshaker;
+  };
+
   grpc_error* DoHandshakerNextLocked(const unsigned char* bytes_received,
                                      size_t bytes_received_size);
+  grpc_error* CallHandshakerNextLocked(const unsigned char* bytes_received,
+                                       size_t bytes_received_size);
 
   grpc_error* OnHandshakeNextDoneLocked(
       tsi_result result, const unsigned char* bytes_to_send,
@@ -80,6 +157,10 @@ class SecurityHandshaker : public Handshaker {
   void OnPeerCheckedInner(grpc_error* error);
   size_t MoveReadBufferIntoHandshakeBuffer();
   grpc_error* CheckPeerLocked();
+  static void OnOffloadedStepFn(
+      grpc_experimental_completion_queue_functor* functor, int ok);
+  grpc_error* OnOffloadedStepLocked();
+  void ReleaseOffloadSlotLocked();
 
   // State set at creation time.
   tsi_handshaker* handshaker_;
@@ -105,8 +186,77 @@ class SecurityHandshaker : public Handshaker {
   RefCountedPtr<grpc_auth_context> auth_context_;
   tsi_handshaker_result* handshaker_result_ = nullptr;
   size_t max_frame_size_ = 0;
+  gpr_timespec start_time_;
+
+  // Set if GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD is enabled.
+  HandshakeOffloadPool* offload_pool_ = nullptr;
+  OffloadedStep offloaded_step_;
+  size_t offloaded_bytes_received_size_ = 0;
+  bool waiting_for_admission_ = false;
+  bool holds_offload_slot_ = false;
 };
 
+//
+// HandshakeOffloadPool
+//
+
+HandshakeOffloadPool::HandshakeOffloadPool()
+    : max_concurrent_(GPR_GLOBAL_CONFIG_GET(
+          grpc_security_handshake_offload_max_concurrent)),
+      queue_timeout_(gpr_time_from_millis(
+          GPR_GLOBAL_CONFIG_GET(
+              grpc_security_handshake_offload_queue_timeout_ms),
+          GPR_TIMESPAN)),
+      threads_(
+          NumThreads(), "grpc_handshake",
+          Thread::Options().set_stack_size(GRPC_HANDSHAKE_OFFLOAD_STACK_SIZE)) {
+}
+
+int HandshakeOffloadPool::NumThreads() {
+  int32_t threads =
+      GPR_GLOBAL_CONFIG_GET(grpc_security_handshake_offload_threads);
+  return threads > 0 ? threads : static_cast<int>(gpr_cpu_num_cores());
+}
+
+bool HandshakeOffloadPool::Admit(SecurityHandshaker* handshaker) {
+  MutexLock lock(&mu_);
+  if (max_concurrent_ <= 0 || active_ < max_concurrent_) {
+    ++active_;
+    return true;
+  }
+  waiting_.push_back(handshaker);
+  return false;
+}
+
+bool HandshakeOffloadPool::Cancel(SecurityHandshaker* handshaker) {
+  MutexLock lock(&mu_);
+  auto it = std::find(waiting_.begin(), waiting_.end(), handshaker);
+  if (it == waiting_.end()) return false;
+  waiting_.erase(it);
+  return true;
+}
+
+void HandshakeOffloadPool::Release() {
+  SecurityHandshaker* next;
+  {
+    MutexLock lock(&mu_);
+    if (waiting_.empty()) {
+      --active_;
+      return;
+    }
+    // The finished handshake's slot passes straight to the next one.
+    next = waiting_.front();
+    waiting_.pop_front();
+  }
+  // Called without mu_ held, since the caller holds its handshaker's lock and
+  // Cancel() is called with a handshaker's lock held.
+  next->OnAdmitted();
+}
+
+//
+// SecurityHandshaker
+//
+
 SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
                                        grpc_security_connector* connector,
                                        const grpc_channel_args* args)
@@ -124,9 +274,18 @@ SecurityHandshaker::SecurityHandshaker(tsi_handshaker* handshaker,
   grpc_slice_buffer_init(&outgoing_);
   GRPC_CLOSURE_INIT(&on_peer_checked_, &SecurityHandshaker::OnPeerCheckedFn,
                     this, grpc_schedule_on_exec_ctx);
+  if (grpc_channel_args_find_bool(args, GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD,
+                                  false)) {
+    offload_pool_ = HandshakeOffloadPool::Get();
+    offloaded_step_.functor_run = &SecurityHandshaker::OnOffloadedStepFn;
+    offloaded_step_.inlineable = false;
+    offloaded_step_.internal_success = 1;
+    offloaded_step_.handshaker = this;
+  }
 }
 
 SecurityHandshaker::~SecurityHandshaker() {
+  ReleaseOffloadSlotLocked();
   tsi_handshaker_destroy(handshaker_);
   tsi_handshaker_result_destroy(handshaker_result_);
   if (endpoint_to_destroy_ != nullptr) {
@@ -174,6 +333,7 @@ void SecurityHandshaker::CleanupArgsForFailureLocked() {
 // If the handshake failed or we're shutting down, clean up and invoke the
 // callback with the error.
 void SecurityHandshaker::HandshakeFailedLocked(grpc_error* error) {
+  ReleaseOffloadSlotLocked();
   if (error == GRPC_ERROR_NONE) {
     // If we were shut down after the handshake succeeded but before an
     // endpoint callback was invoked, we need to generate our own error.
@@ -285,6 +445,9 @@ void SecurityHandshaker::OnPeerCheckedInner(grpc_error* error) {
   args_->args = grpc_channel_args_copy_and_add(tmp_args, args_to_add.data(),
                                                args_to_add.size());
   grpc_channel_args_destroy(tmp_args);
+  ReleaseOffloadSlotLocked();
+  GRPC_STATS_INC_SECURITY_HANDSHAKE_TIME(gpr_timespec_to_micros(
+      gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start_time_)));
   // Invoke callback.
   ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, GRPC_ERROR_NONE);
   // Set shutdown to true so that subsequent calls to
@@ -385,6 +548,20 @@ void SecurityHandshaker::OnHandshakeNextDoneGrpcWrapper(
 
 grpc_error* SecurityHandshaker::DoHandshakerNextLocked(
     const unsigned char* bytes_received, size_t bytes_received_size) {
+  if (offload_pool_ != nullptr) {
+    // Invoke the TSI handshaker on the offload pool. The caller's ref is
+    // passed on to the offloaded step. Received bytes are always in
+    // handshake_buffer_, which is not touched until the step is done.
+    GPR_DEBUG_ASSERT(bytes_received == handshake_buffer_);
+    offloaded_bytes_received_size_ = bytes_received_size;
+    offload_pool_->Run(&offloaded_step_);
+    return GRPC_ERROR_NONE;
+  }
+  return CallHandshakerNextLocked(bytes_received, bytes_received_size);
+}
+
+grpc_error* SecurityHandshaker::CallHandshakerNextLocked(
+    const unsigned char* bytes_received, size_t bytes_received_size) {
   // Invoke TSI handshaker.
   const unsigned char* bytes_to_send = nullptr;
   size_t bytes_to_send_size = 0;
@@ -403,6 +580,57 @@ grpc_error* SecurityHandshaker::DoHandshakerNextLocked(
                                    hs_result);
 }
 
+void SecurityHandshaker::OnOffloadedStepFn(
+    grpc_experimental_completion_queue_functor* functor, int /*ok*/) {
+  ExecCtx exec_ctx;
+  RefCountedPtr<SecurityHandshaker> h(
+      static_cast<OffloadedStep*>(functor)->handshaker);
+  MutexLock lock(&h->mu_);
+  grpc_error* error = h->OnOffloadedStepLocked();
+  if (error != GRPC_ERROR_NONE) {
+    h->HandshakeFailedLocked(error);
+  } else {
+    h.release();  // Avoid unref
+  }
+}
+
+grpc_error* SecurityHandshaker::OnOffloadedStepLocked() {
+  if (waiting_for_admission_) {
+    // First step of a handshake that had to wait to be admitted.
+    waiting_for_admission_ = false;
+    holds_offload_slot_ = true;
+    gpr_timespec queue_time =
+        gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start_time_);
+    GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIME(
+        gpr_timespec_to_micros(queue_time));
+    if (!is_shutdown_ &&
+        gpr_time_cmp(queue_time, offload_pool_->queue_timeout()) > 0) {
+      GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS();
+      return grpc_error_set_int(
+          GRPC_ERROR_CREATE_FROM_STATIC_STRING(
+              "Timed out waiting for handshake admission"),
+          GRPC_ERROR_INT_GRPC_STATUS, GRPC_STATUS_RESOURCE_EXHAUSTED);
+    }
+  }
+  if (is_shutdown_) {
+    return GRPC_ERROR_CREATE_FROM_STATIC_STRING("Handshaker shutdown");
+  }
+  return CallHandshakerNextLocked(handshake_buffer_,
+                                  offloaded_bytes_received_size_);
+}
+
+void SecurityHandshaker::OnAdmitted() {
+  // The ref taken when the handshake was queued is passed on to the step.
+  offload_pool_->Run(&offloaded_step_);
+}
+
+void SecurityHandshaker::ReleaseOffloadSlotLocked() {
+  if (holds_offload_slot_) {
+    holds_offload_slot_ = false;
+    offload_pool_->Release();
+  }
+}
+
 // This callback might be run inline while we are still holding on to the mutex,
 // so schedule OnHandshakeDataReceivedFromPeerFn on ExecCtx to avoid a deadlock.
 void SecurityHandshaker::OnHandshakeDataReceivedFromPeerFnScheduler(
@@ -483,24 +711,48 @@ void SecurityHandshaker::OnHandshakeDataSentToPeerFn(void* arg,
 //
 
 void SecurityHandshaker::Shutdown(grpc_error* why) {
+  // Declared before the lock so that it is released after the lock is.
+  RefCountedPtr<SecurityHandshaker> queued_ref;
   MutexLock lock(&mu_);
   if (!is_shutdown_) {
     is_shutdown_ = true;
     tsi_handshaker_shutdown(handshaker_);
     grpc_endpoint_shutdown(args_->endpoint, GRPC_ERROR_REF(why));
     CleanupArgsForFailureLocked();
+    // A handshake that is waiting to be admitted has no pending operation
+    // that would report the failure, so report it here.
+    if (waiting_for_admission_ && offload_pool_->Cancel(this)) {
+      waiting_for_admission_ = false;
+      queued_ref.reset(this);
+      ExecCtx::Run(DEBUG_LOCATION, on_handshake_done_, GRPC_ERROR_REF(why));
+    }
   }
   GRPC_ERROR_UNREF(why);
 }
 
-void SecurityHandshaker::DoHandshake(grpc_tcp_server_acceptor* /*acceptor*/,
+void SecurityHandshaker::DoHandshake(grpc_tcp_server_acceptor* acceptor,
                                      grpc_closure* on_handshake_done,
                                      HandshakerArgs* args) {
   auto ref = Ref();
   MutexLock lock(&mu_);
   args_ = args;
   on_handshake_done_ = on_handshake_done;
+  start_time_ = gpr_now(GPR_CLOCK_MONOTONIC);
   size_t bytes_received_size = MoveReadBufferIntoHandshakeBuffer();
+  // Only server handshakes (those with an acceptor) are admission controlled,
+  // so that a client handshake waiting on a server in the same process never
+  // holds a slot that the server side needs.
+  if (offload_pool_ != nullptr && acceptor != nullptr) {
+    if (!offload_pool_->Admit(this)) {
+      // The handshake starts once OnAdmitted() is called.
+      waiting_for_admission_ = true;
+      offloaded_bytes_received_size_ = bytes_received_size;
+      ref.release();  // Held by the admission queue.
+      return;
+    }
+    holds_offload_slot_ = true;
+    GRPC_STATS_INC_SECURITY_HANDSHAKE_QUEUE_TIME(0);
+  }
   grpc_error* error =
       DoHandshakerNextLocked(handshake_buffer_, bytes_received_size);
   if (error != GRPC_ERROR_NONE) {
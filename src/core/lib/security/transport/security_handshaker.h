@@ -22,8 +22,17 @@
 #include <grpc/support/port_platform.h>
 
 #include "src/core/lib/channel/handshaker.h"
+#include "src/core/lib/gprpp/global_config.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
 
+// Configuration of the process-wide pool that runs the handshakes of channels
+// and servers with GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD set. It is read once,
+// when the first such handshake starts.
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_security_handshake_offload_threads);
+GPR_GLOBAL_CONFIG_DECLARE_INT32(grpc_security_handshake_offload_max_concurrent);
+GPR_GLOBAL_CONFIG_DECLARE_INT32(
+    grpc_security_handshake_offload_queue_timeout_ms);
+
 namespace grpc_core {
 
 /// Creates a security handshaker using \a handshaker.
@@ -38,6 +38,8 @@
 
 #include "src/core/lib/channel/channel_stack.h"
 #include "src/core/lib/compression/algorithm_metadata.h"
+#include "src/core/lib/debug/call_phase_tracer.h"
+#include "src/core/lib/debug/network_latency.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/alloc.h"
 #include "src/core/lib/gpr/string.h"
@@ -377,6 +379,12 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
     }
     call->send_extra_metadata_count =
         static_cast<int>(args->add_initial_metadata_count);
+    grpc_core::CallPhaseTrace* trace = grpc_core::CallPhaseTrace::MaybeCreate(
+        call->arena, path, call->start_time);
+    if (trace != nullptr) {
+      grpc_call_context_set(call, GRPC_CONTEXT_CALL_PHASE_TRACE, trace,
+                            grpc_core::CallPhaseTrace::Destroy);
+    }
   } else {
     GRPC_STATS_INC_SERVER_CALLS_CREATED();
     call->final_op.server.cancelled = nullptr;
@@ -384,6 +392,19 @@ grpc_error* grpc_call_create(const grpc_call_create_args* args,
     GPR_ASSERT(args->add_initial_metadata_count == 0);
     call->send_extra_metadata_count = 0;
   }
+  grpc_core::RefCountedPtr<grpc_core::CallNetworkLatency> network_latency =
+      grpc_core::CallNetworkLatency::MaybeCreate(
+          args->channel->tcp_tracing_sample_rate,
+          &args->channel->tcp_tracing_call_count);
+  if (network_latency != nullptr) {
+    if (call->is_client) {
+      network_latency->SetMethod(
+          std::string(grpc_core::StringViewFromSlice(path)));
+    }
+    grpc_call_context_set(call, GRPC_CONTEXT_NETWORK_LATENCY,
+                          network_latency.release(),
+                          grpc_core::CallNetworkLatency::Destroy);
+  }
 
   grpc_millis send_deadline = args->send_deadline;
   bool immediately_cancel = false;
@@ -1262,6 +1283,8 @@ static void continue_receiving_slices(batch_control* bctl) {
     if (remaining == 0) {
       call->receiving_message = false;
       call->receiving_stream.reset();
+      grpc_core::CallPhaseTrace::Record(
+          call->context, grpc_core::CallPhase::kMessageDelivered);
       finish_batch_step(bctl);
       return;
     }
@@ -1933,6 +1956,8 @@ static grpc_call_error call_start_batch(grpc_call* call, const grpc_op* ops,
   }
 
   gpr_atm_rel_store(&call->any_ops_sent_atm, 1);
+  grpc_core::CallPhaseTrace::Record(call->context,
+                                    grpc_core::CallPhase::kFilterStackEntered);
   execute_batch(call, stream_op, &bctl->start_batch);
 
 done:
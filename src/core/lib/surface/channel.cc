@@ -34,6 +34,7 @@
 #include "src/core/lib/channel/channel_trace.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/channelz_registry.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/string.h"
 #include "src/core/lib/gprpp/manual_constructor.h"
@@ -96,6 +97,8 @@ grpc_channel* grpc_channel_create_with_builder(
       (gpr_atm)CHANNEL_STACK_FROM_CHANNEL(channel)->call_stack_size +
           grpc_call_get_initial_size_estimate());
 
+  bool tcp_tracing_enabled = false;
+  int tcp_tracing_sample_rate = GRPC_TCP_TRACING_DEFAULT_SAMPLE_RATE;
   grpc_compression_options_init(&channel->compression_options);
   for (size_t i = 0; i < args->num_args; i++) {
     if (0 ==
@@ -119,6 +122,12 @@ grpc_channel* grpc_channel_create_with_builder(
       channel->compression_options.enabled_algorithms_bitset =
           static_cast<uint32_t>(args->args[i].value.integer) |
           0x1; /* always support no compression */
+    } else if (0 == strcmp(args->args[i].key, GRPC_ARG_TCP_TRACING_ENABLED)) {
+      tcp_tracing_enabled = grpc_channel_arg_get_bool(&args->args[i], false);
+    } else if (0 ==
+               strcmp(args->args[i].key, GRPC_ARG_TCP_TRACING_SAMPLE_RATE)) {
+      tcp_tracing_sample_rate = grpc_channel_arg_get_integer(
+          &args->args[i], {GRPC_TCP_TRACING_DEFAULT_SAMPLE_RATE, 1, INT_MAX});
     } else if (0 == strcmp(args->args[i].key, GRPC_ARG_CHANNELZ_CHANNEL_NODE)) {
       if (args->args[i].type == GRPC_ARG_POINTER) {
         GPR_ASSERT(args->args[i].value.pointer.p != nullptr);
@@ -132,6 +141,15 @@ grpc_channel* grpc_channel_create_with_builder(
     }
   }
 
+  /* Messages compressed with an algorithm that gRPC was built without are
+     rejected as disabled rather than failing to decompress. */
+  channel->compression_options.enabled_algorithms_bitset &=
+      grpc_compression_supported_algorithms_bitset();
+
+  channel->tcp_tracing_sample_rate =
+      tcp_tracing_enabled ? tcp_tracing_sample_rate : 0;
+  gpr_atm_no_barrier_store(&channel->tcp_tracing_call_count, 0);
+
   grpc_channel_args_destroy(args);
   return channel;
 }
@@ -409,11 +427,14 @@ grpc_call* grpc_channel_create_pollset_set_call(
 
 namespace grpc_core {
 
+// The path is interned once at registration time, so that per-call lookups
+// keyed on it (e.g., the service config method table) can hash and compare
+// it without touching the string contents.
 RegisteredCall::RegisteredCall(const char* method_arg, const char* host_arg)
     : method(method_arg != nullptr ? method_arg : ""),
       host(host_arg != nullptr ? host_arg : ""),
       path(grpc_mdelem_from_slices(
-          GRPC_MDSTR_PATH, grpc_core::ExternallyManagedSlice(method.c_str()))),
+          GRPC_MDSTR_PATH, grpc_core::ManagedMemorySlice(method.c_str()))),
       authority(!host.empty()
                     ? grpc_mdelem_from_slices(
                           GRPC_MDSTR_AUTHORITY,
@@ -428,7 +449,7 @@ RegisteredCall::RegisteredCall(RegisteredCall&& other) noexcept
     : method(std::move(other.method)),
       host(std::move(other.host)),
       path(grpc_mdelem_from_slices(
-          GRPC_MDSTR_PATH, grpc_core::ExternallyManagedSlice(method.c_str()))),
+          GRPC_MDSTR_PATH, grpc_core::ManagedMemorySlice(method.c_str()))),
       authority(!host.empty()
                     ? grpc_mdelem_from_slices(
                           GRPC_MDSTR_AUTHORITY,
@@ -108,6 +108,11 @@ struct grpc_channel {
   gpr_atm call_size_estimate;
   grpc_resource_user* resource_user;
 
+  // 1 in this many calls have their writes traced with kernel timestamps, or
+  // 0 if GRPC_ARG_TCP_TRACING_ENABLED is not set.
+  int tcp_tracing_sample_rate;
+  gpr_atm tcp_tracing_call_count;
+
   // TODO(vjpai): Once the grpc_channel is allocated via new rather than malloc,
   //              expand the members of the CallRegistrationTable directly into
   //              the grpc_channel. For now it is kept separate so that all the
@@ -40,6 +40,7 @@
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/channel/channelz.h"
 #include "src/core/lib/channel/connected_channel.h"
+#include "src/core/lib/debug/network_latency.h"
 #include "src/core/lib/debug/stats.h"
 #include "src/core/lib/gpr/spinlock.h"
 #include "src/core/lib/gpr/string.h"
@@ -47,6 +48,7 @@
 #include "src/core/lib/iomgr/executor.h"
 #include "src/core/lib/iomgr/iomgr.h"
 #include "src/core/lib/slice/slice_internal.h"
+#include "src/core/lib/slice/slice_utils.h"
 #include "src/core/lib/surface/api_trace.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/channel.h"
@@ -1397,6 +1399,12 @@ void Server::CallData::RecvInitialMetadataReady(void* arg, grpc_error* error) {
         GRPC_MDVALUE(calld->recv_initial_metadata_->idx.named.path->md)));
     calld->host_.emplace(grpc_slice_ref_internal(
         GRPC_MDVALUE(calld->recv_initial_metadata_->idx.named.authority->md)));
+    CallNetworkLatency* network_latency = static_cast<CallNetworkLatency*>(
+        grpc_call_context_get(calld->call_, GRPC_CONTEXT_NETWORK_LATENCY));
+    if (network_latency != nullptr) {
+      network_latency->SetMethod(
+          std::string(StringViewFromSlice(*calld->path_)));
+    }
     grpc_metadata_batch_remove(calld->recv_initial_metadata_, GRPC_BATCH_PATH);
     grpc_metadata_batch_remove(calld->recv_initial_metadata_,
                                GRPC_BATCH_AUTHORITY);
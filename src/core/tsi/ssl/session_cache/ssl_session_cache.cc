@@ -18,6 +18,10 @@
 
 #include <grpc/support/port_platform.h>
 
+#include <string.h>
+
+#include "src/core/lib/gpr/murmur_hash.h"
+#include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/sync.h"
 #include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session.h"
@@ -74,6 +78,7 @@ class SslSessionLRUCache::Node {
 
  private:
   friend class SslSessionLRUCache;
+  friend class SslSessionLRUCache::Shard;
 
   grpc_slice key_;
   std::unique_ptr<SslCachedSession> session_;
@@ -82,27 +87,82 @@ class SslSessionLRUCache::Node {
   Node* prev_ = nullptr;
 };
 
-SslSessionLRUCache::SslSessionLRUCache(size_t capacity) : capacity_(capacity) {
+/// One independently locked LRU list and index.
+class SslSessionLRUCache::Shard {
+ public:
+  Shard() { entry_by_key_ = grpc_avl_create(&cache_avl_vtable); }
+
+  ~Shard() {
+    Node* node = use_order_list_head_;
+    while (node) {
+      Node* next = node->next_;
+      delete node;
+      node = next;
+    }
+    grpc_avl_unref(entry_by_key_, nullptr);
+  }
+
+  void set_capacity(size_t capacity) { capacity_ = capacity; }
+
+  size_t Size() {
+    grpc_core::MutexLock lock(&lock_);
+    return use_order_list_size_;
+  }
+
+  void Put(const char* key, SslSessionPtr session);
+  SslSessionPtr Get(const char* key);
+
+ private:
+  Node* FindLocked(const grpc_slice& key);
+  void Remove(Node* node);
+  void PushFront(Node* node);
+  void AssertInvariants();
+
+  grpc_core::Mutex lock_;
+  size_t capacity_ = 0;
+
+  Node* use_order_list_head_ = nullptr;
+  Node* use_order_list_tail_ = nullptr;
+  size_t use_order_list_size_ = 0;
+  grpc_avl entry_by_key_;
+};
+
+SslSessionLRUCache::SslSessionLRUCache(size_t capacity) {
   GPR_ASSERT(capacity > 0);
-  entry_by_key_ = grpc_avl_create(&cache_avl_vtable);
+  // Small caches keep a single, exact LRU order.
+  num_shards_ = GPR_CLAMP(capacity / kMinShardCapacity, 1, kMaxShards);
+  shards_.reset(new Shard[num_shards_]);
+  for (size_t i = 0; i < num_shards_; ++i) {
+    // Spread the remainder so that the shard capacities add up to capacity.
+    shards_[i].set_capacity(capacity / num_shards_ +
+                            (i < capacity % num_shards_ ? 1 : 0));
+  }
 }
 
-SslSessionLRUCache::~SslSessionLRUCache() {
-  Node* node = use_order_list_head_;
-  while (node) {
-    Node* next = node->next_;
-    delete node;
-    node = next;
+SslSessionLRUCache::~SslSessionLRUCache() {}
+
+size_t SslSessionLRUCache::Size() {
+  size_t size = 0;
+  for (size_t i = 0; i < num_shards_; ++i) {
+    size += shards_[i].Size();
   }
-  grpc_avl_unref(entry_by_key_, nullptr);
+  return size;
 }
 
-size_t SslSessionLRUCache::Size() {
-  grpc_core::MutexLock lock(&lock_);
-  return use_order_list_size_;
+void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+  ShardFor(key).Put(key, std::move(session));
 }
 
-SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
+SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+  return ShardFor(key).Get(key);
+}
+
+SslSessionLRUCache::Shard& SslSessionLRUCache::ShardFor(const char* key) {
+  if (num_shards_ == 1) return shards_[0];
+  return shards_[gpr_murmur_hash3(key, strlen(key), 0) % num_shards_];
+}
+
+SslSessionLRUCache::Node* SslSessionLRUCache::Shard::FindLocked(
     const grpc_slice& key) {
   void* value =
       grpc_avl_get(entry_by_key_, const_cast<grpc_slice*>(&key), nullptr);
@@ -117,7 +177,7 @@ SslSessionLRUCache::Node* SslSessionLRUCache::FindLocked(
   return node;
 }
 
-void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
+void SslSessionLRUCache::Shard::Put(const char* key, SslSessionPtr session) {
   grpc_core::MutexLock lock(&lock_);
   Node* node = FindLocked(grpc_slice_from_static_string(key));
   if (node != nullptr) {
@@ -140,7 +200,7 @@ void SslSessionLRUCache::Put(const char* key, SslSessionPtr session) {
   }
 }
 
-SslSessionPtr SslSessionLRUCache::Get(const char* key) {
+SslSessionPtr SslSessionLRUCache::Shard::Get(const char* key) {
   grpc_core::MutexLock lock(&lock_);
   // Key is only used for lookups.
   grpc_slice key_slice = grpc_slice_from_static_string(key);
@@ -151,7 +211,7 @@ SslSessionPtr SslSessionLRUCache::Get(const char* key) {
   return node->CopySession();
 }
 
-void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::Remove(SslSessionLRUCache::Node* node) {
   if (node->prev_ == nullptr) {
     use_order_list_head_ = node->next_;
   } else {
@@ -166,7 +226,7 @@ void SslSessionLRUCache::Remove(SslSessionLRUCache::Node* node) {
   use_order_list_size_--;
 }
 
-void SslSessionLRUCache::PushFront(SslSessionLRUCache::Node* node) {
+void SslSessionLRUCache::Shard::PushFront(SslSessionLRUCache::Node* node) {
   if (use_order_list_head_ == nullptr) {
     use_order_list_head_ = node;
     use_order_list_tail_ = node;
@@ -189,7 +249,7 @@ static size_t calculate_tree_size(grpc_avl_node* node) {
   return 1 + calculate_tree_size(node->left) + calculate_tree_size(node->right);
 }
 
-void SslSessionLRUCache::AssertInvariants() {
+void SslSessionLRUCache::Shard::AssertInvariants() {
   size_t size = 0;
   Node* prev = nullptr;
   Node* current = use_order_list_head_;
@@ -206,7 +266,7 @@ void SslSessionLRUCache::AssertInvariants() {
   GPR_ASSERT(calculate_tree_size(entry_by_key_.root) == use_order_list_size_);
 }
 #else
-void SslSessionLRUCache::AssertInvariants() {}
+void SslSessionLRUCache::Shard::AssertInvariants() {}
 #endif
 
 }  // namespace tsi
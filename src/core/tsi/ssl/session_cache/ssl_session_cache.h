@@ -28,6 +28,8 @@ extern "C" {
 #include <openssl/ssl.h>
 }
 
+#include <memory>
+
 #include "src/core/lib/avl/avl.h"
 #include "src/core/lib/gprpp/memory.h"
 #include "src/core/lib/gprpp/ref_counted.h"
@@ -41,6 +43,10 @@ extern "C" {
 /// name. Note that servers are required to share session ticket encryption keys
 /// in order for cache to be effective.
 ///
+/// Large caches are split into independently locked shards by key, each
+/// holding an equal share of the capacity, so that many channels sharing one
+/// cache do not contend on a single lock. LRU order is kept per shard.
+///
 /// This class is thread safe.
 
 namespace tsi {
@@ -71,19 +77,16 @@ class SslSessionLRUCache : public grpc_core::RefCounted<SslSessionLRUCache> {
 
  private:
   class Node;
+  class Shard;
 
-  Node* FindLocked(const grpc_slice& key);
-  void Remove(Node* node);
-  void PushFront(Node* node);
-  void AssertInvariants();
+  // Caches smaller than kMinShardCapacity * 2 are not sharded.
+  static constexpr size_t kMinShardCapacity = 64;
+  static constexpr size_t kMaxShards = 16;
 
-  grpc_core::Mutex lock_;
-  size_t capacity_;
+  Shard& ShardFor(const char* key);
 
-  Node* use_order_list_head_ = nullptr;
-  Node* use_order_list_tail_ = nullptr;
-  size_t use_order_list_size_ = 0;
-  grpc_avl entry_by_key_;
+  size_t num_shards_;
+  std::unique_ptr<Shard[]> shards_;
 };
 
 }  // namespace tsi
@@ -50,6 +50,9 @@ extern "C" {
 #include <openssl/crypto.h> /* For OPENSSL_free */
 #include <openssl/engine.h>
 #include <openssl/err.h>
+#include <openssl/evp.h>
+#include <openssl/hmac.h>
+#include <openssl/rand.h>
 #include <openssl/ssl.h>
 #include <openssl/tls1.h>
 #include <openssl/x509.h>
@@ -57,15 +60,24 @@ extern "C" {
 }
 
 #include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/ssl/session_cache/ssl_session_cache.h"
 #include "src/core/tsi/ssl_types.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 
 /* --- Constants. ---*/
 
 #define TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND 16384
 #define TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND 1024
 #define TSI_SSL_HANDSHAKER_OUTGOING_BUFFER_INITIAL_SIZE 1024
+/* Largest plaintext a single TLS record can carry. */
+#define TSI_SSL_MAX_RECORD_PLAINTEXT_SIZE 16384
+/* Session ticket keys are a name followed by equally sized HMAC and AES keys.
+ */
+#define TSI_SSL_TICKET_KEY_NAME_SIZE 16
+#define TSI_SSL_TICKET_KEY_SIZE_AES_128 48
+#define TSI_SSL_TICKET_KEY_SIZE_AES_256 80
 
 /* Putting a macro like this and littering the source file with #if is really
    bad practice.
@@ -107,6 +119,16 @@ struct tsi_ssl_server_handshaker_factory {
   size_t ssl_context_count;
   unsigned char* alpn_protocol_list;
   size_t alpn_protocol_list_length;
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
+};
+
+struct tsi_ssl_session_ticket_keys {
+  gpr_refcount refcount;
+  gpr_mu mu;
+  /* num_keys keys of key_size bytes each, current key first. */
+  unsigned char* keys;
+  size_t key_size;
+  size_t num_keys;
 };
 
 struct tsi_ssl_handshaker {
@@ -133,10 +155,30 @@ struct tsi_ssl_frame_protector {
   size_t buffer_size;
   size_t buffer_offset;
 };
+/* Seals and opens records directly between grpc_slice_buffers. Unlike
+   tsi_ssl_frame_protector, plaintext is handed to SSL_write straight from the
+   caller's slices whenever a slice holds at least a full record, and SSL_read
+   decrypts straight into slices that are passed up without further copies. */
+struct tsi_ssl_zero_copy_grpc_protector {
+  tsi_zero_copy_grpc_protector base;
+  SSL* ssl;
+  BIO* network_io;
+  /* SSL objects cannot be used from two threads at once, while the secure
+     endpoint may protect and unprotect concurrently. */
+  gpr_mu mu;
+  size_t max_protected_frame_size;
+  /* Plaintext bytes sealed into each record. */
+  size_t max_unprotected_frame_size;
+  /* Gathers small slices so that they are sealed into full records. */
+  unsigned char* buffer;
+  /* Unused tail of the slice that SSL_read last decrypted into. */
+  grpc_slice read_slice;
+};
 /* --- Library Initialization. ---*/
 
 static gpr_once g_init_openssl_once = GPR_ONCE_INIT;
 static int g_ssl_ctx_ex_factory_index = -1;
+static int g_ssl_ctx_ex_ticket_keys_index = -1;
 static const unsigned char kSslSessionIdContext[] = {'g', 'r', 'p', 'c'};
 #if !defined(OPENSSL_IS_BORINGSSL) && !defined(OPENSSL_NO_ENGINE)
 static const char kSslEnginePrefix[] = "engine:";
@@ -187,6 +229,9 @@ static void init_openssl(void) {
   g_ssl_ctx_ex_factory_index =
       SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
   GPR_ASSERT(g_ssl_ctx_ex_factory_index != -1);
+  g_ssl_ctx_ex_ticket_keys_index =
+      SSL_CTX_get_ex_new_index(0, nullptr, nullptr, nullptr, nullptr);
+  GPR_ASSERT(g_ssl_ctx_ex_ticket_keys_index != -1);
 }
 
 /* --- Ssl utils. ---*/
@@ -1004,6 +1049,111 @@ void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache) {
   reinterpret_cast<tsi::SslSessionLRUCache*>(cache)->Unref();
 }
 
+/* --- tsi_ssl_session_ticket_keys methods implementation. ---*/
+
+tsi_ssl_session_ticket_keys* tsi_ssl_session_ticket_keys_create(void) {
+  tsi_ssl_session_ticket_keys* keys =
+      static_cast<tsi_ssl_session_ticket_keys*>(gpr_zalloc(sizeof(*keys)));
+  gpr_ref_init(&keys->refcount, 1);
+  gpr_mu_init(&keys->mu);
+  return keys;
+}
+
+tsi_result tsi_ssl_session_ticket_keys_set(tsi_ssl_session_ticket_keys* keys,
+                                           const char* const* key_data,
+                                           size_t key_size, size_t num_keys) {
+  if (keys == nullptr || (num_keys > 0 && key_data == nullptr)) {
+    return TSI_INVALID_ARGUMENT;
+  }
+  if (key_size != TSI_SSL_TICKET_KEY_SIZE_AES_128 &&
+      key_size != TSI_SSL_TICKET_KEY_SIZE_AES_256) {
+    gpr_log(GPR_ERROR, "Invalid session ticket key size %zu.", key_size);
+    return TSI_INVALID_ARGUMENT;
+  }
+  unsigned char* new_keys = nullptr;
+  if (num_keys > 0) {
+    new_keys = static_cast<unsigned char*>(gpr_malloc(num_keys * key_size));
+    for (size_t i = 0; i < num_keys; i++) {
+      memcpy(new_keys + i * key_size, key_data[i], key_size);
+    }
+  }
+  gpr_mu_lock(&keys->mu);
+  unsigned char* old_keys = keys->keys;
+  keys->keys = new_keys;
+  keys->key_size = key_size;
+  keys->num_keys = num_keys;
+  gpr_mu_unlock(&keys->mu);
+  gpr_free(old_keys);
+  return TSI_OK;
+}
+
+void tsi_ssl_session_ticket_keys_ref(tsi_ssl_session_ticket_keys* keys) {
+  gpr_ref(&keys->refcount);
+}
+
+void tsi_ssl_session_ticket_keys_unref(tsi_ssl_session_ticket_keys* keys) {
+  if (keys == nullptr || !gpr_unref(&keys->refcount)) return;
+  gpr_free(keys->keys);
+  gpr_mu_destroy(&keys->mu);
+  gpr_free(keys);
+}
+
+/* Session ticket key callback of server SSL contexts. Encrypts new tickets with
+   the current key and decrypts tickets issued under any key of the set. Tickets
+   issued under an older key are renewed. */
+static int ssl_server_session_ticket_key_callback(
+    SSL* ssl, unsigned char* key_name, unsigned char* iv,
+    EVP_CIPHER_CTX* cipher_ctx, HMAC_CTX* hmac_ctx, int encrypt) {
+  tsi_ssl_session_ticket_keys* keys = static_cast<tsi_ssl_session_ticket_keys*>(
+      SSL_CTX_get_ex_data(SSL_get_SSL_CTX(ssl), g_ssl_ctx_ex_ticket_keys_index));
+  if (keys == nullptr) return 0;
+  unsigned char key[TSI_SSL_TICKET_KEY_SIZE_AES_256];
+  size_t key_size = 0;
+  size_t key_index = 0;
+  gpr_mu_lock(&keys->mu);
+  if (encrypt) {
+    if (keys->num_keys > 0) key_size = keys->key_size;
+  } else {
+    for (; key_index < keys->num_keys; key_index++) {
+      const unsigned char* candidate = keys->keys + key_index * keys->key_size;
+      if (memcmp(candidate, key_name, TSI_SSL_TICKET_KEY_NAME_SIZE) == 0) {
+        key_size = keys->key_size;
+        break;
+      }
+    }
+  }
+  if (key_size > 0) {
+    memcpy(key, keys->keys + key_index * key_size, key_size);
+  }
+  gpr_mu_unlock(&keys->mu);
+  /* Without a key, no ticket is issued or the ticket is ignored, which falls
+     back to a full handshake. */
+  if (key_size == 0) return 0;
+  const size_t secret_size = (key_size - TSI_SSL_TICKET_KEY_NAME_SIZE) / 2;
+  const unsigned char* hmac_key = key + TSI_SSL_TICKET_KEY_NAME_SIZE;
+  const unsigned char* aes_key = hmac_key + secret_size;
+  const EVP_CIPHER* cipher = key_size == TSI_SSL_TICKET_KEY_SIZE_AES_128
+                                 ? EVP_aes_128_cbc()
+                                 : EVP_aes_256_cbc();
+  int result = -1;
+  if (encrypt) {
+    memcpy(key_name, key, TSI_SSL_TICKET_KEY_NAME_SIZE);
+    if (RAND_bytes(iv, EVP_CIPHER_iv_length(cipher)) == 1 &&
+        EVP_EncryptInit_ex(cipher_ctx, cipher, nullptr, aes_key, iv) == 1 &&
+        HMAC_Init_ex(hmac_ctx, hmac_key, static_cast<int>(secret_size),
+                     EVP_sha256(), nullptr) == 1) {
+      result = 1;
+    }
+  } else if (EVP_DecryptInit_ex(cipher_ctx, cipher, nullptr, aes_key, iv) ==
+                 1 &&
+             HMAC_Init_ex(hmac_ctx, hmac_key, static_cast<int>(secret_size),
+                          EVP_sha256(), nullptr) == 1) {
+    result = key_index == 0 ? 1 : 2;
+  }
+  OPENSSL_cleanse(key, sizeof(key));
+  return result;
+}
+
 /* --- tsi_frame_protector methods implementation. ---*/
 
 static tsi_result ssl_protector_protect(tsi_frame_protector* self,
@@ -1155,6 +1305,200 @@ static const tsi_frame_protector_vtable frame_protector_vtable = {
     ssl_protector_destroy,
 };
 
+/* --- tsi_zero_copy_grpc_protector methods implementation. ---*/
+
+/* Moves all the protected bytes SSL has produced into protected_slices. */
+static tsi_result ssl_zero_copy_grpc_protector_drain_network_io(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* protected_slices) {
+  int pending = static_cast<int>(BIO_pending(impl->network_io));
+  while (pending > 0) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(static_cast<size_t>(pending));
+    int read_from_ssl =
+        BIO_read(impl->network_io, GRPC_SLICE_START_PTR(slice), pending);
+    if (read_from_ssl <= 0) {
+      gpr_log(GPR_ERROR, "Could not read from BIO after SSL_write.");
+      grpc_slice_unref_internal(slice);
+      return TSI_INTERNAL_ERROR;
+    }
+    grpc_slice_buffer_add(
+        protected_slices,
+        grpc_slice_split_head(&slice, static_cast<size_t>(read_from_ssl)));
+    grpc_slice_unref_internal(slice);
+    pending = static_cast<int>(BIO_pending(impl->network_io));
+  }
+  return TSI_OK;
+}
+
+/* Seals size bytes into a single record and appends it to protected_slices. */
+static tsi_result ssl_zero_copy_grpc_protector_seal(
+    tsi_ssl_zero_copy_grpc_protector* impl, unsigned char* bytes, size_t size,
+    grpc_slice_buffer* protected_slices) {
+  tsi_result result = do_ssl_write(impl->ssl, bytes, size);
+  if (result != TSI_OK) return result;
+  return ssl_zero_copy_grpc_protector_drain_network_io(impl, protected_slices);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect_locked(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  /* First flush anything SSL produced on its own, e.g. alerts. */
+  tsi_result result =
+      ssl_zero_copy_grpc_protector_drain_network_io(impl, protected_slices);
+  if (result != TSI_OK) return result;
+  size_t buffered = 0;
+  for (size_t i = 0; i < unprotected_slices->count; ++i) {
+    unsigned char* bytes = GRPC_SLICE_START_PTR(unprotected_slices->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(unprotected_slices->slices[i]);
+    while (remaining > 0) {
+      size_t consumed;
+      if (buffered == 0 && remaining >= impl->max_unprotected_frame_size) {
+        /* A full record's worth: seal it straight from the caller's slice. */
+        consumed = impl->max_unprotected_frame_size;
+        result = ssl_zero_copy_grpc_protector_seal(impl, bytes, consumed,
+                                                   protected_slices);
+      } else {
+        consumed = GPR_MIN(remaining,
+                           impl->max_unprotected_frame_size - buffered);
+        memcpy(impl->buffer + buffered, bytes, consumed);
+        buffered += consumed;
+        if (buffered == impl->max_unprotected_frame_size) {
+          result = ssl_zero_copy_grpc_protector_seal(
+              impl, impl->buffer, buffered, protected_slices);
+          buffered = 0;
+        }
+      }
+      if (result != TSI_OK) return result;
+      bytes += consumed;
+      remaining -= consumed;
+    }
+  }
+  if (buffered > 0) {
+    result = ssl_zero_copy_grpc_protector_seal(impl, impl->buffer, buffered,
+                                               protected_slices);
+  }
+  return result;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_protect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* unprotected_slices,
+    grpc_slice_buffer* protected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    gpr_log(GPR_ERROR, "Invalid nullptr arguments to zero-copy grpc protect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = ssl_zero_copy_grpc_protector_protect_locked(
+      impl, unprotected_slices, protected_slices);
+  gpr_mu_unlock(&impl->mu);
+  grpc_slice_buffer_reset_and_unref_internal(unprotected_slices);
+  return result;
+}
+
+/* Decrypts every complete record buffered in SSL into unprotected_slices. */
+static tsi_result ssl_zero_copy_grpc_protector_open_records(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* unprotected_slices) {
+  while (true) {
+    if (GRPC_SLICE_LENGTH(impl->read_slice) <
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+      grpc_slice_unref_internal(impl->read_slice);
+      impl->read_slice = GRPC_SLICE_MALLOC(TSI_SSL_MAX_RECORD_PLAINTEXT_SIZE);
+    }
+    size_t read_size = GRPC_SLICE_LENGTH(impl->read_slice);
+    tsi_result result = do_ssl_read(
+        impl->ssl, GRPC_SLICE_START_PTR(impl->read_slice), &read_size);
+    if (result != TSI_OK || read_size == 0) return result;
+    grpc_slice_buffer_add(unprotected_slices,
+                          grpc_slice_split_head(&impl->read_slice, read_size));
+  }
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect_locked(
+    tsi_ssl_zero_copy_grpc_protector* impl,
+    grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  for (size_t i = 0; i < protected_slices->count; ++i) {
+    const unsigned char* bytes =
+        GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    while (remaining > 0) {
+      /* The BIO pair has a bounded buffer, so feed it as much as it takes and
+         let SSL consume complete records before feeding it more. */
+      int written_into_ssl =
+          BIO_write(impl->network_io, bytes,
+                    static_cast<int>(GPR_MIN(remaining, INT_MAX)));
+      if (written_into_ssl > 0) {
+        bytes += written_into_ssl;
+        remaining -= static_cast<size_t>(written_into_ssl);
+      }
+      tsi_result result =
+          ssl_zero_copy_grpc_protector_open_records(impl, unprotected_slices);
+      if (result != TSI_OK) return result;
+      if (written_into_ssl <= 0 &&
+          BIO_ctrl_get_write_guarantee(impl->network_io) == 0) {
+        gpr_log(GPR_ERROR, "Sending protected frame to ssl failed with %d",
+                written_into_ssl);
+        return TSI_INTERNAL_ERROR;
+      }
+    }
+  }
+  return TSI_OK;
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_unprotect(
+    tsi_zero_copy_grpc_protector* self, grpc_slice_buffer* protected_slices,
+    grpc_slice_buffer* unprotected_slices) {
+  if (self == nullptr || unprotected_slices == nullptr ||
+      protected_slices == nullptr) {
+    gpr_log(GPR_ERROR,
+            "Invalid nullptr arguments to zero-copy grpc unprotect.");
+    return TSI_INVALID_ARGUMENT;
+  }
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  gpr_mu_lock(&impl->mu);
+  tsi_result result = ssl_zero_copy_grpc_protector_unprotect_locked(
+      impl, protected_slices, unprotected_slices);
+  gpr_mu_unlock(&impl->mu);
+  grpc_slice_buffer_reset_and_unref_internal(protected_slices);
+  return result;
+}
+
+static void ssl_zero_copy_grpc_protector_destroy(
+    tsi_zero_copy_grpc_protector* self) {
+  if (self == nullptr) return;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  grpc_slice_unref_internal(impl->read_slice);
+  gpr_free(impl->buffer);
+  if (impl->ssl != nullptr) SSL_free(impl->ssl);
+  if (impl->network_io != nullptr) BIO_free(impl->network_io);
+  gpr_mu_destroy(&impl->mu);
+  gpr_free(impl);
+}
+
+static tsi_result ssl_zero_copy_grpc_protector_max_frame_size(
+    tsi_zero_copy_grpc_protector* self, size_t* max_frame_size) {
+  if (self == nullptr || max_frame_size == nullptr) return TSI_INVALID_ARGUMENT;
+  tsi_ssl_zero_copy_grpc_protector* impl =
+      reinterpret_cast<tsi_ssl_zero_copy_grpc_protector*>(self);
+  *max_frame_size = impl->max_protected_frame_size;
+  return TSI_OK;
+}
+
+static const tsi_zero_copy_grpc_protector_vtable
+    zero_copy_grpc_protector_vtable = {
+        ssl_zero_copy_grpc_protector_protect,
+        ssl_zero_copy_grpc_protector_unprotect,
+        ssl_zero_copy_grpc_protector_destroy,
+        ssl_zero_copy_grpc_protector_max_frame_size,
+};
+
 /* --- tsi_server_handshaker_factory methods implementation. --- */
 
 static void tsi_ssl_handshaker_factory_destroy(
@@ -1289,11 +1633,58 @@ static tsi_result ssl_handshaker_result_extract_peer(
   return result;
 }
 
+/* Clamps the requested max protected frame size, if any, to the supported
+   range and returns the size to use. */
+static size_t ssl_clamp_max_protected_frame_size(
+    size_t* max_output_protected_frame_size) {
+  if (max_output_protected_frame_size == nullptr) {
+    return TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  }
+  if (*max_output_protected_frame_size >
+      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+  } else if (*max_output_protected_frame_size <
+             TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
+    *max_output_protected_frame_size =
+        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
+  }
+  return *max_output_protected_frame_size;
+}
+
+static tsi_result ssl_handshaker_result_create_zero_copy_grpc_protector(
+    const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
+    tsi_zero_copy_grpc_protector** protector) {
+  tsi_ssl_handshaker_result* impl =
+      reinterpret_cast<tsi_ssl_handshaker_result*>(
+          const_cast<tsi_handshaker_result*>(self));
+  tsi_ssl_zero_copy_grpc_protector* protector_impl =
+      static_cast<tsi_ssl_zero_copy_grpc_protector*>(
+          gpr_zalloc(sizeof(*protector_impl)));
+  protector_impl->max_protected_frame_size =
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
+  protector_impl->max_unprotected_frame_size =
+      protector_impl->max_protected_frame_size -
+      TSI_SSL_MAX_PROTECTION_OVERHEAD;
+  protector_impl->buffer = static_cast<unsigned char*>(
+      gpr_malloc(protector_impl->max_unprotected_frame_size));
+  protector_impl->read_slice = grpc_empty_slice();
+  gpr_mu_init(&protector_impl->mu);
+  /* Transfer ownership of ssl and network_io to the protector. */
+  protector_impl->ssl = impl->ssl;
+  impl->ssl = nullptr;
+  protector_impl->network_io = impl->network_io;
+  impl->network_io = nullptr;
+  protector_impl->base.vtable = &zero_copy_grpc_protector_vtable;
+  *protector = &protector_impl->base;
+  return TSI_OK;
+}
+
 static tsi_result ssl_handshaker_result_create_frame_protector(
     const tsi_handshaker_result* self, size_t* max_output_protected_frame_size,
     tsi_frame_protector** protector) {
   size_t actual_max_output_protected_frame_size =
-      TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
+      ssl_clamp_max_protected_frame_size(max_output_protected_frame_size);
   tsi_ssl_handshaker_result* impl =
       reinterpret_cast<tsi_ssl_handshaker_result*>(
           const_cast<tsi_handshaker_result*>(self));
@@ -1301,18 +1692,6 @@ static tsi_result ssl_handshaker_result_create_frame_protector(
       static_cast<tsi_ssl_frame_protector*>(
           gpr_zalloc(sizeof(*protector_impl)));
 
-  if (max_output_protected_frame_size != nullptr) {
-    if (*max_output_protected_frame_size >
-        TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_UPPER_BOUND;
-    } else if (*max_output_protected_frame_size <
-               TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND) {
-      *max_output_protected_frame_size =
-          TSI_SSL_MAX_PROTECTED_FRAME_SIZE_LOWER_BOUND;
-    }
-    actual_max_output_protected_frame_size = *max_output_protected_frame_size;
-  }
   protector_impl->buffer_size =
       actual_max_output_protected_frame_size - TSI_SSL_MAX_PROTECTION_OVERHEAD;
   protector_impl->buffer =
@@ -1355,7 +1734,7 @@ static void ssl_handshaker_result_destroy(tsi_handshaker_result* self) {
 
 static const tsi_handshaker_result_vtable handshaker_result_vtable = {
     ssl_handshaker_result_extract_peer,
-    nullptr, /* create_zero_copy_grpc_protector */
+    ssl_handshaker_result_create_zero_copy_grpc_protector,
     ssl_handshaker_result_create_frame_protector,
     ssl_handshaker_result_get_unused_bytes,
     ssl_handshaker_result_destroy,
@@ -1759,6 +2138,7 @@ static void tsi_ssl_server_handshaker_factory_destroy(
     gpr_free(self->ssl_context_x509_subject_names);
   }
   if (self->alpn_protocol_list != nullptr) gpr_free(self->alpn_protocol_list);
+  tsi_ssl_session_ticket_keys_unref(self->session_ticket_keys);
   gpr_free(self);
 }
 
@@ -2060,6 +2440,10 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
     return TSI_OUT_OF_RESOURCES;
   }
   impl->ssl_context_count = options->num_key_cert_pairs;
+  if (options->session_ticket_keys != nullptr) {
+    tsi_ssl_session_ticket_keys_ref(options->session_ticket_keys);
+    impl->session_ticket_keys = options->session_ticket_keys;
+  }
 
   if (options->num_alpn_protocols > 0) {
     result = build_alpn_protocol_name_list(
@@ -2104,7 +2488,13 @@ tsi_result tsi_create_ssl_server_handshaker_factory_with_options(
         break;
       }
 
-      if (options->session_ticket_key != nullptr) {
+      if (impl->session_ticket_keys != nullptr) {
+        SSL_CTX_set_ex_data(impl->ssl_contexts[i],
+                            g_ssl_ctx_ex_ticket_keys_index,
+                            impl->session_ticket_keys);
+        SSL_CTX_set_tlsext_ticket_key_cb(
+            impl->ssl_contexts[i], ssl_server_session_ticket_key_callback);
+      } else if (options->session_ticket_key != nullptr) {
         if (SSL_CTX_set_tlsext_ticket_keys(
                 impl->ssl_contexts[i],
                 const_cast<char*>(options->session_ticket_key),
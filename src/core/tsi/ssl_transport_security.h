@@ -75,6 +75,34 @@ void tsi_ssl_session_cache_ref(tsi_ssl_session_cache* cache);
 /* Decrement reference counter of \a cache.  */
 void tsi_ssl_session_cache_unref(tsi_ssl_session_cache* cache);
 
+/* --- tsi_ssl_session_ticket_keys object ---
+
+   Session ticket encryption keys shared by server handshaker factories. The
+   first key encrypts new tickets and every key is accepted when resuming, so
+   that a new key can be introduced ahead of the old one without invalidating
+   tickets that clients already hold. Keys may be replaced at any time, including
+   while handshakes are in progress.  */
+
+typedef struct tsi_ssl_session_ticket_keys tsi_ssl_session_ticket_keys;
+
+/* Create an empty set of session ticket keys. Servers using an empty set do
+   not issue tickets.  */
+tsi_ssl_session_ticket_keys* tsi_ssl_session_ticket_keys_create(void);
+
+/* Replace the keys in \a keys with \a num_keys keys of \a key_size bytes each,
+   current key first. Each key is made of a 16-byte name followed by equally
+   sized HMAC and AES keys, so \a key_size must be 48 (AES-128) or 80
+   (AES-256). Returns TSI_INVALID_ARGUMENT if it is neither.  */
+tsi_result tsi_ssl_session_ticket_keys_set(tsi_ssl_session_ticket_keys* keys,
+                                           const char* const* key_data,
+                                           size_t key_size, size_t num_keys);
+
+/* Increment reference counter of \a keys.  */
+void tsi_ssl_session_ticket_keys_ref(tsi_ssl_session_ticket_keys* keys);
+
+/* Decrement reference counter of \a keys.  */
+void tsi_ssl_session_ticket_keys_unref(tsi_ssl_session_ticket_keys* keys);
+
 /* --- tsi_ssl_client_handshaker_factory object ---
 
    This object creates a client tsi_handshaker objects implemented in terms of
@@ -283,6 +311,9 @@ struct tsi_ssl_server_handshaker_options {
   const char* session_ticket_key;
   /* session_ticket_key_size is a size of session ticket encryption key. */
   size_t session_ticket_key_size;
+  /* session_ticket_keys is an optional, rotatable set of session ticket keys.
+     If set, it takes precedence over session_ticket_key. */
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
   /* The min and max TLS versions that will be negotiated by the handshaker. */
   tsi_tls_version min_tls_version;
   tsi_tls_version max_tls_version;
@@ -297,6 +328,7 @@ struct tsi_ssl_server_handshaker_options {
         num_alpn_protocols(0),
         session_ticket_key(nullptr),
         session_ticket_key_size(0),
+        session_ticket_keys(nullptr),
         min_tls_version(tsi_tls_version::TSI_TLS1_2),
         max_tls_version(tsi_tls_version::TSI_TLS1_3) {}
 };
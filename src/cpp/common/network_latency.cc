@@ -0,0 +1,62 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include <grpcpp/ext/network_latency.h>
+
+#include "src/core/lib/debug/network_latency.h"
+#include "src/core/lib/surface/call.h"
+
+namespace grpc {
+namespace experimental {
+namespace {
+
+bool GetCallNetworkLatency(grpc_call* call, NetworkLatency* latency) {
+  if (call == nullptr) return false;
+  grpc_core::CallNetworkLatency* network_latency =
+      static_cast<grpc_core::CallNetworkLatency*>(
+          grpc_call_context_get(call, GRPC_CONTEXT_NETWORK_LATENCY));
+  if (network_latency == nullptr) return false;
+  const grpc_core::CallNetworkLatency::Stats stats = network_latency->stats();
+  auto fill_stage = [&stats](grpc_core::NetworkLatencyStage stage,
+                             NetworkLatency::Stage* out) {
+    out->total =
+        std::chrono::microseconds(stats.total_us[static_cast<int>(stage)]);
+    out->max = std::chrono::microseconds(stats.max_us[static_cast<int>(stage)]);
+  };
+  latency->traced_writes = stats.traced_writes;
+  fill_stage(grpc_core::NetworkLatencyStage::kQueuedInKernel,
+             &latency->queued_in_kernel);
+  fill_stage(grpc_core::NetworkLatencyStage::kOnWire, &latency->on_wire);
+  fill_stage(grpc_core::NetworkLatencyStage::kUntilAcked,
+             &latency->until_acked);
+  return true;
+}
+
+}  // namespace
+
+bool GetNetworkLatency(grpc::ClientContext* context, NetworkLatency* latency) {
+  return GetCallNetworkLatency(context->c_call(), latency);
+}
+
+bool GetNetworkLatency(grpc::ServerContextBase* context,
+                       NetworkLatency* latency) {
+  return GetCallNetworkLatency(context->c_call(), latency);
+}
+
+}  // namespace experimental
+}  // namespace grpc
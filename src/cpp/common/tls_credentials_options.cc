@@ -184,5 +184,40 @@ void TlsServerCredentialsOptions::set_cert_request_type(
                                                      cert_request_type);
 }
 
+void TlsServerCredentialsOptions::set_session_ticket_keys(
+    std::shared_ptr<TlsSessionTicketKeys> session_ticket_keys) {
+  GPR_ASSERT(session_ticket_keys != nullptr);
+  session_ticket_keys_ = std::move(session_ticket_keys);
+  grpc_tls_credentials_options* options = c_credentials_options();
+  GPR_ASSERT(options != nullptr);
+  grpc_tls_credentials_options_set_session_ticket_keys(
+      options, session_ticket_keys_->c_keys());
+}
+
+/** gRPC TLS session ticket keys API implementation **/
+TlsSessionTicketKeys::TlsSessionTicketKeys()
+    : c_keys_(grpc_tls_session_ticket_keys_create()) {}
+
+TlsSessionTicketKeys::~TlsSessionTicketKeys() {
+  grpc_tls_session_ticket_keys_release(c_keys_);
+}
+
+bool TlsSessionTicketKeys::Set(const std::vector<std::string>& keys) {
+  if (keys.empty()) {
+    gpr_log(GPR_ERROR, "At least one session ticket key is required.");
+    return false;
+  }
+  std::vector<const char*> key_data;
+  for (const std::string& key : keys) {
+    if (key.size() != keys[0].size()) {
+      gpr_log(GPR_ERROR, "All session ticket keys must have the same size.");
+      return false;
+    }
+    key_data.push_back(key.data());
+  }
+  return grpc_tls_session_ticket_keys_set(c_keys_, key_data.data(),
+                                          keys[0].size(), keys.size()) != 0;
+}
+
 }  // namespace experimental
 }  // namespace grpc
@@ -0,0 +1,89 @@
+//
+//
+// Copyright 2021 gRPC authors.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+//
+//
+
+#include <grpc/support/port_platform.h>
+
+#include <grpcpp/ext/metrics_exporter.h>
+
+#include <grpc/grpc.h>
+#include <grpcpp/impl/codegen/method_handler.h>
+#include <grpcpp/impl/codegen/rpc_service_method.h>
+#include <grpcpp/impl/codegen/service_type.h>
+#include <grpcpp/support/byte_buffer.h>
+#include <grpcpp/support/slice.h>
+
+#include "src/core/lib/debug/stats.h"
+
+namespace grpc {
+namespace experimental {
+
+namespace {
+
+// Serves GetOpenMetrics() without a proto: the request is ignored and the
+// response is the text itself.
+class MetricsService : public Service {
+ public:
+  MetricsService() {
+    AddMethod(new internal::RpcServiceMethod(
+        kMetricsServiceMethod, internal::RpcMethod::NORMAL_RPC,
+        new internal::RpcMethodHandler<MetricsService, ByteBuffer, ByteBuffer>(
+            [](MetricsService* /*service*/, ServerContext* /*context*/,
+               const ByteBuffer* /*request*/, ByteBuffer* response) {
+              Slice slice(GetOpenMetrics());
+              *response = ByteBuffer(&slice, 1);
+              return Status::OK;
+            },
+            this)));
+  }
+};
+
+auto* g_metrics_service = new MetricsService();
+
+}  // namespace
+
+const char kMetricsServiceMethod[] = "/grpc.admin.v1.Metrics/GetOpenMetrics";
+
+const char kOpenMetricsContentType[] =
+    "application/openmetrics-text; version=1.0.0; charset=utf-8";
+
+MetricsCounter::MetricsCounter(const std::string& name,
+                               const std::string& help)
+    : counter_(new grpc_core::StatsCounter(name, help)) {}
+
+MetricsCounter::~MetricsCounter() { delete counter_; }
+
+void MetricsCounter::Increment(int64_t delta) { counter_->Increment(delta); }
+
+int64_t MetricsCounter::Value() const { return counter_->Value(); }
+
+std::string GetOpenMetrics() {
+  // The per-CPU stats only exist while the library is initialized.
+  grpc_init();
+  grpc_stats_data data;
+  grpc_stats_collect(&data);
+  std::string text = grpc_stats_data_as_openmetrics(&data);
+  grpc_shutdown();
+  return text;
+}
+
+void AddMetricsService(ServerBuilder* builder) {
+  builder->RegisterService(g_metrics_service);
+}
+
+}  // namespace experimental
+}  // namespace grpc
@@ -406,8 +406,8 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
       // Set interception point for RECV MESSAGE
       auto* handler = resources_ ? method_->handler()
                                  : server_->resource_exhausted_handler_.get();
-      deserialized_request_ = handler->Deserialize(call_, request_payload_,
-                                                   &request_status_, nullptr);
+      deserialized_request_ = handler->Deserialize(
+          call_, request_payload_, &request_status_, &handler_data_);
 
       request_payload_ = nullptr;
       interceptor_methods_.AddInterceptionHookPoint(
@@ -431,7 +431,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
                                : server_->resource_exhausted_handler_.get();
     handler->RunHandler(grpc::internal::MethodHandler::HandlerParameter(
         &*wrapped_call_, &ctx_->ctx, deserialized_request_, request_status_,
-        nullptr, nullptr));
+        handler_data_, nullptr));
     global_callbacks_->PostSynchronousRequest(&ctx_->ctx);
 
     cq_.Shutdown();
@@ -490,6 +490,7 @@ class Server::SyncRequest final : public grpc::internal::CompletionQueueTag {
   std::shared_ptr<GlobalCallbacks> global_callbacks_;
   bool resources_;
   void* deserialized_request_ = nullptr;
+  void* handler_data_ = nullptr;
   grpc::internal::InterceptorBatchMethodsImpl interceptor_methods_;
 
   // ServerContextWrapper allows ManualConstructor while using a private
@@ -657,6 +657,8 @@ cdef extern from "grpc/compression.h":
     GRPC_COMPRESS_DEFLATE
     GRPC_COMPRESS_GZIP
     GRPC_COMPRESS_STREAM_GZIP
+    GRPC_COMPRESS_ZSTD
+    GRPC_COMPRESS_LZ4
     GRPC_COMPRESS_ALGORITHMS_COUNT
 
   ctypedef enum grpc_compression_level:
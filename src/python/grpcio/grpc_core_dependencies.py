@@ -342,6 +342,8 @@ CORE_SOURCE_FILES = [
     'src/core/lib/compression/stream_compression.cc',
     'src/core/lib/compression/stream_compression_gzip.cc',
     'src/core/lib/compression/stream_compression_identity.cc',
+    'src/core/lib/debug/call_phase_tracer.cc',
+    'src/core/lib/debug/network_latency.cc',
     'src/core/lib/debug/stats.cc',
     'src/core/lib/debug/stats_data.cc',
     'src/core/lib/debug/trace.cc',
@@ -506,6 +508,7 @@ CORE_SOURCE_FILES = [
     'src/core/lib/security/credentials/composite/composite_credentials.cc',
     'src/core/lib/security/credentials/credentials.cc',
     'src/core/lib/security/credentials/credentials_metadata.cc',
+    'src/core/lib/security/credentials/credentials_metadata_cache.cc',
     'src/core/lib/security/credentials/external/aws_external_account_credentials.cc',
     'src/core/lib/security/credentials/external/aws_request_signer.cc',
     'src/core/lib/security/credentials/external/external_account_credentials.cc',
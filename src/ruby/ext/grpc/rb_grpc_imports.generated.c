@@ -178,6 +178,10 @@ grpc_tls_credentials_options_set_root_cert_name_type grpc_tls_credentials_option
 grpc_tls_credentials_options_watch_identity_key_cert_pairs_type grpc_tls_credentials_options_watch_identity_key_cert_pairs_import;
 grpc_tls_credentials_options_set_identity_cert_name_type grpc_tls_credentials_options_set_identity_cert_name_import;
 grpc_tls_credentials_options_set_server_authorization_check_config_type grpc_tls_credentials_options_set_server_authorization_check_config_import;
+grpc_tls_session_ticket_keys_create_type grpc_tls_session_ticket_keys_create_import;
+grpc_tls_session_ticket_keys_set_type grpc_tls_session_ticket_keys_set_import;
+grpc_tls_session_ticket_keys_release_type grpc_tls_session_ticket_keys_release_import;
+grpc_tls_credentials_options_set_session_ticket_keys_type grpc_tls_credentials_options_set_session_ticket_keys_import;
 grpc_tls_server_authorization_check_config_create_type grpc_tls_server_authorization_check_config_create_import;
 grpc_tls_server_authorization_check_config_release_type grpc_tls_server_authorization_check_config_release_import;
 grpc_xds_credentials_create_type grpc_xds_credentials_create_import;
@@ -463,6 +467,10 @@ void grpc_rb_load_imports(HMODULE library) {
   grpc_tls_credentials_options_watch_identity_key_cert_pairs_import = (grpc_tls_credentials_options_watch_identity_key_cert_pairs_type) GetProcAddress(library, "grpc_tls_credentials_options_watch_identity_key_cert_pairs");
   grpc_tls_credentials_options_set_identity_cert_name_import = (grpc_tls_credentials_options_set_identity_cert_name_type) GetProcAddress(library, "grpc_tls_credentials_options_set_identity_cert_name");
   grpc_tls_credentials_options_set_server_authorization_check_config_import = (grpc_tls_credentials_options_set_server_authorization_check_config_type) GetProcAddress(library, "grpc_tls_credentials_options_set_server_authorization_check_config");
+  grpc_tls_session_ticket_keys_create_import = (grpc_tls_session_ticket_keys_create_type) GetProcAddress(library, "grpc_tls_session_ticket_keys_create");
+  grpc_tls_session_ticket_keys_set_import = (grpc_tls_session_ticket_keys_set_type) GetProcAddress(library, "grpc_tls_session_ticket_keys_set");
+  grpc_tls_session_ticket_keys_release_import = (grpc_tls_session_ticket_keys_release_type) GetProcAddress(library, "grpc_tls_session_ticket_keys_release");
+  grpc_tls_credentials_options_set_session_ticket_keys_import = (grpc_tls_credentials_options_set_session_ticket_keys_type) GetProcAddress(library, "grpc_tls_credentials_options_set_session_ticket_keys");
   grpc_tls_server_authorization_check_config_create_import = (grpc_tls_server_authorization_check_config_create_type) GetProcAddress(library, "grpc_tls_server_authorization_check_config_create");
   grpc_tls_server_authorization_check_config_release_import = (grpc_tls_server_authorization_check_config_release_type) GetProcAddress(library, "grpc_tls_server_authorization_check_config_release");
   grpc_xds_credentials_create_import = (grpc_xds_credentials_create_type) GetProcAddress(library, "grpc_xds_credentials_create");
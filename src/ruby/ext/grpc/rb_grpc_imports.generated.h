@@ -509,6 +509,18 @@ extern grpc_tls_credentials_options_set_identity_cert_name_type grpc_tls_credent
 typedef void(*grpc_tls_credentials_options_set_server_authorization_check_config_type)(grpc_tls_credentials_options* options, grpc_tls_server_authorization_check_config* config);
 extern grpc_tls_credentials_options_set_server_authorization_check_config_type grpc_tls_credentials_options_set_server_authorization_check_config_import;
 #define grpc_tls_credentials_options_set_server_authorization_check_config grpc_tls_credentials_options_set_server_authorization_check_config_import
+typedef grpc_tls_session_ticket_keys*(*grpc_tls_session_ticket_keys_create_type)(void);
+extern grpc_tls_session_ticket_keys_create_type grpc_tls_session_ticket_keys_create_import;
+#define grpc_tls_session_ticket_keys_create grpc_tls_session_ticket_keys_create_import
+typedef int(*grpc_tls_session_ticket_keys_set_type)(grpc_tls_session_ticket_keys* keys, const char** key_data, size_t key_size, size_t num_keys);
+extern grpc_tls_session_ticket_keys_set_type grpc_tls_session_ticket_keys_set_import;
+#define grpc_tls_session_ticket_keys_set grpc_tls_session_ticket_keys_set_import
+typedef void(*grpc_tls_session_ticket_keys_release_type)(grpc_tls_session_ticket_keys* keys);
+extern grpc_tls_session_ticket_keys_release_type grpc_tls_session_ticket_keys_release_import;
+#define grpc_tls_session_ticket_keys_release grpc_tls_session_ticket_keys_release_import
+typedef void(*grpc_tls_credentials_options_set_session_ticket_keys_type)(grpc_tls_credentials_options* options, grpc_tls_session_ticket_keys* keys);
+extern grpc_tls_credentials_options_set_session_ticket_keys_type grpc_tls_credentials_options_set_session_ticket_keys_import;
+#define grpc_tls_credentials_options_set_session_ticket_keys grpc_tls_credentials_options_set_session_ticket_keys_import
 typedef grpc_tls_server_authorization_check_config*(*grpc_tls_server_authorization_check_config_create_type)(const void* config_user_data, int (*schedule)(void* config_user_data, grpc_tls_server_authorization_check_arg* arg), void (*cancel)(void* config_user_data, grpc_tls_server_authorization_check_arg* arg), void (*destruct)(void* config_user_data));
 extern grpc_tls_server_authorization_check_config_create_type grpc_tls_server_authorization_check_config_create_import;
 #define grpc_tls_server_authorization_check_config_create grpc_tls_server_authorization_check_config_create_import
@@ -19,6 +19,9 @@
 #include <stdlib.h>
 #include <string.h>
 
+#include <set>
+#include <vector>
+
 #include <grpc/grpc.h>
 #include <gtest/gtest.h>
 
@@ -31,6 +34,7 @@
 #include "src/core/lib/channel/channelz_registry.h"
 #include "src/core/lib/gpr/useful.h"
 #include "src/core/lib/gprpp/memory.h"
+#include "src/core/lib/gprpp/thd.h"
 #include "src/core/lib/iomgr/exec_ctx.h"
 #include "src/core/lib/json/json.h"
 #include "src/core/lib/surface/channel.h"
@@ -141,6 +145,40 @@ TEST_F(ChannelzRegistryTest, TestUnregistration) {
   }
 }
 
+TEST_F(ChannelzRegistryTest, ConcurrentRegistration) {
+  const int kNumThreads = 8;
+  const int kNodesPerThread = 100;
+  struct ThreadArg {
+    std::vector<RefCountedPtr<BaseNode>> nodes;
+  };
+  std::vector<ThreadArg> args(kNumThreads);
+  std::vector<Thread> threads;
+  for (int i = 0; i < kNumThreads; i++) {
+    threads.emplace_back(
+        "channelz_registry_test",
+        [](void* arg) {
+          ThreadArg* thread_arg = static_cast<ThreadArg*>(arg);
+          for (int j = 0; j < kNodesPerThread; j++) {
+            thread_arg->nodes.push_back(CreateTestNode());
+            // Drop every other node, so that unregistration races too.
+            if (j % 2 == 1) thread_arg->nodes.pop_back();
+          }
+        },
+        &args[i]);
+    threads.back().Start();
+  }
+  for (Thread& thread : threads) thread.Join();
+  std::set<intptr_t> uuids;
+  for (ThreadArg& arg : args) {
+    for (const RefCountedPtr<BaseNode>& node : arg.nodes) {
+      EXPECT_TRUE(uuids.insert(node->uuid()).second);
+      EXPECT_EQ(ChannelzRegistry::Get(node->uuid()), node);
+    }
+  }
+  EXPECT_EQ(uuids.size(),
+            static_cast<size_t>(kNumThreads * kNodesPerThread / 2));
+}
+
 }  // namespace testing
 }  // namespace channelz
 }  // namespace grpc_core
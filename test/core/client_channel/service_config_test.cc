@@ -371,6 +371,41 @@ TEST_F(ServiceConfigTest, Parser2BasicTest) {
   EXPECT_EQ(static_cast<TestParsedConfig1*>(parsed_config)->value(), 5);
 }
 
+TEST_F(ServiceConfigTest, Parser2LookupByInternedPath) {
+  const char* test_json =
+      "{\"methodConfig\": ["
+      "{\"name\":[{\"service\":\"TestServ\",\"method\":\"TestMethod\"}], "
+      "\"method_param\":5},"
+      "{\"name\":[{\"service\":\"TestServ\"}], \"method_param\":6},"
+      "{\"name\":[{}], \"method_param\":7}]}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(nullptr, test_json, &error);
+  ASSERT_EQ(error, GRPC_ERROR_NONE) << grpc_error_string(error);
+  // Exact match, using both interned and non-interned paths.
+  grpc_slice interned_path = grpc_slice_intern(
+      grpc_slice_from_static_string("/TestServ/TestMethod"));
+  const auto* vector_ptr = svc_cfg->GetMethodParsedConfigVector(interned_path);
+  grpc_slice_unref(interned_path);
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(((*vector_ptr)[1]).get())->value(),
+            5);
+  EXPECT_EQ(svc_cfg->GetMethodParsedConfigVector(
+                grpc_slice_from_static_string("/TestServ/TestMethod")),
+            vector_ptr);
+  // Wildcard match.
+  vector_ptr = svc_cfg->GetMethodParsedConfigVector(
+      grpc_slice_from_static_string("/TestServ/OtherMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(((*vector_ptr)[1]).get())->value(),
+            6);
+  // Default method config.
+  vector_ptr = svc_cfg->GetMethodParsedConfigVector(
+      grpc_slice_from_static_string("/OtherServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  EXPECT_EQ(static_cast<TestParsedConfig1*>(((*vector_ptr)[1]).get())->value(),
+            7);
+}
+
 TEST_F(ServiceConfigTest, Parser2DisabledViaChannelArg) {
   grpc_arg arg = grpc_channel_arg_integer_create(
       const_cast<char*>(GRPC_ARG_DISABLE_PARSING), 1);
@@ -977,6 +1012,97 @@ TEST_F(ClientChannelParserTest, InvalidRetryPolicyRetryableStatusCodes) {
   GRPC_ERROR_UNREF(error);
 }
 
+TEST_F(ClientChannelParserTest, ValidHedgingPolicy) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3,\n"
+      "      \"hedgingDelay\": \"0.5s\",\n"
+      "      \"nonFatalStatusCodes\": [ \"UNAVAILABLE\" ]\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(nullptr, test_json, &error);
+  ASSERT_EQ(error, GRPC_ERROR_NONE) << grpc_error_string(error);
+  const auto* vector_ptr = svc_cfg->GetMethodParsedConfigVector(
+      grpc_slice_from_static_string("/TestServ/TestMethod"));
+  ASSERT_NE(vector_ptr, nullptr);
+  const auto* parsed_config =
+      static_cast<grpc_core::internal::ClientChannelMethodParsedConfig*>(
+          ((*vector_ptr)[0]).get());
+  EXPECT_EQ(parsed_config->retry_policy(), nullptr);
+  ASSERT_NE(parsed_config->hedging_policy(), nullptr);
+  EXPECT_EQ(parsed_config->hedging_policy()->max_attempts, 3);
+  EXPECT_EQ(parsed_config->hedging_policy()->hedging_delay, 500);
+  EXPECT_TRUE(parsed_config->hedging_policy()->non_fatal_status_codes.Contains(
+      GRPC_STATUS_UNAVAILABLE));
+  EXPECT_FALSE(parsed_config->hedging_policy()->non_fatal_status_codes.Contains(
+      GRPC_STATUS_ABORTED));
+}
+
+TEST_F(ClientChannelParserTest, InvalidHedgingPolicyMaxAttempts) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 1,\n"
+      "      \"hedgingDelay\": \"1s\"\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(nullptr, test_json, &error);
+  EXPECT_THAT(grpc_error_string(error),
+              ::testing::ContainsRegex(
+                  "Service config parsing error.*referenced_errors.*"
+                  "Method Params.*referenced_errors.*"
+                  "methodConfig.*referenced_errors.*"
+                  "Client channel parser.*referenced_errors.*"
+                  "hedgingPolicy.*referenced_errors.*"
+                  "field:maxAttempts error:should be at least 2"));
+  GRPC_ERROR_UNREF(error);
+}
+
+TEST_F(ClientChannelParserTest, RetryAndHedgingPoliciesAreMutuallyExclusive) {
+  const char* test_json =
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"TestServ\", \"method\": \"TestMethod\" }\n"
+      "    ],\n"
+      "    \"retryPolicy\": {\n"
+      "      \"maxAttempts\": 3,\n"
+      "      \"initialBackoff\": \"1s\",\n"
+      "      \"maxBackoff\": \"120s\",\n"
+      "      \"backoffMultiplier\": 1.6,\n"
+      "      \"retryableStatusCodes\": [ \"ABORTED\" ]\n"
+      "    },\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 3\n"
+      "    }\n"
+      "  } ]\n"
+      "}";
+  grpc_error* error = GRPC_ERROR_NONE;
+  auto svc_cfg = ServiceConfig::Create(nullptr, test_json, &error);
+  EXPECT_THAT(grpc_error_string(error),
+              ::testing::ContainsRegex(
+                  "Service config parsing error.*referenced_errors.*"
+                  "Method Params.*referenced_errors.*"
+                  "methodConfig.*referenced_errors.*"
+                  "Client channel parser.*referenced_errors.*"
+                  "field:hedgingPolicy error:retryPolicy and hedgingPolicy "
+                  "are mutually exclusive"));
+  GRPC_ERROR_UNREF(error);
+}
+
 TEST_F(ClientChannelParserTest, ValidHealthCheck) {
   const char* test_json =
       "{\n"
@@ -31,10 +31,11 @@
 
 static void test_compression_algorithm_parse(void) {
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity",    "gzip", "deflate",
+                               "stream/gzip", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
+      GRPC_COMPRESS_NONE,        GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_STREAM_GZIP, GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4};
   const char* invalid_names[] = {"gzip2", "foo", "", "2gzip"};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_parse");
@@ -63,10 +64,11 @@ static void test_compression_algorithm_name(void) {
   int success;
   const char* name;
   size_t i;
-  const char* valid_names[] = {"identity", "gzip", "deflate", "stream/gzip"};
+  const char* valid_names[] = {"identity",    "gzip", "deflate",
+                               "stream/gzip", "zstd", "lz4"};
   const grpc_compression_algorithm valid_algorithms[] = {
-      GRPC_COMPRESS_NONE, GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
-      GRPC_COMPRESS_STREAM_GZIP};
+      GRPC_COMPRESS_NONE,        GRPC_COMPRESS_GZIP, GRPC_COMPRESS_DEFLATE,
+      GRPC_COMPRESS_STREAM_GZIP, GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4};
 
   gpr_log(GPR_DEBUG, "test_compression_algorithm_name");
 
@@ -224,6 +226,64 @@ static void test_compression_algorithm_for_level(void) {
                grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
                                                     accepted_encodings));
   }
+
+  {
+    /* accept only zstd and lz4, which are only chosen when gRPC is built with
+       them */
+    uint32_t accepted_encodings = 0;
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_LZ4);
+#if defined(GRPC_HAVE_LZ4)
+    const grpc_compression_algorithm fastest = GRPC_COMPRESS_LZ4;
+#elif defined(GRPC_HAVE_ZSTD)
+    const grpc_compression_algorithm fastest = GRPC_COMPRESS_ZSTD;
+#else
+    const grpc_compression_algorithm fastest = GRPC_COMPRESS_NONE;
+#endif
+#if defined(GRPC_HAVE_ZSTD)
+    const grpc_compression_algorithm smallest = GRPC_COMPRESS_ZSTD;
+#elif defined(GRPC_HAVE_LZ4)
+    const grpc_compression_algorithm smallest = GRPC_COMPRESS_LZ4;
+#else
+    const grpc_compression_algorithm smallest = GRPC_COMPRESS_NONE;
+#endif
+
+    GPR_ASSERT(GRPC_COMPRESS_NONE ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_NONE,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(fastest == grpc_compression_algorithm_for_level(
+                              GRPC_COMPRESS_LEVEL_LOW, accepted_encodings));
+
+    GPR_ASSERT(smallest == grpc_compression_algorithm_for_level(
+                               GRPC_COMPRESS_LEVEL_HIGH, accepted_encodings));
+  }
+
+#if defined(GRPC_HAVE_ZSTD) && defined(GRPC_HAVE_LZ4)
+  {
+    /* accept all algorithms, including zstd and lz4 */
+    uint32_t accepted_encodings = 0;
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_NONE); /* always */
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_GZIP);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_DEFLATE);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_STREAM_GZIP);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_ZSTD);
+    GPR_BITSET(&accepted_encodings, GRPC_COMPRESS_LZ4);
+
+    GPR_ASSERT(GRPC_COMPRESS_LZ4 ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_LOW,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_GZIP ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_MED,
+                                                    accepted_encodings));
+
+    GPR_ASSERT(GRPC_COMPRESS_DEFLATE ==
+               grpc_compression_algorithm_for_level(GRPC_COMPRESS_LEVEL_HIGH,
+                                                    accepted_encodings));
+  }
+#endif
 }
 
 static void test_compression_enable_disable_algorithm(void) {
@@ -113,9 +113,18 @@ static grpc_slice repeated(char c, size_t length) {
   return out;
 }
 
+/* zstd and lz4 are only supported when gRPC is built with them. */
+static bool is_supported(grpc_message_compression_algorithm algorithm) {
+  return GPR_BITGET(grpc_compression_bitset_to_message_bitset(
+                        grpc_compression_supported_algorithms_bitset()),
+                    algorithm);
+}
+
 static compressability get_compressability(
     test_value id, grpc_message_compression_algorithm algorithm) {
-  if (algorithm == GRPC_MESSAGE_COMPRESS_NONE) return SHOULD_NOT_COMPRESS;
+  if (algorithm == GRPC_MESSAGE_COMPRESS_NONE || !is_supported(algorithm)) {
+    return SHOULD_NOT_COMPRESS;
+  }
   switch (id) {
     case ONE_A:
       return SHOULD_NOT_COMPRESS;
@@ -262,6 +271,118 @@ static void test_bad_decompression_data_stream(void) {
   grpc_slice_buffer_destroy(&output);
 }
 
+/* Streams are reused across messages: one that failed mid-stream must not
+   affect the next message. */
+static void test_decompression_after_failure(void) {
+  grpc_slice_buffer bad;
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&bad);
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&bad,
+                        grpc_slice_from_copied_buffer("\x78\xda\xff\xff", 4));
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  GPR_ASSERT(1 == grpc_msg_compress(GRPC_MESSAGE_COMPRESS_DEFLATE, &input,
+                                    &compressed));
+  for (int i = 0; i < 3; i++) {
+    GPR_ASSERT(
+        0 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_DEFLATE, &bad, &output));
+    GPR_ASSERT(0 == output.length);
+    GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_DEFLATE,
+                                        &compressed, &output));
+    GPR_ASSERT(output.length == input.length);
+    grpc_slice_buffer_reset_and_unref(&output);
+  }
+
+  grpc_slice_buffer_destroy(&bad);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+/* A message cut short fails to decompress with every algorithm, and does not
+   affect the next message. */
+static void test_truncated_decompression_data(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer truncated;
+  grpc_slice_buffer garbage;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&truncated);
+  grpc_slice_buffer_init(&garbage);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  for (int i = 0; i < GRPC_MESSAGE_COMPRESS_ALGORITHMS_COUNT; i++) {
+    const auto algorithm = static_cast<grpc_message_compression_algorithm>(i);
+    if (algorithm == GRPC_MESSAGE_COMPRESS_NONE || !is_supported(algorithm)) {
+      continue;
+    }
+    GPR_ASSERT(1 == grpc_msg_compress(algorithm, &input, &compressed));
+    for (size_t j = 0; j < compressed.count; j++) {
+      grpc_slice_buffer_add(&truncated, grpc_slice_ref(compressed.slices[j]));
+    }
+    grpc_slice_buffer_trim_end(&truncated, 1, &garbage);
+    for (int k = 0; k < 2; k++) {
+      GPR_ASSERT(0 == grpc_msg_decompress(algorithm, &truncated, &output));
+      GPR_ASSERT(0 == output.length);
+      GPR_ASSERT(1 == grpc_msg_decompress(algorithm, &compressed, &output));
+      GPR_ASSERT(output.length == input.length);
+      grpc_slice_buffer_reset_and_unref(&output);
+    }
+    grpc_slice_buffer_reset_and_unref(&compressed);
+    grpc_slice_buffer_reset_and_unref(&truncated);
+    grpc_slice_buffer_reset_and_unref(&garbage);
+  }
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&truncated);
+  grpc_slice_buffer_destroy(&garbage);
+  grpc_slice_buffer_destroy(&output);
+}
+
+/* Idle streams can be released, and new ones are created for later
+   messages. */
+static void test_trim_idle_streams(void) {
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input, create_test_value(ONE_KB_A));
+
+  grpc_core::ExecCtx exec_ctx;
+  for (int i = 0; i < 2; i++) {
+    GPR_ASSERT(1 == grpc_msg_compress(GRPC_MESSAGE_COMPRESS_GZIP, &input,
+                                      &compressed));
+    GPR_ASSERT(1 == grpc_msg_decompress(GRPC_MESSAGE_COMPRESS_GZIP,
+                                        &compressed, &output));
+    GPR_ASSERT(output.length == input.length);
+    /* At least the compression and the decompression stream are idle. */
+    GPR_ASSERT(grpc_msg_compress_trim_idle_streams() >= 2);
+    GPR_ASSERT(grpc_msg_compress_trim_idle_streams() == 0);
+    grpc_slice_buffer_reset_and_unref(&compressed);
+    grpc_slice_buffer_reset_and_unref(&output);
+  }
+
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
 static void test_bad_compression_algorithm(void) {
   grpc_slice_buffer input;
   grpc_slice_buffer output;
@@ -346,6 +467,9 @@ int main(int argc, char** argv) {
   test_bad_decompression_data_missing_trailer();
   test_bad_decompression_data_stream();
   test_bad_decompression_data_trailing_garbage();
+  test_decompression_after_failure();
+  test_truncated_decompression_data();
+  test_trim_idle_streams();
   test_bad_compression_algorithm();
   test_bad_decompression_algorithm();
   grpc_shutdown();
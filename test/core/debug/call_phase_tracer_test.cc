@@ -0,0 +1,210 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/debug/call_phase_tracer.h"
+
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include <grpc/grpc.h>
+#include <gtest/gtest.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+
+// Returns the number of calls that reached each phase, for \a method.
+std::map<CallPhase, int64_t> PhaseCounts(const std::string& method) {
+  std::map<CallPhase, int64_t> counts;
+  CallPhaseTracer::ForEachHistogram(
+      [&](const std::string& m, CallPhase phase,
+          const CallPhaseTracer::Histogram& histogram) {
+        if (m == method) counts[phase] = histogram.count();
+      });
+  return counts;
+}
+
+TEST(CallPhaseTracerTest, HistogramSmallValuesAreExact) {
+  CallPhaseTracer::Histogram histogram;
+  EXPECT_EQ(histogram.Quantile(0.5), 0);
+  for (int64_t i = 1; i <= 10; i++) histogram.Add(i);
+  EXPECT_EQ(histogram.count(), 10);
+  EXPECT_EQ(histogram.sum(), 55);
+  EXPECT_EQ(histogram.Quantile(0.5), 5);
+  EXPECT_EQ(histogram.Quantile(0.9), 9);
+  EXPECT_EQ(histogram.Quantile(1), 10);
+}
+
+TEST(CallPhaseTracerTest, HistogramQuantileError) {
+  for (int64_t value : {int64_t{33}, int64_t{1000}, int64_t{123456},
+                        int64_t{987654321}, int64_t{1} << 39}) {
+    CallPhaseTracer::Histogram histogram;
+    histogram.Add(value);
+    const int64_t quantile = histogram.Quantile(0.99);
+    EXPECT_GE(quantile, value);
+    EXPECT_LE(quantile, value + value / 16) << value;
+  }
+}
+
+TEST(CallPhaseTracerTest, Sampling) {
+  ExecCtx exec_ctx;
+  CallPhaseTracer::SetSampleRateForTesting(4);
+  Arena* arena = Arena::Create(1024);
+  grpc_slice method = grpc_slice_from_static_string("/test.Sampling/Call");
+  int sampled = 0;
+  for (int i = 0; i < 20; i++) {
+    CallPhaseTrace* trace =
+        CallPhaseTrace::MaybeCreate(arena, method, gpr_get_cycle_counter());
+    if (trace != nullptr) {
+      sampled++;
+      CallPhaseTrace::Destroy(trace);
+    }
+  }
+  CallPhaseTracer::SetSampleRateForTesting(0);
+  EXPECT_EQ(CallPhaseTrace::MaybeCreate(arena, method, 0), nullptr);
+  arena->Destroy();
+  // The first call after SetSampleRateForTesting() is sampled.
+  EXPECT_EQ(sampled, 5);
+  EXPECT_EQ(PhaseCounts("/test.Sampling/Call")[CallPhase::kCompleted], 5);
+}
+
+TEST(CallPhaseTracerTest, RecordsPhasesOnce) {
+  ExecCtx exec_ctx;
+  CallPhaseTracer::SetSampleRateForTesting(1);
+  Arena* arena = Arena::Create(1024);
+  grpc_call_context_element context[GRPC_CONTEXT_COUNT] = {};
+  CallPhaseTrace* trace = CallPhaseTrace::MaybeCreate(
+      arena, grpc_slice_from_static_string("/test.Phases/Call"),
+      gpr_get_cycle_counter());
+  ASSERT_NE(trace, nullptr);
+  // Recording through a context without a trace does nothing.
+  CallPhaseTrace::Record(context, CallPhase::kLbPicked);
+  CallPhaseTrace::Record(nullptr, CallPhase::kLbPicked);
+  context[GRPC_CONTEXT_CALL_PHASE_TRACE].value = trace;
+  CallPhaseTrace::Record(context, CallPhase::kFilterStackEntered);
+  CallPhaseTrace::Record(context, CallPhase::kFilterStackEntered);
+  CallPhaseTrace::Record(context, CallPhase::kFirstByteReceived);
+  CallPhaseTrace::Destroy(trace);
+  arena->Destroy();
+  CallPhaseTracer::SetSampleRateForTesting(0);
+  std::map<CallPhase, int64_t> counts = PhaseCounts("/test.Phases/Call");
+  EXPECT_EQ(counts.size(), 3u);
+  EXPECT_EQ(counts[CallPhase::kFilterStackEntered], 1);
+  EXPECT_EQ(counts[CallPhase::kFirstByteReceived], 1);
+  EXPECT_EQ(counts[CallPhase::kCompleted], 1);
+}
+
+// Traces finished on many threads are all collected, while scrapes run
+// concurrently.
+TEST(CallPhaseTracerTest, ConcurrentThreads) {
+  constexpr int kThreads = 8;
+  constexpr int kCallsPerThread = 100;
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([]() {
+      ExecCtx exec_ctx;
+      CallPhaseTracer::SetSampleRateForTesting(1);
+      Arena* arena = Arena::Create(1024);
+      for (int j = 0; j < kCallsPerThread; j++) {
+        CallPhaseTrace* trace = CallPhaseTrace::MaybeCreate(
+            arena, grpc_slice_from_static_string("/test.Concurrent/Call"),
+            gpr_get_cycle_counter());
+        GPR_ASSERT(trace != nullptr);
+        trace->Record(CallPhase::kLbPicked);
+        CallPhaseTrace::Destroy(trace);
+      }
+      arena->Destroy();
+    });
+  }
+  for (int i = 0; i < 10; i++) PhaseCounts("/test.Concurrent/Call");
+  for (auto& t : threads) t.join();
+  CallPhaseTracer::SetSampleRateForTesting(0);
+  int64_t collected =
+      PhaseCounts("/test.Concurrent/Call")[CallPhase::kLbPicked];
+  EXPECT_EQ(collected + CallPhaseTracer::dropped(),
+            kThreads * kCallsPerThread);
+}
+
+// A call that is cancelled before reaching the transport still records the
+// phases it went through.
+TEST(CallPhaseTracerTest, CancelledCall) {
+  CallPhaseTracer::SetSampleRateForTesting(1);
+  grpc_channel* channel =
+      grpc_insecure_channel_create("localhost:1", nullptr, nullptr);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_call* call = grpc_channel_create_call(
+      channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+      grpc_slice_from_static_string("/test.Cancelled/Call"), nullptr,
+      gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+  CallPhaseTracer::SetSampleRateForTesting(0);
+  grpc_metadata_array trailing_metadata;
+  grpc_metadata_array_init(&trailing_metadata);
+  grpc_status_code status;
+  grpc_slice details;
+  grpc_op ops[2] = {};
+  ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+  ops[1].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  ops[1].data.recv_status_on_client.trailing_metadata = &trailing_metadata;
+  ops[1].data.recv_status_on_client.status = &status;
+  ops[1].data.recv_status_on_client.status_details = &details;
+  ASSERT_EQ(GRPC_CALL_OK,
+            grpc_call_start_batch(call, ops, 2, reinterpret_cast<void*>(1),
+                                  nullptr));
+  grpc_call_cancel(call, nullptr);
+  grpc_event ev = grpc_completion_queue_next(
+      cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+  EXPECT_EQ(ev.type, GRPC_OP_COMPLETE);
+  EXPECT_EQ(status, GRPC_STATUS_CANCELLED);
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&trailing_metadata);
+  grpc_call_unref(call);
+  grpc_channel_destroy(channel);
+  grpc_completion_queue_shutdown(cq);
+  while (grpc_completion_queue_next(cq, gpr_inf_future(GPR_CLOCK_REALTIME),
+                                    nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(cq);
+  // The call may be destroyed asynchronously, on another thread.
+  std::map<CallPhase, int64_t> counts;
+  gpr_timespec deadline = grpc_timeout_seconds_to_deadline(10);
+  do {
+    counts = PhaseCounts("/test.Cancelled/Call");
+  } while (counts.count(CallPhase::kCompleted) == 0 &&
+           gpr_time_cmp(gpr_now(deadline.clock_type), deadline) < 0);
+  EXPECT_EQ(counts[CallPhase::kFilterStackEntered], 1);
+  EXPECT_EQ(counts[CallPhase::kCompleted], 1);
+  EXPECT_EQ(counts.count(CallPhase::kMessageDelivered), 0u);
+}
+
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
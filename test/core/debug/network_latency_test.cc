@@ -0,0 +1,166 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/debug/network_latency.h"
+
+#include <map>
+#include <string>
+
+#include <grpc/grpc.h>
+#include <gtest/gtest.h>
+
+#include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+
+namespace grpc_core {
+namespace testing {
+namespace {
+
+// Returns timestamps of a write that spent \a queued_us in the kernel and
+// \a on_wire_us until it was acked.
+Timestamps MakeTimestamps(int64_t queued_us, int64_t on_wire_us) {
+  Timestamps ts;
+  ts.sendmsg_time.time = gpr_time_from_seconds(1000, GPR_CLOCK_REALTIME);
+  ts.scheduled_time.time = ts.sendmsg_time.time;
+  ts.sent_time.time = gpr_time_add(
+      ts.sendmsg_time.time, gpr_time_from_micros(queued_us, GPR_TIMESPAN));
+  ts.acked_time.time = gpr_time_add(
+      ts.sent_time.time, gpr_time_from_micros(on_wire_us, GPR_TIMESPAN));
+  ts.byte_offset = 0;
+  return ts;
+}
+
+// Returns the number of writes recorded for each stage of \a method.
+std::map<NetworkLatencyStage, int64_t> MethodCounts(const std::string& method) {
+  std::map<NetworkLatencyStage, int64_t> counts;
+  CallNetworkLatency::ForEachMethodHistogram(
+      [&](const std::string& m, NetworkLatencyStage stage,
+          const CallPhaseTracer::Histogram& histogram) {
+        if (m == method) counts[stage] = histogram.count();
+      });
+  return counts;
+}
+
+TEST(NetworkLatencyTest, Sampling) {
+  gpr_atm call_count = 0;
+  int sampled = 0;
+  for (int i = 0; i < 30; i++) {
+    if (CallNetworkLatency::MaybeCreate(10, &call_count) != nullptr) {
+      sampled++;
+    }
+  }
+  EXPECT_EQ(sampled, 3);
+  EXPECT_EQ(CallNetworkLatency::MaybeCreate(0, &call_count), nullptr);
+}
+
+TEST(NetworkLatencyTest, RecordWrite) {
+  RefCountedPtr<CallNetworkLatency> latency =
+      MakeRefCounted<CallNetworkLatency>();
+  latency->SetMethod("/test.NetworkLatency/RecordWrite");
+  auto connection = MakeRefCounted<ConnectionNetworkLatency>();
+  latency->RecordWrite(MakeTimestamps(10, 200), connection.get());
+  latency->RecordWrite(MakeTimestamps(30, 100), nullptr);
+  CallNetworkLatency::Stats stats = latency->stats();
+  const int queued = static_cast<int>(NetworkLatencyStage::kQueuedInKernel);
+  const int on_wire = static_cast<int>(NetworkLatencyStage::kOnWire);
+  const int acked = static_cast<int>(NetworkLatencyStage::kUntilAcked);
+  EXPECT_EQ(stats.traced_writes, 2);
+  EXPECT_EQ(stats.total_us[queued], 40);
+  EXPECT_EQ(stats.max_us[queued], 30);
+  EXPECT_EQ(stats.total_us[on_wire], 300);
+  EXPECT_EQ(stats.max_us[on_wire], 200);
+  EXPECT_EQ(stats.total_us[acked], 340);
+  EXPECT_EQ(stats.max_us[acked], 210);
+  // Only the first write was recorded for the connection.
+  int stages = 0;
+  connection->ForEachStage([&stages](NetworkLatencyStage stage,
+                                     const CallPhaseTracer::Histogram& h) {
+    stages++;
+    EXPECT_EQ(h.count(), 1);
+    if (stage == NetworkLatencyStage::kOnWire) {
+      EXPECT_EQ(h.sum(), 200);
+    }
+  });
+  EXPECT_EQ(stages, kNumNetworkLatencyStages);
+  std::map<NetworkLatencyStage, int64_t> counts =
+      MethodCounts("/test.NetworkLatency/RecordWrite");
+  EXPECT_EQ(counts[NetworkLatencyStage::kQueuedInKernel], 2);
+  EXPECT_EQ(counts[NetworkLatencyStage::kOnWire], 2);
+  EXPECT_EQ(counts[NetworkLatencyStage::kUntilAcked], 2);
+}
+
+TEST(NetworkLatencyTest, ClockSkewIsClamped) {
+  RefCountedPtr<CallNetworkLatency> latency =
+      MakeRefCounted<CallNetworkLatency>();
+  Timestamps ts = MakeTimestamps(10, 20);
+  ts.acked_time.time = gpr_time_sub(ts.sendmsg_time.time,
+                                    gpr_time_from_micros(5, GPR_TIMESPAN));
+  latency->RecordWrite(ts, nullptr);
+  CallNetworkLatency::Stats stats = latency->stats();
+  EXPECT_EQ(stats.max_us[static_cast<int>(NetworkLatencyStage::kOnWire)], 0);
+  EXPECT_EQ(stats.max_us[static_cast<int>(NetworkLatencyStage::kUntilAcked)],
+            0);
+}
+
+TEST(NetworkLatencyTest, ExportedAsOpenMetrics) {
+  RefCountedPtr<CallNetworkLatency> latency =
+      MakeRefCounted<CallNetworkLatency>();
+  latency->SetMethod("/test.NetworkLatency/Export");
+  latency->RecordWrite(MakeTimestamps(10, 200), nullptr);
+  grpc_stats_data data;
+  grpc_stats_collect(&data);
+  std::string text = grpc_stats_data_as_openmetrics(&data);
+  EXPECT_NE(text.find("# TYPE grpc_network_latency_seconds summary\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("grpc_network_latency_seconds_count{method=\"/test."
+                      "NetworkLatency/Export\",stage=\"on_wire\"} 1\n"),
+            std::string::npos);
+}
+
+TEST(NetworkLatencyTest, RenderedBySocketNode) {
+  auto connection = MakeRefCounted<ConnectionNetworkLatency>();
+  auto socket = MakeRefCounted<channelz::SocketNode>(
+      "ipv4:127.0.0.1:1", "ipv4:127.0.0.1:2", "socket", nullptr, connection);
+  Json json = socket->RenderJson();
+  EXPECT_EQ(json.object_value().at("data").object_value().count("option"),
+            0u);
+  connection->Record({10, 20, 30});
+  json = socket->RenderJson();
+  const Json::Array& options =
+      json.object_value().at("data").object_value().at("option").array_value();
+  ASSERT_EQ(options.size(), 3u);
+  EXPECT_EQ(options[1].object_value().at("name").string_value(),
+            "grpc.network_latency.on_wire");
+  EXPECT_EQ(options[1].object_value().at("value").string_value(),
+            "count=1 p50_us=20 p90_us=20 p99_us=20 max_us=20");
+}
+
+}  // namespace
+}  // namespace testing
+}  // namespace grpc_core
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  ::testing::InitGoogleTest(&argc, argv);
+  grpc_init();
+  int ret = RUN_ALL_TESTS();
+  grpc_shutdown();
+  return ret;
+}
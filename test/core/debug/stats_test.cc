@@ -18,6 +18,10 @@
 
 #include "src/core/lib/debug/stats.h"
 
+#include <string.h>
+
+#include <algorithm>
+#include <atomic>
 #include <mutex>
 #include <thread>
 
@@ -26,6 +30,9 @@
 #include <grpc/support/log.h>
 #include <gtest/gtest.h>
 
+#include "absl/strings/str_cat.h"
+#include "absl/strings/str_split.h"
+
 #include "test/core/util/test_config.h"
 
 namespace grpc {
@@ -140,6 +147,96 @@ TEST_P(HistogramTest, IncHistogram) {
 INSTANTIATE_TEST_SUITE_P(HistogramTestCases, HistogramTest,
                          ::testing::Range<int>(0, GRPC_STATS_HISTOGRAM_COUNT));
 
+TEST(StatsTest, OpenMetrics) {
+  grpc_stats_data data;
+  memset(&data, 0, sizeof(data));
+  data.counters[GRPC_STATS_COUNTER_SYSCALL_POLL] = 42;
+  const int start = grpc_stats_histo_start[GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE];
+  const int num_buckets =
+      grpc_stats_histo_buckets[GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE];
+  const int* boundaries =
+      grpc_stats_histo_bucket_boundaries[GRPC_STATS_HISTOGRAM_TCP_WRITE_SIZE];
+  data.histograms[start] = 1;
+  data.histograms[start + 2] = 2;
+  data.histograms[start + num_buckets - 1] = 3;
+  std::vector<std::string> lines =
+      absl::StrSplit(grpc_stats_data_as_openmetrics(&data), '\n');
+  auto has_line = [&lines](const std::string& line) {
+    return std::find(lines.begin(), lines.end(), line) != lines.end();
+  };
+  EXPECT_TRUE(has_line("# TYPE grpc_syscall_poll counter"));
+  EXPECT_TRUE(has_line("grpc_syscall_poll_total 42"));
+  EXPECT_TRUE(has_line("grpc_cqs_created_total 0"));
+  EXPECT_TRUE(has_line("# TYPE grpc_tcp_write_size histogram"));
+  EXPECT_TRUE(has_line(absl::StrCat("grpc_tcp_write_size_bucket{le=\"",
+                                    boundaries[1] - 1, "\"} 1")));
+  EXPECT_TRUE(has_line(absl::StrCat("grpc_tcp_write_size_bucket{le=\"",
+                                    boundaries[2] - 1, "\"} 1")));
+  EXPECT_TRUE(has_line(absl::StrCat("grpc_tcp_write_size_bucket{le=\"",
+                                    boundaries[3] - 1, "\"} 3")));
+  EXPECT_TRUE(has_line("grpc_tcp_write_size_bucket{le=\"+Inf\"} 6"));
+  // The exposition ends with an EOF marker and a newline.
+  ASSERT_GE(lines.size(), 2u);
+  EXPECT_EQ(lines[lines.size() - 2], "# EOF");
+  EXPECT_EQ(lines.back(), "");
+}
+
+TEST(StatsTest, RegisteredCounters) {
+  grpc_stats_data data;
+  memset(&data, 0, sizeof(data));
+  {
+    grpc_core::StatsCounter counter1("app-requests", "Requests \"handled\"");
+    grpc_core::StatsCounter counter2("app-requests", "Requests \"handled\"");
+    EXPECT_EQ(counter1.name(), "app_requests");
+    counter1.Increment();
+    counter2.Increment(2);
+    EXPECT_EQ(counter1.Value(), 1);
+    std::string text = grpc_stats_data_as_openmetrics(&data);
+    EXPECT_NE(text.find("# TYPE app_requests counter\n"
+                        "# HELP app_requests Requests \\\"handled\\\"\n"
+                        "app_requests_total 3\n# EOF\n"),
+              std::string::npos);
+  }
+  EXPECT_EQ(grpc_stats_data_as_openmetrics(&data).find("app_requests"),
+            std::string::npos);
+}
+
+// Scraping only reads the per-CPU cells, so increments made while scraping
+// are neither lost nor slowed down by a lock.
+TEST(StatsTest, ScrapeUnderLoad) {
+  constexpr int kThreads = 8;
+  constexpr int kIncrements = 100000;
+  grpc_core::StatsCounter counter("scrape_under_load", "");
+  std::atomic<bool> done{false};
+  std::thread scraper([&done]() {
+    grpc_stats_data data;
+    while (!done.load()) {
+      grpc_stats_collect(&data);
+      grpc_stats_data_as_openmetrics(&data);
+    }
+  });
+  std::vector<std::thread> threads;
+  for (int i = 0; i < kThreads; i++) {
+    threads.emplace_back([&counter]() {
+      grpc_core::ExecCtx exec_ctx;
+      for (int j = 0; j < kIncrements; j++) {
+        counter.Increment();
+        GRPC_STATS_INC_SYSCALL_WRITE();
+      }
+    });
+  }
+  int64_t last_value = 0;
+  for (auto& t : threads) {
+    int64_t value = counter.Value();
+    EXPECT_GE(value, last_value);
+    last_value = value;
+    t.join();
+  }
+  done.store(true);
+  scraper.join();
+  EXPECT_EQ(counter.Value(), kThreads * kIncrements);
+}
+
 }  // namespace testing
 }  // namespace grpc
 
@@ -133,6 +133,8 @@ extern void retry_exceeds_buffer_size_in_initial_batch(grpc_end2end_test_config
 extern void retry_exceeds_buffer_size_in_initial_batch_pre_init(void);
 extern void retry_exceeds_buffer_size_in_subsequent_batch(grpc_end2end_test_config config);
 extern void retry_exceeds_buffer_size_in_subsequent_batch_pre_init(void);
+extern void retry_hedging(grpc_end2end_test_config config);
+extern void retry_hedging_pre_init(void);
 extern void retry_non_retriable_status(grpc_end2end_test_config config);
 extern void retry_non_retriable_status_pre_init(void);
 extern void retry_non_retriable_status_before_recv_trailing_metadata_started(grpc_end2end_test_config config);
@@ -243,6 +245,7 @@ void grpc_end2end_tests_pre_init(void) {
   retry_disabled_pre_init();
   retry_exceeds_buffer_size_in_initial_batch_pre_init();
   retry_exceeds_buffer_size_in_subsequent_batch_pre_init();
+  retry_hedging_pre_init();
   retry_non_retriable_status_pre_init();
   retry_non_retriable_status_before_recv_trailing_metadata_started_pre_init();
   retry_recv_initial_metadata_pre_init();
@@ -331,6 +334,7 @@ void grpc_end2end_tests(int argc, char **argv,
     retry_disabled(config);
     retry_exceeds_buffer_size_in_initial_batch(config);
     retry_exceeds_buffer_size_in_subsequent_batch(config);
+    retry_hedging(config);
     retry_non_retriable_status(config);
     retry_non_retriable_status_before_recv_trailing_metadata_started(config);
     retry_recv_initial_metadata(config);
@@ -570,6 +574,10 @@ void grpc_end2end_tests(int argc, char **argv,
       retry_exceeds_buffer_size_in_subsequent_batch(config);
       continue;
     }
+    if (0 == strcmp("retry_hedging", argv[i])) {
+      retry_hedging(config);
+      continue;
+    }
     if (0 == strcmp("retry_non_retriable_status", argv[i])) {
       retry_non_retriable_status(config);
       continue;
@@ -296,6 +296,7 @@ END2END_TESTS = {
         # See b/151617965
         short_name = "retry_exceeds_buffer_size_in_subseq",
     ),
+    "retry_hedging": _test_options(needs_client_channel = True, proxyable = False),
     "retry_non_retriable_status": _test_options(
         needs_client_channel = True,
         proxyable = False,
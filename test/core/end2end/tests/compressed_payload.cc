@@ -34,6 +34,7 @@
 
 #include "src/core/lib/channel/channel_args.h"
 #include "src/core/lib/compression/compression_args.h"
+#include "src/core/lib/compression/compression_internal.h"
 #include "src/core/lib/surface/call.h"
 #include "src/core/lib/surface/call_test_only.h"
 #include "src/core/lib/transport/static_metadata.h"
@@ -400,8 +401,8 @@ static void request_with_payload_template_inner(
   CQ_EXPECT_COMPLETION(cqv, tag(100), true);
   cq_verify(cqv);
 
-  GPR_ASSERT(GPR_BITCOUNT(grpc_call_test_only_get_encodings_accepted_by_peer(
-                 s)) == GRPC_COMPRESS_ALGORITHMS_COUNT);
+  GPR_ASSERT(grpc_call_test_only_get_encodings_accepted_by_peer(s) ==
+             grpc_compression_supported_algorithms_bitset());
   GPR_ASSERT(GPR_BITGET(grpc_call_test_only_get_encodings_accepted_by_peer(s),
                         GRPC_COMPRESS_NONE) != 0);
   GPR_ASSERT(GPR_BITGET(grpc_call_test_only_get_encodings_accepted_by_peer(s),
@@ -673,6 +674,22 @@ static void test_invoke_request_with_compressed_payload_md_override(
       /*ignored*/ GRPC_COMPRESS_LEVEL_NONE, false);
 }
 
+/* zstd and lz4 are only advertised and used when gRPC is built with them;
+   otherwise a channel that defaults to them sends uncompressed messages. */
+static void test_invoke_request_with_optional_algorithms(
+    grpc_end2end_test_config config) {
+  const uint32_t supported = grpc_compression_supported_algorithms_bitset();
+  for (grpc_compression_algorithm algorithm :
+       {GRPC_COMPRESS_ZSTD, GRPC_COMPRESS_LZ4}) {
+    const grpc_compression_algorithm expected =
+        GPR_BITGET(supported, algorithm) ? algorithm : GRPC_COMPRESS_NONE;
+    request_with_payload_template(
+        config, "test_invoke_request_with_optional_algorithms", 0, algorithm,
+        algorithm, expected, expected, nullptr, false,
+        /* ignored */ GRPC_COMPRESS_LEVEL_NONE, false);
+  }
+}
+
 static void test_invoke_request_with_disabled_algorithm(
     grpc_end2end_test_config config) {
   request_for_disabled_algorithm(config,
@@ -692,6 +709,7 @@ void compressed_payload(grpc_end2end_test_config config) {
   test_invoke_request_with_send_message_before_initial_metadata(config);
   test_invoke_request_with_server_level(config);
   test_invoke_request_with_compressed_payload_md_override(config);
+  test_invoke_request_with_optional_algorithms(config);
   test_invoke_request_with_disabled_algorithm(config);
 }
 
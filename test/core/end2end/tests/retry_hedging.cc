@@ -0,0 +1,746 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "test/core/end2end/end2end_tests.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/byte_buffer.h>
+#include <grpc/grpc.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+#include <grpc/support/string_util.h>
+#include <grpc/support/time.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/gpr/string.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/transport/static_metadata.h"
+
+#include "test/core/end2end/cq_verifier.h"
+
+static void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+static grpc_end2end_test_fixture begin_test(grpc_end2end_test_config config,
+                                            const char* test_name,
+                                            grpc_channel_args* client_args,
+                                            grpc_channel_args* server_args) {
+  grpc_end2end_test_fixture f;
+  gpr_log(GPR_INFO, "Running test: %s/%s", test_name, config.name);
+  f = config.create_fixture(client_args, server_args);
+  config.init_server(&f, server_args);
+  config.init_client(&f, client_args);
+  return f;
+}
+
+static gpr_timespec n_seconds_from_now(int n) {
+  return grpc_timeout_seconds_to_deadline(n);
+}
+
+static gpr_timespec five_seconds_from_now(void) {
+  return n_seconds_from_now(5);
+}
+
+static void drain_cq(grpc_completion_queue* cq) {
+  grpc_event ev;
+  do {
+    ev = grpc_completion_queue_next(cq, five_seconds_from_now(), nullptr);
+  } while (ev.type != GRPC_QUEUE_SHUTDOWN);
+}
+
+static void shutdown_server(grpc_end2end_test_fixture* f) {
+  if (!f->server) return;
+  grpc_server_shutdown_and_notify(f->server, f->shutdown_cq, tag(1000));
+  GPR_ASSERT(grpc_completion_queue_pluck(f->shutdown_cq, tag(1000),
+                                         grpc_timeout_seconds_to_deadline(5),
+                                         nullptr)
+                 .type == GRPC_OP_COMPLETE);
+  grpc_server_destroy(f->server);
+  f->server = nullptr;
+}
+
+static void shutdown_client(grpc_end2end_test_fixture* f) {
+  if (!f->client) return;
+  grpc_channel_destroy(f->client);
+  f->client = nullptr;
+}
+
+static void end_test(grpc_end2end_test_fixture* f) {
+  shutdown_server(f);
+  shutdown_client(f);
+
+  grpc_completion_queue_shutdown(f->cq);
+  drain_cq(f->cq);
+  grpc_completion_queue_destroy(f->cq);
+  grpc_completion_queue_destroy(f->shutdown_cq);
+}
+
+// Runs a call with 2 hedged attempts, in which the server answers the
+// second attempt it sees.
+// - If fail_first_attempt is false, the server never responds to the
+//   first attempt, which stays in flight until the second one succeeds
+//   and is then cancelled.
+// - If fail_first_attempt is true, the first attempt fails with a
+//   non-fatal status, which starts the second one without waiting for the
+//   hedging delay.
+static void run_hedged_call(grpc_end2end_test_config config,
+                            const char* test_name, const char* hedging_delay,
+                            bool fail_first_attempt) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_call* s2;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_metadata_array request_metadata_recv2;
+  grpc_call_details call_details;
+  grpc_call_details call_details2;
+  grpc_slice request_payload_slice = grpc_slice_from_static_string("foo");
+  grpc_slice response_payload_slice = grpc_slice_from_static_string("bar");
+  grpc_byte_buffer* request_payload =
+      grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  grpc_byte_buffer* response_payload =
+      grpc_raw_byte_buffer_create(&response_payload_slice, 1);
+  grpc_byte_buffer* request_payload_recv = nullptr;
+  grpc_byte_buffer* response_payload_recv = nullptr;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  int was_cancelled2 = 2;
+
+  std::string service_config = absl::StrCat(
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 2,\n"
+      "      \"hedgingDelay\": \"",
+      hedging_delay,
+      "\",\n"
+      "      \"nonFatalStatusCodes\": [ \"ABORTED\" ]\n"
+      "    }\n"
+      "  } ]\n"
+      "}");
+  grpc_arg arg;
+  arg.type = GRPC_ARG_STRING;
+  arg.key = const_cast<char*>(GRPC_ARG_SERVICE_CONFIG);
+  arg.value.string = const_cast<char*>(service_config.c_str());
+  grpc_channel_args client_args = {1, &arg};
+  grpc_end2end_test_fixture f =
+      begin_test(config, test_name, &client_args, nullptr);
+
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = n_seconds_from_now(60);
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/service/method"),
+                               nullptr, deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv2);
+  grpc_call_details_init(&call_details);
+  grpc_call_details_init(&call_details2);
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = request_payload;
+  op++;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &response_payload_recv;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op++;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  // Server gets the first attempt.
+  error =
+      grpc_server_request_call(f.server, &s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  if (fail_first_attempt) {
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op->data.send_initial_metadata.count = 0;
+    op++;
+    op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    op->data.send_status_from_server.trailing_metadata_count = 0;
+    op->data.send_status_from_server.status = GRPC_STATUS_ABORTED;
+    op->data.send_status_from_server.status_details = &status_details;
+    op++;
+  }
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  if (fail_first_attempt) {
+    CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+    cq_verify(cqv);
+  }
+
+  // The server sees the second attempt while the first one, unless it
+  // failed, is still in flight.  A non-fatal failure starts the second
+  // attempt well before the hedging delay elapses.
+  error =
+      grpc_server_request_call(f.server, &s2, &call_details2,
+                               &request_metadata_recv2, f.cq, f.cq, tag(201));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(201), true);
+  cq_verify(cqv, fail_first_attempt ? 5 : 10);
+  // Exactly one of the attempts carries the "grpc-previous-rpc-attempts"
+  // header.  With no hedging delay, they may reach the server in either
+  // order.
+  GPR_ASSERT(contains_metadata(&request_metadata_recv,
+                               "grpc-previous-rpc-attempts", "1") +
+                 contains_metadata(&request_metadata_recv2,
+                                   "grpc-previous-rpc-attempts", "1") ==
+             1);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &request_payload_recv;
+  op++;
+  error = grpc_call_start_batch(s2, ops, static_cast<size_t>(op - ops),
+                                tag(202), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(202), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = response_payload;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  op->data.send_status_from_server.status_details = &status_details;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled2;
+  op++;
+  error = grpc_call_start_batch(s2, ops, static_cast<size_t>(op - ops),
+                                tag(203), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  // Once the second attempt wins, the first one is cancelled.
+  if (!fail_first_attempt) CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(203), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(0 == grpc_slice_str_cmp(details, "xyz"));
+  GPR_ASSERT(0 == grpc_slice_str_cmp(call_details2.method, "/service/method"));
+  GPR_ASSERT(0 == call_details2.flags);
+  if (!fail_first_attempt) GPR_ASSERT(was_cancelled == 1);
+  GPR_ASSERT(was_cancelled2 == 0);
+  GPR_ASSERT(byte_buffer_eq_slice(request_payload_recv, request_payload_slice));
+  GPR_ASSERT(
+      byte_buffer_eq_slice(response_payload_recv, response_payload_slice));
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv2);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_details_destroy(&call_details2);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(response_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+  grpc_byte_buffer_destroy(response_payload_recv);
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  grpc_call_unref(s2);
+
+  cq_verifier_destroy(cqv);
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+// Tests that a hedged attempt is started when the server does not respond
+// within the hedging delay, and that it can win while the first attempt is
+// still outstanding.
+static void test_retry_hedging(grpc_end2end_test_config config) {
+  run_hedged_call(config, "retry_hedging", "1s", false);
+}
+
+// Tests that with no hedging delay, both attempts are sent at once.
+static void test_retry_hedging_no_delay(grpc_end2end_test_config config) {
+  run_hedged_call(config, "retry_hedging_no_delay", "0s", false);
+}
+
+// Tests that a non-fatal failure starts the next attempt immediately.
+static void test_retry_hedging_non_fatal_status(
+    grpc_end2end_test_config config) {
+  run_hedged_call(config, "retry_hedging_non_fatal_status", "30s", true);
+}
+
+// Tests that when one hedged attempt's stream is reset while its
+// send_message op is still blocked on flow control, the error is held back
+// and the surface's send batch completes once the other attempt sends the
+// message.
+static void test_retry_hedging_stream_reset(grpc_end2end_test_config config) {
+  grpc_call* c;
+  grpc_call* s;
+  grpc_call* s2;
+  grpc_op ops[6];
+  grpc_op* op;
+  grpc_metadata_array initial_metadata_recv;
+  grpc_metadata_array trailing_metadata_recv;
+  grpc_metadata_array request_metadata_recv;
+  grpc_metadata_array request_metadata_recv2;
+  grpc_call_details call_details;
+  grpc_call_details call_details2;
+  // Larger than the initial 64KB stream flow control window, so that the
+  // send_message op does not complete until the server reads it.
+  grpc_slice request_payload_slice = grpc_slice_malloc(128 * 1024);
+  memset(GRPC_SLICE_START_PTR(request_payload_slice), 'a',
+         GRPC_SLICE_LENGTH(request_payload_slice));
+  grpc_byte_buffer* request_payload =
+      grpc_raw_byte_buffer_create(&request_payload_slice, 1);
+  grpc_byte_buffer* request_payload_recv = nullptr;
+  grpc_status_code status;
+  grpc_call_error error;
+  grpc_slice details;
+  int was_cancelled = 2;
+  int was_cancelled2 = 2;
+
+  grpc_arg arg;
+  arg.type = GRPC_ARG_STRING;
+  arg.key = const_cast<char*>(GRPC_ARG_SERVICE_CONFIG);
+  arg.value.string = const_cast<char*>(
+      "{\n"
+      "  \"methodConfig\": [ {\n"
+      "    \"name\": [\n"
+      "      { \"service\": \"service\", \"method\": \"method\" }\n"
+      "    ],\n"
+      "    \"hedgingPolicy\": {\n"
+      "      \"maxAttempts\": 2,\n"
+      "      \"hedgingDelay\": \"0s\",\n"
+      "      \"nonFatalStatusCodes\": [ \"ABORTED\", \"CANCELLED\" ]\n"
+      "    }\n"
+      "  } ]\n"
+      "}");
+  grpc_channel_args client_args = {1, &arg};
+  // Without BDP probing, the server keeps the initial stream window until
+  // the application reads.
+  grpc_arg server_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_HTTP2_BDP_PROBE), 0);
+  grpc_channel_args server_args = {1, &server_arg};
+  grpc_end2end_test_fixture f = begin_test(
+      config, "retry_hedging_stream_reset", &client_args, &server_args);
+
+  cq_verifier* cqv = cq_verifier_create(f.cq);
+
+  gpr_timespec deadline = n_seconds_from_now(60);
+  c = grpc_channel_create_call(f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+                               grpc_slice_from_static_string("/service/method"),
+                               nullptr, deadline, nullptr);
+  GPR_ASSERT(c);
+
+  grpc_metadata_array_init(&initial_metadata_recv);
+  grpc_metadata_array_init(&trailing_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv);
+  grpc_metadata_array_init(&request_metadata_recv2);
+  grpc_call_details_init(&call_details);
+  grpc_call_details_init(&call_details2);
+  grpc_slice status_details = grpc_slice_from_static_string("xyz");
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op++;
+  op->op = GRPC_OP_SEND_MESSAGE;
+  op->data.send_message.send_message = request_payload;
+  op++;
+  op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(1),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_INITIAL_METADATA;
+  op->data.recv_initial_metadata.recv_initial_metadata = &initial_metadata_recv;
+  op++;
+  op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+  op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+  op->data.recv_status_on_client.status = &status;
+  op->data.recv_status_on_client.status_details = &details;
+  op++;
+  error = grpc_call_start_batch(c, ops, static_cast<size_t>(op - ops), tag(2),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+
+  // With no hedging delay, the server sees both attempts at once.
+  error =
+      grpc_server_request_call(f.server, &s, &call_details,
+                               &request_metadata_recv, f.cq, f.cq, tag(101));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(101), true);
+  cq_verify(cqv);
+  error =
+      grpc_server_request_call(f.server, &s2, &call_details2,
+                               &request_metadata_recv2, f.cq, f.cq, tag(201));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(201), true);
+  cq_verify(cqv);
+
+  // Reset the first attempt's stream before it reads the message.
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled;
+  op++;
+  error = grpc_call_start_batch(s, ops, static_cast<size_t>(op - ops), tag(102),
+                                nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  grpc_call_cancel(s, nullptr);
+  CQ_EXPECT_COMPLETION(cqv, tag(102), true);
+  cq_verify(cqv);
+  GPR_ASSERT(was_cancelled == 1);
+
+  // The other attempt still sends the message, which completes the
+  // surface's send batch.
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_RECV_MESSAGE;
+  op->data.recv_message.recv_message = &request_payload_recv;
+  op++;
+  error = grpc_call_start_batch(s2, ops, static_cast<size_t>(op - ops),
+                                tag(202), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(202), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(1), true);
+  cq_verify(cqv);
+
+  memset(ops, 0, sizeof(ops));
+  op = ops;
+  op->op = GRPC_OP_SEND_INITIAL_METADATA;
+  op->data.send_initial_metadata.count = 0;
+  op++;
+  op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+  op->data.send_status_from_server.trailing_metadata_count = 0;
+  op->data.send_status_from_server.status = GRPC_STATUS_OK;
+  op->data.send_status_from_server.status_details = &status_details;
+  op++;
+  op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+  op->data.recv_close_on_server.cancelled = &was_cancelled2;
+  op++;
+  error = grpc_call_start_batch(s2, ops, static_cast<size_t>(op - ops),
+                                tag(203), nullptr);
+  GPR_ASSERT(GRPC_CALL_OK == error);
+  CQ_EXPECT_COMPLETION(cqv, tag(203), true);
+  CQ_EXPECT_COMPLETION(cqv, tag(2), true);
+  cq_verify(cqv);
+
+  GPR_ASSERT(status == GRPC_STATUS_OK);
+  GPR_ASSERT(0 == grpc_slice_str_cmp(details, "xyz"));
+  GPR_ASSERT(was_cancelled2 == 0);
+  GPR_ASSERT(byte_buffer_eq_slice(request_payload_recv, request_payload_slice));
+
+  grpc_slice_unref(details);
+  grpc_metadata_array_destroy(&initial_metadata_recv);
+  grpc_metadata_array_destroy(&trailing_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv);
+  grpc_metadata_array_destroy(&request_metadata_recv2);
+  grpc_call_details_destroy(&call_details);
+  grpc_call_details_destroy(&call_details2);
+  grpc_byte_buffer_destroy(request_payload);
+  grpc_byte_buffer_destroy(request_payload_recv);
+
+  grpc_call_unref(c);
+  grpc_call_unref(s);
+  grpc_call_unref(s2);
+
+  cq_verifier_destroy(cqv);
+
+  end_test(&f);
+  config.tear_down_data(&f);
+}
+
+// A server call that is answered once its randomly chosen delay is up.
+struct DelayedServerCall {
+  grpc_call* call = nullptr;
+  grpc_call_details details;
+  grpc_metadata_array request_metadata;
+  gpr_timespec due;
+  bool responded = false;
+  bool done = false;
+  int was_cancelled = 2;
+};
+
+// The client call is tag(1).  Server call i is requested with
+// tag(1000 + 2 * i) and answered with tag(1001 + 2 * i).
+static void request_delayed_server_call(
+    grpc_end2end_test_fixture* f, std::vector<DelayedServerCall*>* calls) {
+  DelayedServerCall* sc = new DelayedServerCall();
+  grpc_call_details_init(&sc->details);
+  grpc_metadata_array_init(&sc->request_metadata);
+  const intptr_t i = static_cast<intptr_t>(calls->size());
+  calls->push_back(sc);
+  grpc_call_error error = grpc_server_request_call(
+      f->server, &sc->call, &sc->details, &sc->request_metadata, f->cq, f->cq,
+      tag(1000 + 2 * i));
+  GPR_ASSERT(GRPC_CALL_OK == error);
+}
+
+// Answers the server calls that are due and handles one event from the
+// completion queue.  Returns true if it was the client call's completion.
+static bool poll_delayed_server(grpc_end2end_test_fixture* f,
+                                std::vector<DelayedServerCall*>* calls,
+                                int slow_percent, int slow_delay_ms) {
+  gpr_timespec now = gpr_now(GPR_CLOCK_MONOTONIC);
+  for (size_t i = 0; i < calls->size(); ++i) {
+    DelayedServerCall* sc = (*calls)[i];
+    if (sc->call == nullptr || sc->responded ||
+        gpr_time_cmp(sc->due, now) > 0) {
+      continue;
+    }
+    grpc_op ops[3];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op->data.send_initial_metadata.count = 0;
+    op++;
+    op->op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+    op->data.send_status_from_server.trailing_metadata_count = 0;
+    op->data.send_status_from_server.status = GRPC_STATUS_OK;
+    op++;
+    op->op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+    op->data.recv_close_on_server.cancelled = &sc->was_cancelled;
+    op++;
+    grpc_call_error error =
+        grpc_call_start_batch(sc->call, ops, static_cast<size_t>(op - ops),
+                              tag(1001 + 2 * static_cast<intptr_t>(i)),
+                              nullptr);
+    GPR_ASSERT(GRPC_CALL_OK == error);
+    sc->responded = true;
+  }
+  grpc_event ev = grpc_completion_queue_next(
+      f->cq, grpc_timeout_milliseconds_to_deadline(5), nullptr);
+  if (ev.type == GRPC_QUEUE_TIMEOUT) return false;
+  GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+  const intptr_t t = reinterpret_cast<intptr_t>(ev.tag);
+  if (t == 1) {
+    GPR_ASSERT(ev.success);
+    return true;
+  }
+  GPR_ASSERT(t >= 1000);
+  DelayedServerCall* sc = (*calls)[(t - 1000) / 2];
+  if ((t - 1000) % 2 == 0) {
+    // A new attempt: pick its delay and wait for the next one.
+    GPR_ASSERT(ev.success);
+    const int delay_ms = rand() % 100 < slow_percent ? slow_delay_ms : 0;
+    sc->due = gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                           gpr_time_from_millis(delay_ms, GPR_TIMESPAN));
+    request_delayed_server_call(f, calls);
+  } else {
+    // A losing hedged attempt may have been cancelled in the meantime.
+    sc->done = true;
+  }
+  return false;
+}
+
+// Runs num_calls calls one after another against a server that holds
+// slow_percent of the attempts it sees for slow_delay_ms, and returns the
+// 99th percentile latency in milliseconds.  If hedging_delay is non-null,
+// the calls are hedged with up to 2 attempts.
+static double run_calls_with_random_delays(grpc_end2end_test_config config,
+                                           const char* test_name,
+                                           const char* hedging_delay,
+                                           int num_calls, int slow_percent,
+                                           int slow_delay_ms) {
+  std::string service_config;
+  grpc_arg arg;
+  grpc_channel_args client_args = {0, &arg};
+  if (hedging_delay != nullptr) {
+    service_config = absl::StrCat(
+        "{\n"
+        "  \"methodConfig\": [ {\n"
+        "    \"name\": [\n"
+        "      { \"service\": \"service\", \"method\": \"method\" }\n"
+        "    ],\n"
+        "    \"hedgingPolicy\": {\n"
+        "      \"maxAttempts\": 2,\n"
+        "      \"hedgingDelay\": \"",
+        hedging_delay,
+        "\"\n"
+        "    }\n"
+        "  } ]\n"
+        "}");
+    arg.type = GRPC_ARG_STRING;
+    arg.key = const_cast<char*>(GRPC_ARG_SERVICE_CONFIG);
+    arg.value.string = const_cast<char*>(service_config.c_str());
+    client_args.num_args = 1;
+  }
+  grpc_end2end_test_fixture f =
+      begin_test(config, test_name, &client_args, nullptr);
+
+  std::vector<DelayedServerCall*> server_calls;
+  request_delayed_server_call(&f, &server_calls);
+  std::vector<double> latencies;
+  for (int i = 0; i < num_calls; ++i) {
+    grpc_metadata_array initial_metadata_recv;
+    grpc_metadata_array trailing_metadata_recv;
+    grpc_status_code status;
+    grpc_slice details;
+    grpc_metadata_array_init(&initial_metadata_recv);
+    grpc_metadata_array_init(&trailing_metadata_recv);
+    grpc_call* c = grpc_channel_create_call(
+        f.client, nullptr, GRPC_PROPAGATE_DEFAULTS, f.cq,
+        grpc_slice_from_static_string("/service/method"), nullptr,
+        n_seconds_from_now(10), nullptr);
+    GPR_ASSERT(c);
+    grpc_op ops[4];
+    memset(ops, 0, sizeof(ops));
+    grpc_op* op = ops;
+    op->op = GRPC_OP_SEND_INITIAL_METADATA;
+    op->data.send_initial_metadata.count = 0;
+    op++;
+    op->op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    op++;
+    op->op = GRPC_OP_RECV_INITIAL_METADATA;
+    op->data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_recv;
+    op++;
+    op->op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    op->data.recv_status_on_client.trailing_metadata = &trailing_metadata_recv;
+    op->data.recv_status_on_client.status = &status;
+    op->data.recv_status_on_client.status_details = &details;
+    op++;
+    const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    grpc_call_error error = grpc_call_start_batch(
+        c, ops, static_cast<size_t>(op - ops), tag(1), nullptr);
+    GPR_ASSERT(GRPC_CALL_OK == error);
+    while (!poll_delayed_server(&f, &server_calls, slow_percent,
+                                slow_delay_ms)) {
+    }
+    latencies.push_back(gpr_timespec_to_micros(gpr_time_sub(
+                            gpr_now(GPR_CLOCK_MONOTONIC), start)) /
+                        1000);
+    GPR_ASSERT(status == GRPC_STATUS_OK);
+    grpc_slice_unref(details);
+    grpc_metadata_array_destroy(&initial_metadata_recv);
+    grpc_metadata_array_destroy(&trailing_metadata_recv);
+    grpc_call_unref(c);
+  }
+  // Answer the attempts that are still being held, including the losing
+  // hedged attempts.
+  for (;;) {
+    bool all_done = true;
+    for (DelayedServerCall* sc : server_calls) {
+      if (sc->call != nullptr && !sc->done) all_done = false;
+    }
+    if (all_done) break;
+    GPR_ASSERT(!poll_delayed_server(&f, &server_calls, slow_percent,
+                                    slow_delay_ms));
+  }
+
+  for (DelayedServerCall* sc : server_calls) {
+    if (sc->call != nullptr) grpc_call_unref(sc->call);
+  }
+
+  end_test(&f);
+  config.tear_down_data(&f);
+  for (DelayedServerCall* sc : server_calls) {
+    grpc_call_details_destroy(&sc->details);
+    grpc_metadata_array_destroy(&sc->request_metadata);
+    delete sc;
+  }
+
+  std::sort(latencies.begin(), latencies.end());
+  return latencies[(latencies.size() * 99 + 99) / 100 - 1];
+}
+
+// Tests that hedging cuts the tail latency caused by a server that is
+// occasionally slow: with a second attempt sent after 100ms, a call is
+// only slow if both of its attempts are.
+static void test_retry_hedging_tail_latency(grpc_end2end_test_config config) {
+  const int kNumCalls = 200;
+  const int kSlowPercent = 5;
+  const int kSlowDelayMs = 500;
+  const double unhedged_p99 = run_calls_with_random_delays(
+      config, "retry_hedging_tail_latency_unhedged", nullptr, kNumCalls,
+      kSlowPercent, kSlowDelayMs);
+  const double hedged_p99 = run_calls_with_random_delays(
+      config, "retry_hedging_tail_latency", "0.1s", kNumCalls, kSlowPercent,
+      kSlowDelayMs);
+  gpr_log(GPR_INFO, "p99 latency: %.1fms unhedged, %.1fms hedged",
+          unhedged_p99, hedged_p99);
+  GPR_ASSERT(unhedged_p99 >= kSlowDelayMs);
+  GPR_ASSERT(hedged_p99 < unhedged_p99 / 2);
+}
+
+void retry_hedging(grpc_end2end_test_config config) {
+  GPR_ASSERT(config.feature_mask & FEATURE_MASK_SUPPORTS_CLIENT_CHANNEL);
+  test_retry_hedging(config);
+  test_retry_hedging_no_delay(config);
+  test_retry_hedging_non_fatal_status(config);
+  test_retry_hedging_stream_reset(config);
+  test_retry_hedging_tail_latency(config);
+}
+
+void retry_hedging_pre_init(void) {}
@@ -0,0 +1,401 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+#include "src/core/lib/iomgr/port.h"
+
+// This test won't work except with posix sockets enabled
+#ifdef GRPC_POSIX_SOCKET_TCP
+
+#include <arpa/inet.h>
+#include <inttypes.h>
+#include <openssl/err.h>
+#include <openssl/ssl.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "absl/strings/str_cat.h"
+
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/atm.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/load_file.h"
+#include "src/core/lib/security/transport/security_handshaker.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+#define SSL_CERT_PATH "src/core/tsi/test_creds/server1.pem"
+#define SSL_KEY_PATH "src/core/tsi/test_creds/server1.key"
+#define SSL_CA_PATH "src/core/tsi/test_creds/ca.pem"
+
+// A storm of new connections to a server whose handshakes are offloaded to a
+// small pool that admits only a few of them at a time. Every handshake must
+// still complete, from both plain TLS clients and gRPC channels whose own
+// handshakes are offloaded to the same pool. Meanwhile RPCs keep running on a
+// connection established before the storm; their latency must not get worse
+// than when the same storm is handshaken on the polling threads.
+static const int kOffloadThreads = 2;
+static const int kMaxConcurrentHandshakes = 4;
+static const int kNumTlsClients = 32;
+static const int kNumChannels = 16;
+// Slack on the data plane latency comparison, so that scheduling noise does
+// not fail the test.
+static const double kLatencySlackMs = 20.0;
+
+static gpr_atm g_tls_handshakes_succeeded;
+
+static int create_socket(int port) {
+  struct sockaddr_in addr;
+  addr.sin_family = AF_INET;
+  addr.sin_port = htons(static_cast<uint16_t>(port));
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  int s = socket(AF_INET, SOCK_STREAM, 0);
+  if (s < 0) {
+    perror("Unable to create socket");
+    return -1;
+  }
+  if (connect(s, reinterpret_cast<struct sockaddr*>(&addr), sizeof(addr)) < 0) {
+    perror("Unable to connect");
+    close(s);
+    return -1;
+  }
+  return s;
+}
+
+// Performs one TLS 1.2 handshake with the server. With TLS 1.2, SSL_connect()
+// returns only after the server has processed the client's Finished message,
+// so a successful return means that the server side handshake ran too.
+static void tls_client_thread(void* arg) {
+  const int port = *static_cast<int*>(arg);
+  SSL_CTX* ctx = SSL_CTX_new(TLSv1_2_client_method());
+  GPR_ASSERT(ctx != nullptr);
+  static const unsigned char kAlpnProtos[] = {2, 'h', '2'};
+  GPR_ASSERT(SSL_CTX_set_alpn_protos(ctx, kAlpnProtos, sizeof(kAlpnProtos)) ==
+             0);
+  int sock = create_socket(port);
+  GPR_ASSERT(sock >= 0);
+  SSL* ssl = SSL_new(ctx);
+  GPR_ASSERT(ssl != nullptr);
+  SSL_set_fd(ssl, sock);
+  if (SSL_connect(ssl) <= 0) {
+    ERR_print_errors_fp(stderr);
+    gpr_log(GPR_ERROR, "Handshake failed.");
+  } else {
+    gpr_atm_full_fetch_add(&g_tls_handshakes_succeeded, 1);
+  }
+  SSL_free(ssl);
+  SSL_CTX_free(ctx);
+  close(sock);
+}
+
+struct ServerState {
+  grpc_server* server;
+  grpc_completion_queue* cq;
+};
+
+static void* tag(intptr_t t) { return reinterpret_cast<void*>(t); }
+
+// Answers every call with an OK status, one call at a time, until the cq is
+// shut down.
+static void server_thread(void* arg) {
+  ServerState* state = static_cast<ServerState*>(arg);
+  grpc_call* call = nullptr;
+  grpc_call_details details;
+  grpc_metadata_array request_metadata;
+  grpc_call_details_init(&details);
+  grpc_metadata_array_init(&request_metadata);
+  GPR_ASSERT(GRPC_CALL_OK ==
+             grpc_server_request_call(state->server, &call, &details,
+                                      &request_metadata, state->cq, state->cq,
+                                      tag(1)));
+  int was_cancelled;
+  for (;;) {
+    grpc_event ev = grpc_completion_queue_next(
+        state->cq, gpr_inf_future(GPR_CLOCK_REALTIME), nullptr);
+    if (ev.type == GRPC_QUEUE_SHUTDOWN) break;
+    if (ev.tag == tag(1)) {
+      // Fails once the server shuts down.
+      if (!ev.success) continue;
+      grpc_op ops[3];
+      memset(ops, 0, sizeof(ops));
+      ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+      ops[1].op = GRPC_OP_SEND_STATUS_FROM_SERVER;
+      ops[1].data.send_status_from_server.status = GRPC_STATUS_OK;
+      ops[2].op = GRPC_OP_RECV_CLOSE_ON_SERVER;
+      ops[2].data.recv_close_on_server.cancelled = &was_cancelled;
+      GPR_ASSERT(GRPC_CALL_OK == grpc_call_start_batch(call, ops, 3, tag(2),
+                                                       nullptr));
+    } else if (ev.tag == tag(2)) {
+      grpc_call_unref(call);
+      call = nullptr;
+      grpc_call_details_destroy(&details);
+      grpc_metadata_array_destroy(&request_metadata);
+      grpc_call_details_init(&details);
+      grpc_metadata_array_init(&request_metadata);
+      GPR_ASSERT(GRPC_CALL_OK ==
+                 grpc_server_request_call(state->server, &call, &details,
+                                          &request_metadata, state->cq,
+                                          state->cq, tag(1)));
+    }
+  }
+  grpc_call_details_destroy(&details);
+  grpc_metadata_array_destroy(&request_metadata);
+}
+
+struct DataPlaneState {
+  grpc_channel* channel;
+  gpr_atm stop;
+  std::vector<double> latencies_ms;
+};
+
+// Runs unary RPCs back to back on an established channel until told to stop,
+// recording the latency of each one.
+static void data_plane_thread(void* arg) {
+  DataPlaneState* state = static_cast<DataPlaneState*>(arg);
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_pluck(nullptr);
+  while (!gpr_atm_acq_load(&state->stop)) {
+    grpc_call* call = grpc_channel_create_call(
+        state->channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq,
+        grpc_slice_from_static_string("/storm/DataPlane"), nullptr,
+        grpc_timeout_seconds_to_deadline(30), nullptr);
+    GPR_ASSERT(call != nullptr);
+    grpc_metadata_array initial_metadata_recv;
+    grpc_metadata_array trailing_metadata_recv;
+    grpc_metadata_array_init(&initial_metadata_recv);
+    grpc_metadata_array_init(&trailing_metadata_recv);
+    grpc_status_code status;
+    grpc_slice details;
+    grpc_op ops[4];
+    memset(ops, 0, sizeof(ops));
+    ops[0].op = GRPC_OP_SEND_INITIAL_METADATA;
+    ops[1].op = GRPC_OP_SEND_CLOSE_FROM_CLIENT;
+    ops[2].op = GRPC_OP_RECV_INITIAL_METADATA;
+    ops[2].data.recv_initial_metadata.recv_initial_metadata =
+        &initial_metadata_recv;
+    ops[3].op = GRPC_OP_RECV_STATUS_ON_CLIENT;
+    ops[3].data.recv_status_on_client.trailing_metadata =
+        &trailing_metadata_recv;
+    ops[3].data.recv_status_on_client.status = &status;
+    ops[3].data.recv_status_on_client.status_details = &details;
+    const gpr_timespec start = gpr_now(GPR_CLOCK_MONOTONIC);
+    GPR_ASSERT(GRPC_CALL_OK ==
+               grpc_call_start_batch(call, ops, 4, tag(1), nullptr));
+    grpc_event ev = grpc_completion_queue_pluck(
+        cq, tag(1), grpc_timeout_seconds_to_deadline(30), nullptr);
+    const gpr_timespec elapsed =
+        gpr_time_sub(gpr_now(GPR_CLOCK_MONOTONIC), start);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    GPR_ASSERT(ev.success);
+    GPR_ASSERT(status == GRPC_STATUS_OK);
+    state->latencies_ms.push_back(gpr_timespec_to_micros(elapsed) / 1000.0);
+    grpc_slice_unref(details);
+    grpc_metadata_array_destroy(&initial_metadata_recv);
+    grpc_metadata_array_destroy(&trailing_metadata_recv);
+    grpc_call_unref(call);
+  }
+  grpc_completion_queue_shutdown(cq);
+  grpc_completion_queue_destroy(cq);
+}
+
+static void wait_for_ready(grpc_channel* channel, grpc_completion_queue* cq) {
+  grpc_connectivity_state state =
+      grpc_channel_check_connectivity_state(channel, 1);
+  while (state != GRPC_CHANNEL_READY) {
+    grpc_channel_watch_connectivity_state(
+        channel, state, grpc_timeout_seconds_to_deadline(30), cq, nullptr);
+    grpc_event ev = grpc_completion_queue_next(
+        cq, grpc_timeout_seconds_to_deadline(30), nullptr);
+    GPR_ASSERT(ev.type == GRPC_OP_COMPLETE);
+    GPR_ASSERT(ev.success);
+    state = grpc_channel_check_connectivity_state(channel, 0);
+  }
+}
+
+// Returns the p99 latency, in milliseconds, of RPCs run on an established
+// connection while the storm's handshakes were in progress.
+static double run_storm(bool offload, const char* ca_cert,
+                        grpc_ssl_pem_key_cert_pair* pem_key_cert_pair) {
+  gpr_atm_rel_store(&g_tls_handshakes_succeeded, 0);
+  grpc_arg offload_arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_ARG_SECURITY_HANDSHAKE_OFFLOAD), offload);
+  grpc_channel_args server_args = {1, &offload_arg};
+
+  // Start the server.
+  int port = grpc_pick_unused_port_or_die();
+  std::string addr = absl::StrCat("127.0.0.1:", port);
+  grpc_server_credentials* server_creds = grpc_ssl_server_credentials_create(
+      ca_cert, pem_key_cert_pair, 1, 0, nullptr);
+  ServerState server_state;
+  server_state.server = grpc_server_create(&server_args, nullptr);
+  GPR_ASSERT(grpc_server_add_secure_http2_port(server_state.server,
+                                               addr.c_str(), server_creds));
+  server_state.cq = grpc_completion_queue_create_for_next(nullptr);
+  grpc_server_register_completion_queue(server_state.server, server_state.cq,
+                                        nullptr);
+  grpc_server_start(server_state.server);
+  grpc_core::Thread server_thd("grpc_storm_server", server_thread,
+                               &server_state);
+  server_thd.Start();
+
+  grpc_channel_credentials* channel_creds =
+      grpc_ssl_credentials_create(ca_cert, nullptr, nullptr, nullptr);
+  grpc_arg channel_arg_array[] = {
+      offload_arg,
+      grpc_channel_arg_string_create(
+          const_cast<char*>(GRPC_SSL_TARGET_NAME_OVERRIDE_ARG),
+          const_cast<char*>("foo.test.google.fr")),
+      // Keep channels from sharing a subchannel, so that each one makes its
+      // own connection.
+      grpc_channel_arg_integer_create(
+          const_cast<char*>(GRPC_ARG_USE_LOCAL_SUBCHANNEL_POOL), 1),
+  };
+  grpc_channel_args channel_args = {GPR_ARRAY_SIZE(channel_arg_array),
+                                    channel_arg_array};
+  grpc_completion_queue* client_cq =
+      grpc_completion_queue_create_for_next(nullptr);
+
+  // Establish the data plane connection before the storm starts.
+  DataPlaneState data_plane;
+  data_plane.channel = grpc_secure_channel_create(channel_creds, addr.c_str(),
+                                                  &channel_args, nullptr);
+  gpr_atm_rel_store(&data_plane.stop, 0);
+  wait_for_ready(data_plane.channel, client_cq);
+  grpc_core::Thread data_plane_thd("grpc_storm_data_plane", data_plane_thread,
+                                   &data_plane);
+  data_plane_thd.Start();
+
+  // Start every client at once.
+  std::vector<grpc_core::Thread> tls_clients;
+  for (int i = 0; i < kNumTlsClients; ++i) {
+    tls_clients.emplace_back("grpc_storm_client", tls_client_thread, &port);
+    tls_clients.back().Start();
+  }
+  std::vector<grpc_channel*> channels;
+  for (int i = 0; i < kNumChannels; ++i) {
+    channels.push_back(grpc_secure_channel_create(channel_creds, addr.c_str(),
+                                                  &channel_args, nullptr));
+    grpc_channel_check_connectivity_state(channels.back(), 1);
+  }
+
+  // Every handshake completes.
+  for (grpc_channel* channel : channels) {
+    wait_for_ready(channel, client_cq);
+  }
+  for (grpc_core::Thread& thd : tls_clients) {
+    thd.Join();
+  }
+  GPR_ASSERT(gpr_atm_no_barrier_load(&g_tls_handshakes_succeeded) ==
+             kNumTlsClients);
+  gpr_atm_rel_store(&data_plane.stop, 1);
+  data_plane_thd.Join();
+
+  for (grpc_channel* channel : channels) {
+    grpc_channel_destroy(channel);
+  }
+  grpc_channel_destroy(data_plane.channel);
+  grpc_completion_queue_shutdown(client_cq);
+  while (grpc_completion_queue_next(client_cq,
+                                    gpr_inf_future(GPR_CLOCK_REALTIME), nullptr)
+             .type != GRPC_QUEUE_SHUTDOWN) {
+  }
+  grpc_completion_queue_destroy(client_cq);
+  grpc_channel_credentials_release(channel_creds);
+
+  grpc_server_shutdown_and_notify(server_state.server, server_state.cq,
+                                  nullptr);
+  grpc_server_cancel_all_calls(server_state.server);
+  grpc_completion_queue_shutdown(server_state.cq);
+  server_thd.Join();
+  grpc_server_destroy(server_state.server);
+  grpc_completion_queue_destroy(server_state.cq);
+  grpc_server_credentials_release(server_creds);
+
+  std::vector<double>& latencies = data_plane.latencies_ms;
+  GPR_ASSERT(!latencies.empty());
+  std::sort(latencies.begin(), latencies.end());
+  const double p99 = latencies[(latencies.size() - 1) * 99 / 100];
+  gpr_log(GPR_INFO,
+          "offload=%d: %" PRIuPTR " data plane RPCs, p99 %.1fms, max %.1fms",
+          offload, latencies.size(), p99, latencies.back());
+  return p99;
+}
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  GPR_GLOBAL_CONFIG_SET(grpc_security_handshake_offload_threads,
+                        kOffloadThreads);
+  GPR_GLOBAL_CONFIG_SET(grpc_security_handshake_offload_max_concurrent,
+                        kMaxConcurrentHandshakes);
+  grpc_init();
+
+  grpc_slice ca_slice, cert_slice, key_slice;
+  GPR_ASSERT(GRPC_LOG_IF_ERROR("load_file",
+                               grpc_load_file(SSL_CA_PATH, 1, &ca_slice)));
+  GPR_ASSERT(GRPC_LOG_IF_ERROR("load_file",
+                               grpc_load_file(SSL_CERT_PATH, 1, &cert_slice)));
+  GPR_ASSERT(GRPC_LOG_IF_ERROR("load_file",
+                               grpc_load_file(SSL_KEY_PATH, 1, &key_slice)));
+  const char* ca_cert =
+      reinterpret_cast<const char*> GRPC_SLICE_START_PTR(ca_slice);
+  grpc_ssl_pem_key_cert_pair pem_key_cert_pair;
+  pem_key_cert_pair.private_key =
+      reinterpret_cast<const char*> GRPC_SLICE_START_PTR(key_slice);
+  pem_key_cert_pair.cert_chain =
+      reinterpret_cast<const char*> GRPC_SLICE_START_PTR(cert_slice);
+
+  const double p99_without_offload =
+      run_storm(false, ca_cert, &pem_key_cert_pair);
+  const double p99_with_offload = run_storm(true, ca_cert, &pem_key_cert_pair);
+  // Offloading keeps the handshakes from stalling RPCs on the polling
+  // threads, so the data plane does no worse than without it.
+  GPR_ASSERT(p99_with_offload <= p99_without_offload + kLatencySlackMs);
+
+#if defined(GRPC_COLLECT_STATS) || !defined(NDEBUG)
+  grpc_stats_data stats;
+  grpc_stats_collect(&stats);
+  // Every server handshake of the offloaded storm went through admission, and
+  // none timed out.
+  GPR_ASSERT(grpc_stats_histo_count(
+                 &stats, GRPC_STATS_HISTOGRAM_SECURITY_HANDSHAKE_QUEUE_TIME) >=
+             kNumTlsClients + kNumChannels);
+  const int64_t timeouts =
+      stats.counters[GRPC_STATS_COUNTER_SECURITY_HANDSHAKE_QUEUE_TIMEOUTS];
+  GPR_ASSERT(timeouts == 0);
+#endif
+
+  grpc_slice_unref(cert_slice);
+  grpc_slice_unref(key_slice);
+  grpc_slice_unref(ca_slice);
+  grpc_shutdown();
+  return 0;
+}
+
+#else /* GRPC_POSIX_SOCKET_TCP */
+
+int main(int argc, char** argv) { return 1; }
+
+#endif /* GRPC_POSIX_SOCKET_TCP */
@@ -615,6 +615,210 @@ static void test_jwt_verifier_bad_format(void) {
   grpc_httpcli_set_override(nullptr, nullptr);
 }
 
+static int g_openid_config_fetches;
+static int g_jwk_set_fetches;
+static int g_verification_successes;
+/* Cache-Control header value of the responses, if not null. */
+static const char* g_cache_control;
+
+static int httpcli_get_openid_config_or_jwk_set(
+    const grpc_httpcli_request* request, grpc_millis /*deadline*/,
+    grpc_closure* on_done, grpc_httpcli_response* response) {
+  GPR_ASSERT(request->handshaker == &grpc_httpcli_ssl);
+  if (strcmp(request->host, "accounts.google.com") == 0) {
+    GPR_ASSERT(strcmp(request->http.path, GRPC_OPENID_CONFIG_URL_SUFFIX) == 0);
+    *response = http_response(200, gpr_strdup(good_openid_config));
+    g_openid_config_fetches++;
+  } else {
+    GPR_ASSERT(strcmp(request->host, "www.googleapis.com") == 0);
+    GPR_ASSERT(strcmp(request->http.path, "/oauth2/v3/certs") == 0);
+    *response = http_response(200, gpr_strdup(good_jwk_set));
+    g_jwk_set_fetches++;
+  }
+  if (g_cache_control != nullptr) {
+    response->hdr_count = 1;
+    response->hdrs =
+        static_cast<grpc_http_header*>(gpr_malloc(sizeof(grpc_http_header)));
+    response->hdrs[0].key = gpr_strdup("Cache-Control");
+    response->hdrs[0].value = gpr_strdup(g_cache_control);
+  }
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, on_done, GRPC_ERROR_NONE);
+  return 1;
+}
+
+static void on_verification_success_counted(void* user_data,
+                                            grpc_jwt_verifier_status status,
+                                            grpc_jwt_claims* claims) {
+  on_verification_success(user_data, status, claims);
+  g_verification_successes++;
+}
+
+static char* url_issuer_jwt(gpr_timespec lifetime) {
+  char* key_str = json_key_str(json_key_str_part3_for_url_issuer);
+  grpc_auth_json_key key = grpc_auth_json_key_create_from_string(key_str);
+  gpr_free(key_str);
+  GPR_ASSERT(grpc_auth_json_key_is_valid(&key));
+  char* jwt =
+      grpc_jwt_encode_and_sign(&key, expected_audience, lifetime, nullptr);
+  grpc_auth_json_key_destruct(&key);
+  GPR_ASSERT(jwt != nullptr);
+  return jwt;
+}
+
+static void reset_fetch_counts(void) {
+  g_openid_config_fetches = 0;
+  g_jwk_set_fetches = 0;
+  g_verification_successes = 0;
+}
+
+static void test_jwt_verifier_url_issuer_cached(void) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  gpr_timespec other_lifetime = {1800, 0, GPR_TIMESPAN};
+  gpr_timespec third_lifetime = {900, 0, GPR_TIMESPAN};
+  char* jwt = url_issuer_jwt(expected_lifetime);
+  char* other_jwt = url_issuer_jwt(other_lifetime);
+  char* third_jwt = url_issuer_jwt(third_lifetime);
+  reset_fetch_counts();
+  grpc_httpcli_set_override(httpcli_get_openid_config_or_jwk_set,
+                            httpcli_post_should_not_be_called);
+
+  /* Concurrent verifications share a single fetch of each document. */
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success_counted,
+                           const_cast<char*>(expected_user_data));
+  grpc_jwt_verifier_verify(verifier, nullptr, other_jwt, expected_audience,
+                           on_verification_success_counted,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(g_verification_successes == 2);
+  GPR_ASSERT(g_openid_config_fetches == 1);
+  GPR_ASSERT(g_jwk_set_fetches == 1);
+
+  /* Known tokens, and new tokens from the same issuer, need no fetch. */
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success_counted,
+                           const_cast<char*>(expected_user_data));
+  grpc_jwt_verifier_verify(verifier, nullptr, third_jwt, expected_audience,
+                           on_verification_success_counted,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(g_verification_successes == 4);
+
+  /* A bad signature is caught with cached keys too. */
+  corrupt_jwt_sig(third_jwt);
+  grpc_jwt_verifier_verify(verifier, nullptr, third_jwt, expected_audience,
+                           on_verification_bad_signature,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(g_openid_config_fetches == 1);
+  GPR_ASSERT(g_jwk_set_fetches == 1);
+
+  grpc_jwt_verifier_destroy(verifier);
+  gpr_free(jwt);
+  gpr_free(other_jwt);
+  gpr_free(third_jwt);
+  grpc_httpcli_set_override(nullptr, nullptr);
+}
+
+static void verify_url_issuer_jwt_twice(const char* jwt) {
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  reset_fetch_counts();
+  for (int i = 0; i < 2; i++) {
+    grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                             on_verification_success_counted,
+                             const_cast<char*>(expected_user_data));
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+  GPR_ASSERT(g_verification_successes == 2);
+  grpc_jwt_verifier_destroy(verifier);
+}
+
+static void test_jwt_verifier_cache_expiry(void) {
+  grpc_core::ExecCtx exec_ctx;
+  char* jwt = url_issuer_jwt(expected_lifetime);
+  grpc_httpcli_set_override(httpcli_get_openid_config_or_jwk_set,
+                            httpcli_post_should_not_be_called);
+
+  /* Nothing is cached with a zero TTL... */
+  grpc_millis cache_ttl = grpc_jwt_verifier_cache_ttl;
+  grpc_jwt_verifier_cache_ttl = 0;
+  verify_url_issuer_jwt_twice(jwt);
+  GPR_ASSERT(g_openid_config_fetches == 2);
+  GPR_ASSERT(g_jwk_set_fetches == 2);
+  grpc_jwt_verifier_cache_ttl = cache_ttl;
+
+  /* ...or when the issuer asks for it not to be. */
+  g_cache_control = "public, max-age=0";
+  verify_url_issuer_jwt_twice(jwt);
+  GPR_ASSERT(g_openid_config_fetches == 2);
+  GPR_ASSERT(g_jwk_set_fetches == 2);
+  g_cache_control = "no-store";
+  verify_url_issuer_jwt_twice(jwt);
+  GPR_ASSERT(g_openid_config_fetches == 2);
+  GPR_ASSERT(g_jwk_set_fetches == 2);
+  g_cache_control = "public , MAX-AGE = 0";
+  verify_url_issuer_jwt_twice(jwt);
+  GPR_ASSERT(g_openid_config_fetches == 2);
+  GPR_ASSERT(g_jwk_set_fetches == 2);
+
+  /* Directives are matched whole. */
+  g_cache_control = "public, s-maxage=0, max-age=3600, x-no-store";
+  verify_url_issuer_jwt_twice(jwt);
+  GPR_ASSERT(g_openid_config_fetches == 1);
+  GPR_ASSERT(g_jwk_set_fetches == 1);
+  g_cache_control = nullptr;
+
+  gpr_free(jwt);
+  grpc_httpcli_set_override(nullptr, nullptr);
+}
+
+static grpc_closure* g_pending_fetch_on_done;
+
+/* Leaves the fetch of the openid config in flight until the test completes
+   it, and answers any other fetch right away. */
+static int httpcli_get_openid_config_pending(
+    const grpc_httpcli_request* request, grpc_millis deadline,
+    grpc_closure* on_done, grpc_httpcli_response* response) {
+  if (strcmp(request->host, "accounts.google.com") != 0) {
+    return httpcli_get_openid_config_or_jwk_set(request, deadline, on_done,
+                                                response);
+  }
+  GPR_ASSERT(g_pending_fetch_on_done == nullptr);
+  *response = http_response(200, gpr_strdup(good_openid_config));
+  g_openid_config_fetches++;
+  g_pending_fetch_on_done = on_done;
+  return 1;
+}
+
+static void test_jwt_verifier_destroyed_with_fetch_in_flight(void) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_jwt_verifier* verifier = grpc_jwt_verifier_create(nullptr, 0);
+  char* jwt = url_issuer_jwt(expected_lifetime);
+  reset_fetch_counts();
+  grpc_httpcli_set_override(httpcli_get_openid_config_pending,
+                            httpcli_post_should_not_be_called);
+  grpc_jwt_verifier_verify(verifier, nullptr, jwt, expected_audience,
+                           on_verification_success_counted,
+                           const_cast<char*>(expected_user_data));
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(g_pending_fetch_on_done != nullptr);
+  GPR_ASSERT(g_verification_successes == 0);
+
+  /* The verification goes on, fetching the keys too, without the verifier. */
+  grpc_jwt_verifier_destroy(verifier);
+  grpc_core::ExecCtx::Run(DEBUG_LOCATION, g_pending_fetch_on_done,
+                          GRPC_ERROR_NONE);
+  g_pending_fetch_on_done = nullptr;
+  grpc_core::ExecCtx::Get()->Flush();
+  GPR_ASSERT(g_openid_config_fetches == 1);
+  GPR_ASSERT(g_jwk_set_fetches == 1);
+  GPR_ASSERT(g_verification_successes == 1);
+
+  gpr_free(jwt);
+  grpc_httpcli_set_override(nullptr, nullptr);
+}
+
 /* find verification key: bad jks, cannot find key in jks */
 /* bad signature custom provided email*/
 /* bad key */
@@ -635,6 +839,9 @@ int main(int argc, char** argv) {
   test_jwt_verifier_bad_json_key();
   test_jwt_verifier_bad_signature();
   test_jwt_verifier_bad_format();
+  test_jwt_verifier_url_issuer_cached();
+  test_jwt_verifier_cache_expiry();
+  test_jwt_verifier_destroyed_with_fetch_in_flight();
   grpc_shutdown();
   return 0;
 }
@@ -146,6 +146,56 @@ TEST_F(TlsSecurityConnectorTest,
   grpc_channel_args_destroy(new_args);
 }
 
+TEST_F(TlsSecurityConnectorTest,
+       SharedSessionCacheIsScopedToChannelCredentials) {
+  auto create_credential = [](const std::string& root_cert,
+                              const grpc_core::PemKeyCertPairList& pairs) {
+    grpc_core::RefCountedPtr<grpc_tls_certificate_distributor> distributor =
+        grpc_core::MakeRefCounted<grpc_tls_certificate_distributor>();
+    distributor->SetKeyMaterials(kRootCertName, root_cert, absl::nullopt);
+    distributor->SetKeyMaterials(kIdentityCertName, absl::nullopt, pairs);
+    grpc_core::RefCountedPtr<grpc_tls_credentials_options> options =
+        grpc_core::MakeRefCounted<grpc_tls_credentials_options>();
+    options->set_certificate_provider(
+        grpc_core::MakeRefCounted<TlsTestCertificateProvider>(distributor));
+    options->set_watch_root_cert(true);
+    options->set_watch_identity_pair(true);
+    options->set_root_cert_name(kRootCertName);
+    options->set_identity_cert_name(kIdentityCertName);
+    return grpc_core::MakeRefCounted<TlsCredentials>(options);
+  };
+  grpc_core::RefCountedPtr<TlsCredentials> credential_0 =
+      create_credential(root_cert_0_, identity_pairs_0_);
+  grpc_core::RefCountedPtr<TlsCredentials> credential_1 =
+      create_credential(root_cert_1_, identity_pairs_1_);
+  grpc_arg arg = grpc_channel_arg_integer_create(
+      const_cast<char*>(GRPC_SSL_SESSION_CACHE_SHARED_ARG), 1);
+  grpc_channel_args args = {1, &arg};
+  // Two channels of each credentials to the same target.
+  grpc_core::RefCountedPtr<grpc_channel_security_connector> connectors[4];
+  grpc_channel_args* new_args[4] = {};
+  for (int i = 0; i < 4; i++) {
+    TlsCredentials* credential =
+        i < 2 ? credential_0.get() : credential_1.get();
+    connectors[i] = credential->create_security_connector(
+        nullptr, kTargetName, &args, &new_args[i]);
+    ASSERT_NE(connectors[i], nullptr);
+  }
+  tsi_ssl_session_cache* caches[4];
+  for (int i = 0; i < 4; i++) {
+    auto* tls_connector = static_cast<grpc_core::TlsChannelSecurityConnector*>(
+        connectors[i].get());
+    caches[i] = tls_connector->SessionCacheForTesting();
+    EXPECT_NE(caches[i], nullptr);
+  }
+  // Only channels with the same roots and identity resume each other's
+  // sessions.
+  EXPECT_EQ(caches[0], caches[1]);
+  EXPECT_EQ(caches[2], caches[3]);
+  EXPECT_NE(caches[0], caches[2]);
+  for (int i = 0; i < 4; i++) grpc_channel_args_destroy(new_args[i]);
+}
+
 TEST_F(TlsSecurityConnectorTest,
        SystemRootsWhenCreateChannelSecurityConnector) {
   // Create options watching for no certificates.
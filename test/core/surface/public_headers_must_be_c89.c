@@ -222,6 +222,10 @@ int main(int argc, char **argv) {
   printf("%lx", (unsigned long) grpc_tls_credentials_options_watch_identity_key_cert_pairs);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_identity_cert_name);
   printf("%lx", (unsigned long) grpc_tls_credentials_options_set_server_authorization_check_config);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_keys_create);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_keys_set);
+  printf("%lx", (unsigned long) grpc_tls_session_ticket_keys_release);
+  printf("%lx", (unsigned long) grpc_tls_credentials_options_set_session_ticket_keys);
   printf("%lx", (unsigned long) grpc_tls_server_authorization_check_config_create);
   printf("%lx", (unsigned long) grpc_tls_server_authorization_check_config_release);
   printf("%lx", (unsigned long) grpc_xds_credentials_create);
@@ -159,6 +159,64 @@ TEST_F(ContextListTest, NonEmptyListEmptyTimestamp) {
   exec_ctx.Flush();
 }
 
+/** Tests that the timestamps of a write are recorded into the network latency
+ * of a sampled stream, unless the write failed.
+ */
+TEST_F(ContextListTest, RecordsNetworkLatency) {
+  grpc_core::ExecCtx exec_ctx;
+  grpc_stream_refcount ref;
+  GRPC_STREAM_REF_INIT(&ref, 1, nullptr, nullptr, "phony ref");
+  grpc_resource_quota* resource_quota =
+      grpc_resource_quota_create("context_list_test");
+  grpc_endpoint* mock_endpoint =
+      grpc_mock_endpoint_create(discard_write, resource_quota);
+  grpc_transport* t =
+      grpc_create_chttp2_transport(nullptr, mock_endpoint, true);
+  grpc_chttp2_stream* s = static_cast<grpc_chttp2_stream*>(
+      gpr_malloc(grpc_transport_stream_size(t)));
+  grpc_transport_init_stream(reinterpret_cast<grpc_transport*>(t),
+                             reinterpret_cast<grpc_stream*>(s), &ref, nullptr,
+                             nullptr);
+  gpr_atm verifier_called;
+  gpr_atm_rel_store(&verifier_called, static_cast<gpr_atm>(0));
+  s->context = &verifier_called;
+  s->byte_counter = kByteOffset;
+  auto network_latency = MakeRefCounted<CallNetworkLatency>();
+  s->network_latency = network_latency.get();
+  grpc_core::Timestamps ts;
+  ts.sendmsg_time.time = gpr_time_from_seconds(1000, GPR_CLOCK_REALTIME);
+  ts.scheduled_time.time = ts.sendmsg_time.time;
+  ts.sent_time.time = gpr_time_add(ts.sendmsg_time.time,
+                                   gpr_time_from_micros(10, GPR_TIMESPAN));
+  ts.acked_time.time =
+      gpr_time_add(ts.sent_time.time, gpr_time_from_micros(20, GPR_TIMESPAN));
+  grpc_core::ContextList* list = nullptr;
+  grpc_core::ContextList::Append(&list, s);
+  grpc_core::ContextList::Execute(list, &ts, GRPC_ERROR_NONE);
+  EXPECT_EQ(gpr_atm_acq_load(&verifier_called), static_cast<gpr_atm>(1));
+  CallNetworkLatency::Stats stats = network_latency->stats();
+  EXPECT_EQ(stats.traced_writes, 1);
+  EXPECT_EQ(stats.max_us[static_cast<int>(NetworkLatencyStage::kUntilAcked)],
+            30);
+  // A write that failed has incomplete timestamps, which are not recorded.
+  // Streams are traced for their network latency without the callback too.
+  grpc_http2_set_write_timestamps_callback(nullptr);
+  list = nullptr;
+  grpc_core::ContextList::Append(&list, s);
+  ASSERT_NE(list, nullptr);
+  grpc_error* error = GRPC_ERROR_CREATE_FROM_STATIC_STRING("Write failed");
+  grpc_core::ContextList::Execute(list, &ts, error);
+  GRPC_ERROR_UNREF(error);
+  EXPECT_EQ(network_latency->stats().traced_writes, 1);
+  grpc_transport_destroy_stream(reinterpret_cast<grpc_transport*>(t),
+                                reinterpret_cast<grpc_stream*>(s), nullptr);
+  exec_ctx.Flush();
+  gpr_free(s);
+  grpc_transport_destroy(t);
+  grpc_resource_quota_unref(resource_quota);
+  exec_ctx.Flush();
+}
+
 }  // namespace
 }  // namespace testing
 }  // namespace grpc_core
@@ -140,6 +140,34 @@ TEST(SslSessionCacheTest, LruCache) {
   EXPECT_EQ(tracker.AliveCount(), 0);
 }
 
+TEST(SslSessionCacheTest, ShardedLruCache) {
+  const size_t kCapacity = 1024;
+  const long kSessions = 4 * kCapacity;
+  SessionTracker tracker;
+  {
+    RefCountedPtr<tsi::SslSessionLRUCache> cache =
+        tsi::SslSessionLRUCache::Create(kCapacity);
+    // Overfill the cache; each shard evicts independently, so the total size
+    // never exceeds the overall capacity.
+    for (long id = 0; id < kSessions; id++) {
+      std::string domain = std::to_string(id) + ".random.domain";
+      cache->Put(domain.c_str(), tracker.NewSession(id));
+      EXPECT_LE(cache->Size(), kCapacity);
+    }
+    EXPECT_EQ(tracker.AliveCount(), cache->Size());
+    // The most recently inserted session is never evicted.
+    std::string last = std::to_string(kSessions - 1) + ".random.domain";
+    EXPECT_TRUE(cache->Get(last.c_str()));
+    // Replacing a session in a shard destroys the old one.
+    tsi::SslSessionPtr sess = tracker.NewSession(-1);
+    SSL_SESSION* sess_ptr = sess.get();
+    cache->Put(last.c_str(), std::move(sess));
+    EXPECT_FALSE(tracker.IsAlive(kSessions - 1));
+    EXPECT_EQ(cache->Get(last.c_str()).get(), sess_ptr);
+  }
+  EXPECT_EQ(tracker.AliveCount(), 0);
+}
+
 }  // namespace
 }  // namespace grpc_core
 
@@ -26,9 +26,13 @@
 #include <stdio.h>
 #include <string.h>
 
+#include <string>
+
 #include "src/core/lib/iomgr/load_file.h"
 #include "src/core/lib/security/security_connector/security_connector.h"
+#include "src/core/lib/slice/slice_internal.h"
 #include "src/core/tsi/transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
 #include "src/core/tsi/transport_security_interface.h"
 #include "test/core/tsi/transport_security_test_lib.h"
 #include "test/core/util/test_config.h"
@@ -98,6 +102,7 @@ typedef struct ssl_tsi_test_fixture {
   bool session_reused;
   const char* session_ticket_key;
   size_t session_ticket_key_size;
+  tsi_ssl_session_ticket_keys* session_ticket_keys;
   tsi_ssl_server_handshaker_factory* server_handshaker_factory;
   tsi_ssl_client_handshaker_factory* client_handshaker_factory;
 } ssl_tsi_test_fixture;
@@ -164,6 +169,7 @@ static void ssl_test_setup_handshakers(tsi_test_fixture* fixture) {
   }
   server_options.session_ticket_key = ssl_fixture->session_ticket_key;
   server_options.session_ticket_key_size = ssl_fixture->session_ticket_key_size;
+  server_options.session_ticket_keys = ssl_fixture->session_ticket_keys;
   server_options.min_tls_version = test_tls_version;
   server_options.max_tls_version = test_tls_version;
   GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
@@ -408,6 +414,9 @@ static void ssl_test_destruct(tsi_test_fixture* fixture) {
   if (ssl_fixture->session_cache != nullptr) {
     tsi_ssl_session_cache_unref(ssl_fixture->session_cache);
   }
+  if (ssl_fixture->session_ticket_keys != nullptr) {
+    tsi_ssl_session_ticket_keys_unref(ssl_fixture->session_ticket_keys);
+  }
   /* Unreference others. */
   tsi_ssl_server_handshaker_factory_unref(
       ssl_fixture->server_handshaker_factory);
@@ -501,6 +510,7 @@ static tsi_test_fixture* ssl_tsi_test_fixture_create() {
   ssl_fixture->session_reused = false;
   ssl_fixture->session_ticket_key = nullptr;
   ssl_fixture->session_ticket_key_size = 0;
+  ssl_fixture->session_ticket_keys = nullptr;
   ssl_fixture->force_client_auth = false;
   return &ssl_fixture->base;
 }
@@ -729,6 +739,119 @@ void ssl_tsi_test_do_round_trip_odd_buffer_size() {
   }
 }
 
+// Creates a zero-copy protector from |result| and feeds it the bytes the
+// handshaker read past the end of the handshake, e.g. TLS 1.3 session tickets.
+static tsi_zero_copy_grpc_protector* ssl_test_create_zero_copy_protector(
+    tsi_handshaker_result* result) {
+  tsi_zero_copy_grpc_protector* protector = nullptr;
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 result, nullptr, &protector) == TSI_OK);
+  const unsigned char* unused_bytes = nullptr;
+  size_t unused_bytes_size = 0;
+  GPR_ASSERT(tsi_handshaker_result_get_unused_bytes(
+                 result, &unused_bytes, &unused_bytes_size) == TSI_OK);
+  if (unused_bytes_size > 0) {
+    grpc_slice_buffer protected_slices;
+    grpc_slice_buffer unprotected_slices;
+    grpc_slice_buffer_init(&protected_slices);
+    grpc_slice_buffer_init(&unprotected_slices);
+    grpc_slice_buffer_add(
+        &protected_slices,
+        grpc_slice_from_copied_buffer(
+            reinterpret_cast<const char*>(unused_bytes), unused_bytes_size));
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                   protector, &protected_slices, &unprotected_slices) ==
+               TSI_OK);
+    GPR_ASSERT(unprotected_slices.length == 0);
+    grpc_slice_buffer_destroy_internal(&protected_slices);
+    grpc_slice_buffer_destroy_internal(&unprotected_slices);
+  }
+  return protector;
+}
+
+static std::string ssl_test_slice_buffer_to_string(
+    const grpc_slice_buffer* buffer) {
+  std::string result;
+  for (size_t i = 0; i < buffer->count; ++i) {
+    result.append(
+        reinterpret_cast<const char*>(GRPC_SLICE_START_PTR(buffer->slices[i])),
+        GRPC_SLICE_LENGTH(buffer->slices[i]));
+  }
+  return result;
+}
+
+// Protects a message made of |num_slices| slices of |slice_size| bytes with
+// |sender|, hands the protected bytes to |receiver| in chunks of |chunk_size|
+// bytes and checks that the original message comes out.
+static void ssl_test_zero_copy_send_message(
+    tsi_zero_copy_grpc_protector* sender,
+    tsi_zero_copy_grpc_protector* receiver, size_t num_slices,
+    size_t slice_size, size_t chunk_size) {
+  grpc_slice_buffer message;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer chunk;
+  grpc_slice_buffer received;
+  grpc_slice_buffer_init(&message);
+  grpc_slice_buffer_init(&protected_slices);
+  grpc_slice_buffer_init(&chunk);
+  grpc_slice_buffer_init(&received);
+  for (size_t i = 0; i < num_slices; ++i) {
+    grpc_slice slice = GRPC_SLICE_MALLOC(slice_size);
+    for (size_t j = 0; j < slice_size; ++j) {
+      GRPC_SLICE_START_PTR(slice)[j] = static_cast<uint8_t>(i * 31 + j);
+    }
+    grpc_slice_buffer_add(&message, slice);
+  }
+  std::string expected = ssl_test_slice_buffer_to_string(&message);
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                 sender, &message, &protected_slices) == TSI_OK);
+  GPR_ASSERT(message.length == 0);
+  while (protected_slices.length > 0) {
+    grpc_slice_buffer_move_first(
+        &protected_slices, GPR_MIN(chunk_size, protected_slices.length),
+        &chunk);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(receiver, &chunk,
+                                                      &received) == TSI_OK);
+    GPR_ASSERT(chunk.length == 0);
+  }
+  GPR_ASSERT(ssl_test_slice_buffer_to_string(&received) == expected);
+  grpc_slice_buffer_destroy_internal(&message);
+  grpc_slice_buffer_destroy_internal(&protected_slices);
+  grpc_slice_buffer_destroy_internal(&chunk);
+  grpc_slice_buffer_destroy_internal(&received);
+}
+
+void ssl_tsi_test_do_round_trip_zero_copy() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_round_trip_zero_copy");
+  grpc_core::ExecCtx exec_ctx;
+  tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+  tsi_test_do_handshake(fixture);
+  tsi_zero_copy_grpc_protector* client =
+      ssl_test_create_zero_copy_protector(fixture->client_result);
+  tsi_zero_copy_grpc_protector* server =
+      ssl_test_create_zero_copy_protector(fixture->server_result);
+  size_t max_frame_size = 0;
+  GPR_ASSERT(tsi_zero_copy_grpc_protector_max_frame_size(
+                 client, &max_frame_size) == TSI_OK);
+  GPR_ASSERT(max_frame_size == 16384);
+  // Slices smaller than a record are coalesced, larger ones are sealed in
+  // place, and the peer sees record boundaries at arbitrary offsets.
+  const size_t slice_sizes[] = {1, 100, 4096, 16284, 16385, 100000};
+  const size_t chunk_sizes[] = {1, 1021, 17000, 1000000};
+  for (size_t slice_size : slice_sizes) {
+    for (size_t chunk_size : chunk_sizes) {
+      if (slice_size * 3 / chunk_size > 10000) continue;
+      ssl_test_zero_copy_send_message(client, server, 3, slice_size,
+                                      chunk_size);
+      ssl_test_zero_copy_send_message(server, client, 3, slice_size,
+                                      chunk_size);
+    }
+  }
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+  tsi_test_fixture_destroy(fixture);
+}
+
 void ssl_tsi_test_do_handshake_session_cache() {
   gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_cache");
   tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
@@ -762,6 +885,59 @@ void ssl_tsi_test_do_handshake_session_cache() {
   tsi_ssl_session_cache_unref(session_cache);
 }
 
+void ssl_tsi_test_do_handshake_session_ticket_key_rotation() {
+  gpr_log(GPR_INFO, "ssl_tsi_test_do_handshake_session_ticket_key_rotation");
+  tsi_ssl_session_cache* session_cache = tsi_ssl_session_cache_create_lru(16);
+  tsi_ssl_session_ticket_keys* session_ticket_keys =
+      tsi_ssl_session_ticket_keys_create();
+  char key_a[kSessionTicketEncryptionKeySize];
+  char key_b[kSessionTicketEncryptionKeySize];
+  char key_c[kSessionTicketEncryptionKeySize];
+  memset(key_a, 'a', sizeof(key_a));
+  memset(key_b, 'b', sizeof(key_b));
+  memset(key_c, 'c', sizeof(key_c));
+  // Every handshake uses a new server handshaker factory, as a restarted or
+  // different server would, sharing only the ticket keys.
+  auto do_handshake = [&session_ticket_keys,
+                       &session_cache](bool session_reused) {
+    tsi_test_fixture* fixture = ssl_tsi_test_fixture_create();
+    ssl_tsi_test_fixture* ssl_fixture =
+        reinterpret_cast<ssl_tsi_test_fixture*>(fixture);
+    ssl_fixture->server_name_indication =
+        const_cast<char*>("waterzooi.test.google.be");
+    tsi_ssl_session_ticket_keys_ref(session_ticket_keys);
+    ssl_fixture->session_ticket_keys = session_ticket_keys;
+    tsi_ssl_session_cache_ref(session_cache);
+    ssl_fixture->session_cache = session_cache;
+    ssl_fixture->session_reused = session_reused;
+    tsi_test_do_round_trip(&ssl_fixture->base);
+    tsi_test_fixture_destroy(fixture);
+  };
+  const char* keys_a[] = {key_a};
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_set(session_ticket_keys, keys_a,
+                                             sizeof(key_a), 1) == TSI_OK);
+  do_handshake(false);
+  do_handshake(true);
+  // Rotating a new key in keeps tickets issued under the old one valid.
+  const char* keys_b_a[] = {key_b, key_a};
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_set(session_ticket_keys, keys_b_a,
+                                             sizeof(key_a), 2) == TSI_OK);
+  do_handshake(true);
+  // Once every key a ticket could have been issued under is retired, the
+  // ticket is rejected.
+  const char* keys_c[] = {key_c};
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_set(session_ticket_keys, keys_c,
+                                             sizeof(key_c), 1) == TSI_OK);
+  do_handshake(false);
+  do_handshake(true);
+  // Invalid key sizes are rejected and leave the keys unchanged.
+  GPR_ASSERT(tsi_ssl_session_ticket_keys_set(session_ticket_keys, keys_a,
+                                             sizeof(key_a) - 1, 1) != TSI_OK);
+  do_handshake(true);
+  tsi_ssl_session_ticket_keys_unref(session_ticket_keys);
+  tsi_ssl_session_cache_unref(session_cache);
+}
+
 static const tsi_ssl_handshaker_factory_vtable* original_vtable;
 static bool handshaker_factory_destructor_called;
 
@@ -1002,8 +1178,10 @@ int main(int argc, char** argv) {
     ssl_tsi_test_do_handshake_alpn_server_no_client();
     ssl_tsi_test_do_handshake_alpn_client_server_ok();
     ssl_tsi_test_do_handshake_session_cache();
+    ssl_tsi_test_do_handshake_session_ticket_key_rotation();
     ssl_tsi_test_do_round_trip_for_all_configs();
     ssl_tsi_test_do_round_trip_odd_buffer_size();
+    ssl_tsi_test_do_round_trip_zero_copy();
     ssl_tsi_test_handshaker_factory_internals();
     ssl_tsi_test_duplicate_root_certificates();
     ssl_tsi_test_extract_x509_subject_names();
@@ -16,6 +16,7 @@
  *
  */
 
+#include <google/protobuf/api.pb.h>
 #include <grpc/impl/codegen/byte_buffer.h>
 #include <grpc/slice.h>
 #include <grpcpp/impl/codegen/grpc_library.h>
@@ -91,9 +92,10 @@ TEST_F(ProtoUtilsTest, TinyBackupThenNext) {
 namespace {
 
 // Set backup_size to 0 to indicate no backup is needed.
-void BufferWriterTest(int block_size, int total_size, int backup_size) {
+void BufferWriterTest(int block_size, int total_size, int backup_size,
+                      ProtoBufferWriterBlockPool* block_pool = nullptr) {
   ByteBuffer bb;
-  ProtoBufferWriter writer(&bb, block_size, total_size);
+  ProtoBufferWriter writer(&bb, block_size, total_size, block_pool);
 
   int written_size = 0;
   void* data;
@@ -184,6 +186,201 @@ TEST_F(WriterTest, LargeBlockLargeBackup) {
   BufferWriterTest(4096, 8192, 4095);
 }
 
+TEST_F(WriterTest, PooledBlockTinyBackup) {
+  BufferWriterTest(kProtoBufferWriterMaxBufferLength,
+                   3 * kProtoBufferWriterMaxBufferLength, 1,
+                   ProtoBufferWriterBlockPool::Get());
+}
+
+TEST_F(WriterTest, PooledBlockNoBackup) {
+  BufferWriterTest(kProtoBufferWriterMaxBufferLength,
+                   3 * kProtoBufferWriterMaxBufferLength, 0,
+                   ProtoBufferWriterBlockPool::Get());
+}
+
+TEST_F(WriterTest, PooledBlockLargeBackup) {
+  BufferWriterTest(kProtoBufferWriterMaxBufferLength,
+                   3 * kProtoBufferWriterMaxBufferLength,
+                   kProtoBufferWriterMaxBufferLength - 1,
+                   ProtoBufferWriterBlockPool::Get());
+}
+
+// Blocks return to the pool once the byte buffer is destroyed, and are taken
+// from it by the next message.
+TEST_F(WriterTest, PooledBlocksAreRecycled) {
+  ProtoBufferWriterBlockPool* pool = ProtoBufferWriterBlockPool::Get();
+  const size_t num_blocks = 3;
+  BufferWriterTest(kProtoBufferWriterMaxBufferLength,
+                   num_blocks * kProtoBufferWriterMaxBufferLength, 0, pool);
+  const size_t free_blocks = pool->free_blocks();
+  EXPECT_GE(free_blocks, num_blocks);
+  {
+    ByteBuffer bb;
+    ProtoBufferWriter writer(&bb, kProtoBufferWriterMaxBufferLength,
+                             num_blocks * kProtoBufferWriterMaxBufferLength,
+                             pool);
+    void* data;
+    int size;
+    for (size_t i = 0; i < num_blocks; i++) {
+      ASSERT_TRUE(writer.Next(&data, &size));
+      EXPECT_EQ(size, kProtoBufferWriterMaxBufferLength);
+    }
+    EXPECT_EQ(pool->free_blocks(), free_blocks - num_blocks);
+  }
+  EXPECT_EQ(pool->free_blocks(), free_blocks);
+}
+
+TEST_F(WriterTest, SerializeIntoSingleSlice) {
+  ::google::protobuf::Method method;
+  for (size_t name_size : {0, 10, 1000, 100000}) {
+    method.set_name(std::string(name_size, 'n'));
+    ByteBuffer bb;
+    bool own_buffer;
+    ASSERT_TRUE(SerializationTraits<::google::protobuf::Method>::Serialize(
+                    method, &bb, &own_buffer)
+                    .ok());
+    std::vector<Slice> slices;
+    ASSERT_TRUE(bb.Dump(&slices).ok());
+    ASSERT_EQ(slices.size(), 1u);
+    EXPECT_EQ(slices[0].size(), method.ByteSizeLong());
+  }
+}
+
+TEST_F(WriterTest, SerializeIntoPooledBlocks) {
+  ::google::protobuf::Method method;
+  method.set_name(std::string(2 * kProtoBufferWriterMaxBufferLength, 'n'));
+  ByteBuffer bb;
+  bool own_buffer;
+  ASSERT_TRUE(SerializationTraits<::google::protobuf::Method>::Serialize(
+                  method, &bb, &own_buffer)
+                  .ok());
+  std::vector<Slice> slices;
+  ASSERT_TRUE(bb.Dump(&slices).ok());
+  EXPECT_EQ(slices.size(), 3u);
+  ::google::protobuf::Method parsed;
+  ASSERT_TRUE(SerializationTraits<::google::protobuf::Method>::Deserialize(
+                  &bb, &parsed)
+                  .ok());
+  EXPECT_EQ(parsed.name(), method.name());
+}
+
+// Aliases the request_type_url (2) and response_type_url (4) of a Method.
+using AliasedMethod =
+    experimental::AliasedMessage<::google::protobuf::Method, 2, 4>;
+
+// Returns a byte buffer of data split into slices of at most slice_size bytes.
+ByteBuffer SplitIntoSlices(const std::string& data, size_t slice_size) {
+  std::vector<Slice> slices;
+  for (size_t i = 0; i < data.size(); i += slice_size) {
+    slices.emplace_back(data.data() + i, std::min(slice_size, data.size() - i));
+  }
+  return ByteBuffer(slices.data(), slices.size());
+}
+
+std::string Join(const std::vector<Slice>& slices) {
+  std::string joined;
+  for (const Slice& slice : slices) {
+    joined.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+  }
+  return joined;
+}
+
+class AliasedMessageTest : public ::testing::Test {
+ protected:
+  static void SetUpTestCase() {
+    grpc::internal::GrpcLibraryInitializer init;
+    init.summon();
+    grpc::GrpcLibraryCodegen lib;
+    grpc_init();
+  }
+
+  static void TearDownTestCase() { grpc_shutdown(); }
+
+  AliasedMessageTest() {
+    method_.set_name("name");
+    method_.set_request_type_url(std::string(1000, 'q'));
+    method_.set_request_streaming(true);
+    method_.set_response_type_url("response");
+    method_.add_options()->set_name("option");
+    method_.set_syntax(::google::protobuf::SYNTAX_PROTO3);
+  }
+
+  ::google::protobuf::Method method_;
+};
+
+TEST_F(AliasedMessageTest, RoundTrip) {
+  const std::string serialized = method_.SerializeAsString();
+  for (size_t slice_size : {1, 2, 7, 64, 100000}) {
+    ByteBuffer bb = SplitIntoSlices(serialized, slice_size);
+    AliasedMethod aliased;
+    ASSERT_TRUE(SerializationTraits<AliasedMethod>::Deserialize(&bb, &aliased)
+                    .ok());
+    EXPECT_EQ(Join(aliased.field(2)), method_.request_type_url());
+    EXPECT_EQ(aliased.field_size(2), 1000u);
+    EXPECT_EQ(Join(aliased.field(4)), "response");
+    // The aliased fields are not parsed into the message.
+    EXPECT_TRUE(aliased.message().request_type_url().empty());
+    EXPECT_EQ(aliased.message().name(), "name");
+    EXPECT_TRUE(aliased.message().request_streaming());
+    EXPECT_EQ(aliased.message().options_size(), 1);
+    if (slice_size >= serialized.size()) {
+      // A field within a single slice is a single reference to it.
+      EXPECT_EQ(aliased.field(2).size(), 1u);
+    }
+
+    ByteBuffer out;
+    bool own_buffer;
+    ASSERT_TRUE(
+        SerializationTraits<AliasedMethod>::Serialize(aliased, &out,
+                                                      &own_buffer)
+            .ok());
+    ::google::protobuf::Method method;
+    ASSERT_TRUE(SerializationTraits<::google::protobuf::Method>::Deserialize(
+                    &out, &method)
+                    .ok());
+    EXPECT_EQ(method.SerializeAsString(), serialized);
+  }
+}
+
+TEST_F(AliasedMessageTest, LastValueWins) {
+  ::google::protobuf::Method second;
+  second.set_request_type_url("second");
+  ByteBuffer bb = SplitIntoSlices(
+      method_.SerializeAsString() + second.SerializeAsString(), 5);
+  AliasedMethod aliased;
+  ASSERT_TRUE(
+      SerializationTraits<AliasedMethod>::Deserialize(&bb, &aliased).ok());
+  EXPECT_EQ(Join(aliased.field(2)), "second");
+  EXPECT_EQ(Join(aliased.field(4)), "response");
+}
+
+TEST_F(AliasedMessageTest, TruncatedInputFails) {
+  const std::string serialized = method_.SerializeAsString();
+  for (size_t size : {serialized.size() - 1, size_t(20)}) {
+    ByteBuffer bb = SplitIntoSlices(serialized.substr(0, size), 5);
+    AliasedMethod aliased;
+    EXPECT_FALSE(
+        SerializationTraits<AliasedMethod>::Deserialize(&bb, &aliased).ok());
+  }
+}
+
+TEST_F(AliasedMessageTest, EmptyMessage) {
+  ByteBuffer bb = SplitIntoSlices("", 5);
+  AliasedMethod aliased;
+  *aliased.mutable_field(2) = {Slice("stale")};
+  ASSERT_TRUE(
+      SerializationTraits<AliasedMethod>::Deserialize(&bb, &aliased).ok());
+  EXPECT_TRUE(aliased.field(2).empty());
+  EXPECT_EQ(aliased.field_size(4), 0u);
+
+  ByteBuffer out;
+  bool own_buffer;
+  ASSERT_TRUE(
+      SerializationTraits<AliasedMethod>::Serialize(aliased, &out, &own_buffer)
+          .ok());
+  EXPECT_EQ(out.Length(), 0u);
+}
+
 }  // namespace
 }  // namespace internal
 }  // namespace grpc
@@ -21,7 +21,9 @@
 
 #include "absl/strings/str_cat.h"
 
+#include <grpcpp/ext/metrics_exporter.h>
 #include <grpcpp/ext/proto_server_reflection_plugin.h>
+#include <grpcpp/generic/generic_stub.h>
 #include <grpcpp/grpcpp.h>
 
 #include "src/proto/grpc/reflection/v1alpha/reflection.grpc.pb.h"
@@ -94,6 +96,43 @@ TEST_F(AdminServicesTest, XdsDisabled) {
 }
 #endif  // GRPC_NO_XDS
 
+TEST(MetricsServiceTest, GetOpenMetrics) {
+  experimental::MetricsCounter counter("admin_test_requests", "Test requests");
+  counter.Increment(5);
+  std::string address =
+      absl::StrCat("localhost:", grpc_pick_unused_port_or_die());
+  ServerBuilder builder;
+  builder.AddListeningPort(address, InsecureServerCredentials());
+  experimental::AddMetricsService(&builder);
+  std::unique_ptr<Server> server = builder.BuildAndStart();
+  GenericStub stub(CreateChannel(address, InsecureChannelCredentials()));
+  ClientContext context;
+  CompletionQueue cq;
+  ByteBuffer request;
+  ByteBuffer response;
+  Status status;
+  auto call = stub.PrepareUnaryCall(
+      &context, experimental::kMetricsServiceMethod, request, &cq);
+  call->StartCall();
+  call->Finish(&response, &status, reinterpret_cast<void*>(1));
+  void* tag;
+  bool ok;
+  ASSERT_TRUE(cq.Next(&tag, &ok));
+  ASSERT_TRUE(ok);
+  ASSERT_TRUE(status.ok()) << status.error_message();
+  std::vector<Slice> slices;
+  ASSERT_TRUE(response.Dump(&slices).ok());
+  std::string text;
+  for (const Slice& slice : slices) {
+    text.append(reinterpret_cast<const char*>(slice.begin()), slice.size());
+  }
+  EXPECT_THAT(text, ::testing::HasSubstr("admin_test_requests_total 5\n"));
+  EXPECT_THAT(text, ::testing::HasSubstr("# TYPE grpc_syscall_poll counter"));
+  EXPECT_THAT(text, ::testing::EndsWith("# EOF\n"));
+  server->Shutdown();
+  cq.Shutdown();
+}
+
 }  // namespace testing
 }  // namespace grpc
 
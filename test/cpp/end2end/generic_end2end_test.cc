@@ -17,6 +17,7 @@
  */
 
 #include <memory>
+#include <string>
 #include <thread>
 
 #include <grpc/grpc.h>
@@ -321,6 +322,77 @@ TEST_F(GenericEnd2endTest, SequentialUnaryRpcs) {
   }
 }
 
+// Sends a large message through both ends without copying it in or out of
+// the byte buffers, with experimental::AliasedMessage.
+TEST_F(GenericEnd2endTest, AliasedMessageUnaryRpc) {
+  using AliasedEchoRequest = experimental::AliasedMessage<EchoRequest, 1>;
+  using AliasedEchoResponse = experimental::AliasedMessage<EchoResponse, 1>;
+  ResetStub();
+  TemplatedGenericStub<AliasedEchoRequest, AliasedEchoResponse> aliased_stub(
+      grpc::CreateChannel(server_address_.str(), InsecureChannelCredentials()));
+  const std::string kMethodName("/grpc.cpp.test.util.EchoTestService/Echo");
+  const std::string message(1024 * 1024, 'm');
+
+  AliasedEchoRequest send_request;
+  send_request.mutable_message()->mutable_param()->set_echo_metadata(true);
+  send_request.mutable_field(1)->emplace_back(message.data(),
+                                              message.size() / 2);
+  send_request.mutable_field(1)->emplace_back(
+      message.data() + message.size() / 2, message.size() / 2);
+  AliasedEchoResponse recv_response;
+  Status recv_status;
+  ClientContext cli_ctx;
+  GenericServerContext srv_ctx;
+  GenericServerAsyncReaderWriter stream(&srv_ctx);
+
+  std::thread request_call([this]() { server_ok(4); });
+  std::unique_ptr<ClientAsyncResponseReader<AliasedEchoResponse>> call =
+      aliased_stub.PrepareUnaryCall(&cli_ctx, kMethodName, send_request,
+                                    &cli_cq_);
+  call->StartCall();
+  call->Finish(&recv_response, &recv_status, tag(1));
+  std::thread client_check([this] { client_ok(1); });
+
+  generic_service_.RequestCall(&srv_ctx, &stream, srv_cq_.get(),
+                               srv_cq_.get(), tag(4));
+  request_call.join();
+  EXPECT_EQ(kMethodName, srv_ctx.method());
+
+  ByteBuffer srv_recv_buffer;
+  stream.Read(&srv_recv_buffer, tag(5));
+  server_ok(5);
+  AliasedEchoRequest recv_request;
+  EXPECT_TRUE(SerializationTraits<AliasedEchoRequest>::Deserialize(
+                  &srv_recv_buffer, &recv_request)
+                  .ok());
+  EXPECT_TRUE(recv_request.message().param().echo_metadata());
+  EXPECT_TRUE(recv_request.message().message().empty());
+  EXPECT_EQ(message.size(), recv_request.field_size(1));
+
+  // Echo the received slices back.
+  AliasedEchoResponse send_response;
+  *send_response.mutable_field(1) = recv_request.field(1);
+  ByteBuffer srv_send_buffer;
+  bool own_buffer;
+  EXPECT_TRUE(SerializationTraits<AliasedEchoResponse>::Serialize(
+                  send_response, &srv_send_buffer, &own_buffer)
+                  .ok());
+  stream.Write(srv_send_buffer, tag(6));
+  server_ok(6);
+
+  stream.Finish(Status::OK, tag(7));
+  server_ok(7);
+
+  client_check.join();
+  EXPECT_TRUE(recv_status.ok());
+  std::string recv_message;
+  for (const Slice& slice : recv_response.field(1)) {
+    recv_message.append(reinterpret_cast<const char*>(slice.begin()),
+                        slice.size());
+  }
+  EXPECT_EQ(message, recv_message);
+}
+
 // One ping, one pong.
 TEST_F(GenericEnd2endTest, SimpleBidiStreaming) {
   ResetStub();
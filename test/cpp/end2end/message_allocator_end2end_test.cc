@@ -79,6 +79,22 @@ class CallbackTestServiceImpl
       allocator_mutator_;
 };
 
+// Counts the calls whose request and response share an arena.
+class SyncTestServiceImpl : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    response->set_message(request->message());
+    if (request->GetArena() != nullptr &&
+        request->GetArena() == response->GetArena()) {
+      arena_rpcs++;
+    }
+    return Status::OK;
+  }
+
+  std::atomic_int arena_rpcs{0};
+};
+
 enum class Protocol { INPROC, TCP };
 
 class TestScenario {
@@ -112,6 +128,11 @@ class MessageAllocatorEnd2endTestBase
 
   void CreateServer(
       experimental::MessageAllocator<EchoRequest, EchoResponse>* allocator) {
+    callback_service_.SetMessageAllocatorFor_Echo(allocator);
+    CreateServerFor(&callback_service_);
+  }
+
+  void CreateServerFor(Service* service) {
     ServerBuilder builder;
 
     auto server_creds = GetCredentialsProvider()->GetServerCredentials(
@@ -121,8 +142,7 @@ class MessageAllocatorEnd2endTestBase
       server_address_ << "localhost:" << picked_port_;
       builder.AddListeningPort(server_address_.str(), server_creds);
     }
-    callback_service_.SetMessageAllocatorFor_Echo(allocator);
-    builder.RegisterService(&callback_service_);
+    builder.RegisterService(service);
 
     server_ = builder.BuildAndStart();
   }
@@ -362,6 +382,59 @@ TEST_P(ArenaAllocatorTest, SimpleRpc) {
   EXPECT_EQ(kRpcCount, allocator->allocation_count);
 }
 
+class MessageArenasTest : public MessageAllocatorEnd2endTestBase {};
+
+TEST_P(MessageArenasTest, CallbackRpc) {
+  const int kRpcCount = 10;
+  std::atomic_int arena_rpcs{0};
+  auto mutator = [&arena_rpcs](experimental::RpcAllocatorState* /*state*/,
+                               const EchoRequest* req, EchoResponse* resp) {
+    if (req->GetArena() != nullptr && req->GetArena() == resp->GetArena()) {
+      arena_rpcs++;
+    }
+  };
+  callback_service_.SetAllocatorMutator(mutator);
+  // Smaller than the requests, so that the arenas also need heap blocks.
+  callback_service_.EnableMessageArenas(256);
+  CreateServer(nullptr);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  EXPECT_EQ(kRpcCount, arena_rpcs);
+}
+
+TEST_P(MessageArenasTest, CallbackRpcWithAllocator) {
+  const int kRpcCount = 10;
+  std::unique_ptr<ArenaAllocatorTest::ArenaAllocator> allocator(
+      new ArenaAllocatorTest::ArenaAllocator);
+  callback_service_.EnableMessageArenas(256);
+  CreateServer(allocator.get());
+  ResetStub();
+  SendRpcs(kRpcCount);
+  // The custom allocator takes precedence.
+  EXPECT_EQ(kRpcCount, allocator->allocation_count);
+}
+
+TEST_P(MessageArenasTest, SyncRpc) {
+  const int kRpcCount = 10;
+  SyncTestServiceImpl sync_service;
+  sync_service.EnableMessageArenas(256);
+  CreateServerFor(&sync_service);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  DestroyServer();
+  EXPECT_EQ(kRpcCount, sync_service.arena_rpcs);
+}
+
+TEST_P(MessageArenasTest, SyncRpcWithoutArenas) {
+  const int kRpcCount = 10;
+  SyncTestServiceImpl sync_service;
+  CreateServerFor(&sync_service);
+  ResetStub();
+  SendRpcs(kRpcCount);
+  DestroyServer();
+  EXPECT_EQ(0, sync_service.arena_rpcs);
+}
+
 std::vector<TestScenario> CreateTestScenarios(bool test_insecure) {
   std::vector<TestScenario> scenarios;
   std::vector<std::string> credentials_types{
@@ -397,6 +470,8 @@ INSTANTIATE_TEST_SUITE_P(SimpleAllocatorTest, SimpleAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
 INSTANTIATE_TEST_SUITE_P(ArenaAllocatorTest, ArenaAllocatorTest,
                          ::testing::ValuesIn(CreateTestScenarios(true)));
+INSTANTIATE_TEST_SUITE_P(MessageArenasTest, MessageArenasTest,
+                         ::testing::ValuesIn(CreateTestScenarios(true)));
 
 }  // namespace
 }  // namespace testing
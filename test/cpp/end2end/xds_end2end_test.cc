@@ -8984,6 +8984,41 @@ TEST_P(LocalityMapTest, ReplaceAllLocalitiesInPriority) {
   delayed_resource_setter.join();
 }
 
+// Tests that a stream of EDS updates touching only one locality does not
+// disturb traffic to the other, unchanged locality.
+TEST_P(LocalityMapTest, HighChurnInOneLocality) {
+  SetNextResolution({});
+  SetNextResolutionForLbChannelAllBalancers();
+  const size_t kNumUpdates = 30;
+  AdsServiceImpl::EdsResourceArgs args({
+      {"locality0", GetBackendPorts(0, 1)},
+      {"locality1", GetBackendPorts(1, 2)},
+  });
+  balancers_[0]->ads_service()->SetEdsResource(
+      BuildEdsResource(args, DefaultEdsServiceName()));
+  WaitForAllBackends(0, 2);
+  const grpc_millis start = NowFromCycleCounter();
+  for (size_t i = 0; i < kNumUpdates; ++i) {
+    // Rotate locality1 through backends 1..3, keeping locality0 as is.
+    const size_t backend_idx = 1 + (i + 1) % 3;
+    args = AdsServiceImpl::EdsResourceArgs({
+        {"locality0", GetBackendPorts(0, 1)},
+        {"locality1", GetBackendPorts(backend_idx, backend_idx + 1)},
+    });
+    balancers_[0]->ads_service()->SetEdsResource(
+        BuildEdsResource(args, DefaultEdsServiceName()));
+    // No RPCs should fail while locality1 changes.
+    WaitForBackend(backend_idx, /*reset_counters=*/true,
+                   /*require_success=*/true);
+  }
+  gpr_log(GPR_INFO, "%" PRIuPTR " EDS updates applied in %" PRId64 " ms",
+          kNumUpdates, NowFromCycleCounter() - start);
+  // The unchanged locality keeps serving traffic.
+  ResetBackendCounters();
+  CheckRpcSendOk(100);
+  EXPECT_GT(backends_[0]->backend_service()->request_count(), 0U);
+}
+
 class FailoverTest : public BasicTest {
  public:
   void SetUp() override {
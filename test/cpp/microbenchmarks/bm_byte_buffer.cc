@@ -18,12 +18,17 @@
 
 /* This benchmark exists to show that byte-buffer copy is size-independent */
 
+#include <algorithm>
 #include <memory>
+#include <string>
+#include <vector>
 
 #include <benchmark/benchmark.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
 #include <grpcpp/impl/grpc_library.h>
 #include <grpcpp/support/byte_buffer.h>
 
+#include "src/proto/grpc/testing/echo_messages.pb.h"
 #include "test/core/util/test_config.h"
 #include "test/cpp/microbenchmarks/helpers.h"
 #include "test/cpp/util/test_config.h"
@@ -114,6 +119,74 @@ static void BM_ByteBufferReader_Peek(benchmark::State& state) {
 }
 BENCHMARK(BM_ByteBufferReader_Peek)->Ranges({{64 * 1024, 1024 * 1024}});
 
+// Moves a 4MB payload, the message of an EchoRequest, in and out of byte
+// buffers of state.range(0)-byte slices, either copying it to and from the
+// message or aliasing it with experimental::AliasedMessage.
+constexpr size_t kPayloadSize = 4 * 1024 * 1024;
+using AliasedEchoRequest = experimental::AliasedMessage<EchoRequest, 1>;
+
+// Splits data into slices of at most slice_size bytes.
+static std::vector<grpc::Slice> SplitIntoSlices(const std::string& data,
+                                                size_t slice_size) {
+  std::vector<grpc::Slice> slices;
+  for (size_t i = 0; i < data.size(); i += slice_size) {
+    slices.emplace_back(data.data() + i, std::min(slice_size, data.size() - i));
+  }
+  return slices;
+}
+
+template <class Message>
+static void BM_ByteBuffer_DeserializePayload(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(kPayloadSize, 'a'));
+  const std::vector<grpc::Slice> slices =
+      SplitIntoSlices(request.SerializeAsString(), state.range(0));
+  for (auto _ : state) {
+    // Deserialize() consumes the byte buffer, which only references slices.
+    grpc::ByteBuffer bb(slices.data(), slices.size());
+    Message message;
+    GPR_ASSERT(SerializationTraits<Message>::Deserialize(&bb, &message).ok());
+  }
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK_TEMPLATE(BM_ByteBuffer_DeserializePayload, EchoRequest)
+    ->Arg(16 * 1024)
+    ->Arg(1024 * 1024);
+BENCHMARK_TEMPLATE(BM_ByteBuffer_DeserializePayload, AliasedEchoRequest)
+    ->Arg(16 * 1024)
+    ->Arg(1024 * 1024);
+
+static void BM_ByteBuffer_SerializePayload_Copy(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(kPayloadSize, 'a'));
+  for (auto _ : state) {
+    grpc::ByteBuffer bb;
+    bool own_buffer;
+    GPR_ASSERT(SerializationTraits<EchoRequest>::Serialize(request, &bb,
+                                                           &own_buffer)
+                   .ok());
+  }
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(BM_ByteBuffer_SerializePayload_Copy);
+
+static void BM_ByteBuffer_SerializePayload_Aliased(benchmark::State& state) {
+  AliasedEchoRequest request;
+  *request.mutable_field(1) =
+      SplitIntoSlices(std::string(kPayloadSize, 'a'), state.range(0));
+  for (auto _ : state) {
+    grpc::ByteBuffer bb;
+    bool own_buffer;
+    GPR_ASSERT(SerializationTraits<AliasedEchoRequest>::Serialize(
+                   request, &bb, &own_buffer)
+                   .ok());
+  }
+  state.SetBytesProcessed(state.iterations() * kPayloadSize);
+}
+BENCHMARK(BM_ByteBuffer_SerializePayload_Aliased)
+    ->Arg(16 * 1024)
+    ->Arg(1024 * 1024);
+
 }  // namespace testing
 }  // namespace grpc
 
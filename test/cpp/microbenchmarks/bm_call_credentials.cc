@@ -0,0 +1,267 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the per-call cost of oauth2 call credentials with a cached token */
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/grpc_security.h>
+#include <grpc/support/alloc.h>
+#include <grpc/support/log.h>
+
+#include "absl/strings/str_cat.h"
+
+#include "src/core/lib/gpr/tmpfile.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/iomgr/pollset.h"
+#include "src/core/lib/security/credentials/credentials.h"
+#include "test/core/util/port.h"
+#include "test/core/util/test_config.h"
+
+static const char kTokenResponseBody[] =
+    "{\"access_token\":\"ya29.AHES6ZRN3-HlhAPya30GnW_bHSb_\","
+    " \"expires_in\":3599, "
+    " \"token_type\":\"Bearer\"}";
+
+// A minimal HTTP server standing in for a token exchange service. It answers
+// every request with the same token and closes the connection.
+class TokenServer {
+ public:
+  TokenServer() : port_(grpc_pick_unused_port_or_die()) {
+    fd_ = socket(AF_INET, SOCK_STREAM, 0);
+    GPR_ASSERT(fd_ >= 0);
+    int reuse = 1;
+    setsockopt(fd_, SOL_SOCKET, SO_REUSEADDR, &reuse, sizeof(reuse));
+    struct sockaddr_in addr;
+    memset(&addr, 0, sizeof(addr));
+    addr.sin_family = AF_INET;
+    addr.sin_port = htons(static_cast<uint16_t>(port_));
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    GPR_ASSERT(bind(fd_, reinterpret_cast<struct sockaddr*>(&addr),
+                    sizeof(addr)) == 0);
+    GPR_ASSERT(listen(fd_, 64) == 0);
+    thread_ = grpc_core::Thread("token_server", &TokenServer::Serve, this);
+    thread_.Start();
+  }
+
+  ~TokenServer() {
+    // Unblocks accept().
+    shutdown(fd_, SHUT_RDWR);
+    thread_.Join();
+    close(fd_);
+  }
+
+  int port() const { return port_; }
+  int requests() const { return requests_.load(); }
+
+ private:
+  static void Serve(void* arg) {
+    TokenServer* self = static_cast<TokenServer*>(arg);
+    const std::string response =
+        absl::StrCat("HTTP/1.1 200 OK\r\nContent-Type: application/json\r\n",
+                     "Content-Length: ", strlen(kTokenResponseBody),
+                     "\r\nConnection: close\r\n\r\n", kTokenResponseBody);
+    for (;;) {
+      int client = accept(self->fd_, nullptr, nullptr);
+      if (client < 0) return;
+      ReadRequest(client);
+      GPR_ASSERT(write(client, response.data(), response.size()) ==
+                 static_cast<ssize_t>(response.size()));
+      close(client);
+      self->requests_.fetch_add(1);
+    }
+  }
+
+  // Reads the request headers and body.
+  static void ReadRequest(int fd) {
+    std::string request;
+    size_t expected_size = std::string::npos;
+    while (request.size() < expected_size) {
+      char buf[1024];
+      ssize_t n = read(fd, buf, sizeof(buf));
+      if (n <= 0) return;
+      request.append(buf, static_cast<size_t>(n));
+      size_t headers_end = request.find("\r\n\r\n");
+      if (expected_size == std::string::npos &&
+          headers_end != std::string::npos) {
+        size_t length = request.find("Content-Length: ");
+        expected_size =
+            headers_end + 4 +
+            (length == std::string::npos || length > headers_end
+                 ? 0
+                 : strtoul(request.c_str() + length + 16, nullptr, 10));
+      }
+    }
+  }
+
+  const int port_;
+  int fd_;
+  grpc_core::Thread thread_;
+  std::atomic<int> requests_{0};
+};
+
+static TokenServer* g_token_server;
+static char* g_subject_token_path;
+
+// Polls a pollset on behalf of a call until its request metadata is ready.
+class Poller {
+ public:
+  Poller() {
+    pollset_ = static_cast<grpc_pollset*>(gpr_zalloc(grpc_pollset_size()));
+    grpc_pollset_init(pollset_, &mu_);
+    pollent_ = grpc_polling_entity_create_from_pollset(pollset_);
+    GRPC_CLOSURE_INIT(&on_request_metadata_, OnRequestMetadata, this,
+                      grpc_schedule_on_exec_ctx);
+  }
+
+  ~Poller() {
+    grpc_pollset_shutdown(
+        pollset_, GRPC_CLOSURE_CREATE(DestroyPollset, pollset_,
+                                      grpc_schedule_on_exec_ctx));
+    grpc_core::ExecCtx::Get()->Flush();
+  }
+
+  grpc_polling_entity* pollent() { return &pollent_; }
+  grpc_closure* on_request_metadata() { return &on_request_metadata_; }
+
+  void Wait() {
+    gpr_mu_lock(mu_);
+    while (!done_) {
+      grpc_pollset_worker* worker = nullptr;
+      GPR_ASSERT(GRPC_LOG_IF_ERROR(
+          "pollset_work",
+          grpc_pollset_work(pollset_, &worker,
+                            grpc_core::ExecCtx::Get()->Now() + 1000)));
+      gpr_mu_unlock(mu_);
+      grpc_core::ExecCtx::Get()->Flush();
+      gpr_mu_lock(mu_);
+    }
+    gpr_mu_unlock(mu_);
+  }
+
+ private:
+  static void OnRequestMetadata(void* arg, grpc_error* error) {
+    Poller* self = static_cast<Poller*>(arg);
+    GPR_ASSERT(error == GRPC_ERROR_NONE);
+    gpr_mu_lock(self->mu_);
+    self->done_ = true;
+    GRPC_LOG_IF_ERROR("pollset_kick",
+                      grpc_pollset_kick(self->pollset_, nullptr));
+    gpr_mu_unlock(self->mu_);
+  }
+
+  static void DestroyPollset(void* arg, grpc_error* /*error*/) {
+    grpc_pollset_destroy(static_cast<grpc_pollset*>(arg));
+    gpr_free(arg);
+  }
+
+  gpr_mu* mu_;
+  grpc_pollset* pollset_;
+  grpc_polling_entity pollent_;
+  grpc_closure on_request_metadata_;
+  bool done_ = false;
+};
+
+// Each benchmark thread stands in for a channel with its own credentials
+// object. With range(0) set, all of them are created with the same options
+// and share one cached token; otherwise each has its own.
+static void BM_Oauth2CallCredentials(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  const bool shared = state.range(0) != 0;
+  std::string sts_url =
+      absl::StrCat("http://127.0.0.1:", g_token_server->port(), "/token");
+  std::string audience =
+      shared ? "shared" : absl::StrCat("thread", state.thread_index);
+  grpc_sts_credentials_options options;
+  memset(&options, 0, sizeof(options));
+  options.token_exchange_service_uri = sts_url.c_str();
+  options.audience = audience.c_str();
+  options.subject_token_path = g_subject_token_path;
+  options.subject_token_type = "urn:ietf:params:oauth:token-type:jwt";
+  grpc_call_credentials* creds =
+      grpc_sts_credentials_create(&options, nullptr);
+  GPR_ASSERT(creds != nullptr);
+  grpc_auth_metadata_context context = {"https://foo.com/bar.v1", "Baz",
+                                        nullptr, nullptr};
+  const int requests_before = g_token_server->requests();
+  // Fill the cache.
+  {
+    Poller poller;
+    grpc_credentials_mdelem_array md_array = {};
+    grpc_error* error = GRPC_ERROR_NONE;
+    if (!creds->get_request_metadata(poller.pollent(), context, &md_array,
+                                     poller.on_request_metadata(), &error)) {
+      poller.Wait();
+    }
+    GPR_ASSERT(error == GRPC_ERROR_NONE);
+    GPR_ASSERT(md_array.size == 1);
+    grpc_credentials_mdelem_array_destroy(&md_array);
+  }
+  Poller poller;
+  for (auto _ : state) {
+    grpc_credentials_mdelem_array md_array = {};
+    grpc_error* error = GRPC_ERROR_NONE;
+    GPR_ASSERT(creds->get_request_metadata(poller.pollent(), context,
+                                           &md_array,
+                                           poller.on_request_metadata(),
+                                           &error));
+    grpc_credentials_mdelem_array_destroy(&md_array);
+  }
+  if (state.thread_index == 0) {
+    // Every thread has filled its cache by the time the loop starts.
+    state.counters["token_fetches"] =
+        g_token_server->requests() - requests_before;
+  }
+  creds->Unref();
+}
+BENCHMARK(BM_Oauth2CallCredentials)->Arg(0)->Arg(1)->ThreadRange(1, 16);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+  FILE* subject_token =
+      gpr_tmpfile("bm_call_credentials", &g_subject_token_path);
+  GPR_ASSERT(subject_token != nullptr);
+  fputs("test_subject_token", subject_token);
+  fclose(subject_token);
+  g_token_server = new TokenServer();
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  delete g_token_server;
+  remove(g_subject_token_path);
+  gpr_free(g_subject_token_path);
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,104 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the cost of channelz bookkeeping on hot paths */
+
+#include <benchmark/benchmark.h>
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/channel/channel_args.h"
+#include "src/core/lib/channel/channelz.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+// Call counting on a channel node shared by every benchmark thread, the way
+// all the calls on a channel share its node.
+static grpc_core::channelz::ChannelNode* g_channel_node;
+
+static void BM_ChannelzCallCounting(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    g_channel_node->RecordCallStarted();
+    g_channel_node->RecordCallSucceeded();
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ChannelzCallCounting)->ThreadRange(1, 16);
+
+// Registering and unregistering a node, as every new connection does.
+static void BM_ChannelzRegistry(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  for (auto _ : state) {
+    grpc_core::MakeRefCounted<grpc_core::channelz::ListenSocketNode>(
+        "127.0.0.1:1234", "bm_channelz");
+  }
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ChannelzRegistry)->ThreadRange(1, 16);
+
+// Creating calls on a shared channel, with channelz disabled (arg 0) or
+// enabled (arg 1).
+static grpc_channel* g_channels[2];
+
+static void BM_ChannelzCallCreateDestroy(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_channel* channel = g_channels[state.range(0)];
+  grpc_completion_queue* cq = grpc_completion_queue_create_for_next(nullptr);
+  gpr_timespec deadline = gpr_inf_future(GPR_CLOCK_MONOTONIC);
+  void* method_hdl =
+      grpc_channel_register_call(channel, "/foo/bar", nullptr, nullptr);
+  for (auto _ : state) {
+    grpc_call_unref(grpc_channel_create_registered_call(
+        channel, nullptr, GRPC_PROPAGATE_DEFAULTS, cq, method_hdl, deadline,
+        nullptr));
+  }
+  grpc_completion_queue_destroy(cq);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_ChannelzCallCreateDestroy)->Arg(0)->Arg(1)->ThreadRange(1, 16);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  g_channel_node =
+      new grpc_core::channelz::ChannelNode("bm_channelz", 0, false);
+  for (int enable_channelz = 0; enable_channelz < 2; ++enable_channelz) {
+    grpc_arg arg = grpc_channel_arg_integer_create(
+        const_cast<char*>(GRPC_ARG_ENABLE_CHANNELZ), enable_channelz);
+    grpc_channel_args args = {1, &arg};
+    g_channels[enable_channelz] =
+        grpc_insecure_channel_create("localhost:1234", &args, nullptr);
+  }
+  benchmark::RunTheBenchmarksNamespaced();
+  for (grpc_channel* channel : g_channels) grpc_channel_destroy(channel);
+  g_channel_node->Unref();
+  return 0;
+}
@@ -0,0 +1,174 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark unary calls with nested messages, with and without allocating the
+   server's messages on a per-call arena (Service::EnableMessageArenas) */
+
+#include <benchmark/benchmark.h>
+
+#include <stdlib.h>
+
+#include <atomic>
+#include <new>
+#include <string>
+
+#include "src/proto/grpc/testing/echo.grpc.pb.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/fullstack_fixtures.h"
+#include "test/cpp/util/test_config.h"
+
+// Counts the allocations made with operator new, which is how protobuf
+// allocates messages, strings and repeated fields that are not on an arena.
+// Unlike the memory counters of helpers.h, these do not need a
+// GPR_LOW_LEVEL_COUNTERS build, and do not count core's own allocations.
+static std::atomic<int64_t> g_new_calls{0};
+
+void* operator new(size_t size) {
+  g_new_calls.fetch_add(1, std::memory_order_relaxed);
+  void* p = malloc(size == 0 ? 1 : size);
+  GPR_ASSERT(p != nullptr);
+  return p;
+}
+
+void operator delete(void* p) noexcept { free(p); }
+void operator delete(void* p, size_t /*size*/) noexcept { free(p); }
+
+namespace grpc {
+namespace testing {
+
+// Large enough for the biggest request and response below, so that the arena
+// never needs a block from the heap.
+static const size_t kArenaInitialBlockSize = 64 * 1024;
+
+// Fills the response from several levels of the request, so that both have
+// submessages and strings to allocate.
+static Status EchoNested(const EchoRequest& request, EchoResponse* response) {
+  response->set_message(request.message());
+  const DebugInfo& debug_info = request.param().debug_info();
+  response->mutable_param()->set_host(debug_info.detail());
+  response->mutable_param()->set_peer(
+      debug_info.stack_entries_size() > 0 ? debug_info.stack_entries(0) : "");
+  return Status::OK;
+}
+
+class SyncNestedEchoService : public EchoTestService::Service {
+ public:
+  Status Echo(ServerContext* /*context*/, const EchoRequest* request,
+              EchoResponse* response) override {
+    return EchoNested(*request, response);
+  }
+};
+
+class CallbackNestedEchoService
+    : public EchoTestService::ExperimentalCallbackService {
+ public:
+  experimental::ServerUnaryReactor* Echo(
+      experimental::CallbackServerContext* context, const EchoRequest* request,
+      EchoResponse* response) override {
+    auto* reactor = context->DefaultReactor();
+    reactor->Finish(EchoNested(*request, response));
+    return reactor;
+  }
+};
+
+/*******************************************************************************
+ * BENCHMARKING KERNELS
+ */
+
+// The request carries state.range(0) stack entries, two submessages deep. Each
+// is short enough to be stored inline by std::string, so it costs an
+// allocation off an arena and none on one.
+template <class Fixture, class NestedEchoService, bool kMessageArenas>
+static void BM_NestedMessagePingPong(benchmark::State& state) {
+  NestedEchoService service;
+  if (kMessageArenas) {
+    service.EnableMessageArenas(kArenaInitialBlockSize);
+  }
+  std::unique_ptr<Fixture> fixture(new Fixture(&service));
+  std::unique_ptr<EchoTestService::Stub> stub(
+      EchoTestService::NewStub(fixture->channel()));
+  EchoRequest request;
+  request.set_message(std::string(64, 'm'));
+  RequestParams* param = request.mutable_param();
+  param->set_expected_client_identity(std::string(64, 'c'));
+  param->mutable_expected_error()->set_error_message(std::string(64, 'e'));
+  DebugInfo* debug_info = param->mutable_debug_info();
+  debug_info->set_detail(std::string(64, 'd'));
+  for (int i = 0; i < state.range(0); i++) {
+    debug_info->add_stack_entries("frame " + std::to_string(i));
+  }
+  EchoResponse response;
+  const int64_t new_calls_at_start =
+      g_new_calls.load(std::memory_order_relaxed);
+  for (auto _ : state) {
+    ClientContext cli_ctx;
+    GPR_ASSERT(stub->Echo(&cli_ctx, request, &response).ok());
+  }
+  state.counters["new_calls_per_iteration"] = benchmark::Counter(
+      static_cast<double>(g_new_calls.load(std::memory_order_relaxed) -
+                          new_calls_at_start) /
+      state.iterations());
+  fixture->Finish(state);
+  fixture.reset();
+  state.SetBytesProcessed(
+      static_cast<int64_t>(request.ByteSizeLong() + response.ByteSizeLong()) *
+      state.iterations());
+}
+
+/*******************************************************************************
+ * CONFIGURATIONS
+ */
+
+// Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
+// internal microbenchmarking tooling
+static void SweepStackEntries(benchmark::internal::Benchmark* b) {
+  for (int i = 0; i <= 256; i = i == 0 ? 1 : i * 4) {
+    b->Arg(i);
+  }
+}
+
+BENCHMARK_TEMPLATE(BM_NestedMessagePingPong, InProcess, SyncNestedEchoService,
+                   false)
+    ->Apply(SweepStackEntries);
+BENCHMARK_TEMPLATE(BM_NestedMessagePingPong, InProcess, SyncNestedEchoService,
+                   true)
+    ->Apply(SweepStackEntries);
+BENCHMARK_TEMPLATE(BM_NestedMessagePingPong, InProcess,
+                   CallbackNestedEchoService, false)
+    ->Apply(SweepStackEntries);
+BENCHMARK_TEMPLATE(BM_NestedMessagePingPong, InProcess,
+                   CallbackNestedEchoService, true)
+    ->Apply(SweepStackEntries);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
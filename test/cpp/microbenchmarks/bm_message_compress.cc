@@ -0,0 +1,190 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the compression ratio and throughput of message compression */
+
+#include <random>
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpc/slice_buffer.h>
+
+#include "src/core/lib/compression/message_compress.h"
+#include "src/core/lib/gpr/useful.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+enum Payload {
+  // JSON-like records, typical of API responses.
+  kStructuredText,
+  // Incompressible bytes, like already compressed media.
+  kRandom,
+  // A single repeated byte, like zeroed buffers.
+  kRepeated,
+};
+
+static const char* PayloadName(Payload payload) {
+  switch (payload) {
+    case kStructuredText:
+      return "text";
+    case kRandom:
+      return "random";
+    case kRepeated:
+      return "repeated";
+  }
+  GPR_UNREACHABLE_CODE(return "unknown");
+}
+
+static std::string MakePayload(Payload payload, size_t size) {
+  std::mt19937 rng(42);
+  std::string out;
+  out.reserve(size + 128);
+  switch (payload) {
+    case kStructuredText: {
+      static const char* kNames[] = {"alice", "bob", "carol", "dave", "erin"};
+      while (out.size() < size) {
+        out += "{\"id\":" + std::to_string(rng() % 100000) + ",\"name\":\"" +
+               kNames[rng() % GPR_ARRAY_SIZE(kNames)] +
+               "\",\"score\":" + std::to_string(rng() % 1000) +
+               ",\"active\":" + (rng() % 2 ? "true" : "false") + "},";
+      }
+      break;
+    }
+    case kRandom:
+      while (out.size() < size) out.push_back(static_cast<char>(rng()));
+      break;
+    case kRepeated:
+      out.assign(size, 'a');
+      break;
+  }
+  out.resize(size);
+  return out;
+}
+
+static void SetLabel(benchmark::State& state,
+                     grpc_message_compression_algorithm algorithm,
+                     Payload payload) {
+  const char* name;
+  GPR_ASSERT(grpc_message_compression_algorithm_name(algorithm, &name));
+  state.SetLabel(std::string(name) + "/" + PayloadName(payload));
+}
+
+static void BM_MessageCompress(benchmark::State& state) {
+  const auto algorithm =
+      static_cast<grpc_message_compression_algorithm>(state.range(0));
+  const auto payload = static_cast<Payload>(state.range(1));
+  const size_t size = state.range(2);
+  grpc_core::ExecCtx exec_ctx;
+  const std::string data = MakePayload(payload, size);
+  grpc_slice_buffer input;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input,
+                        grpc_slice_from_copied_buffer(data.data(), size));
+  size_t compressed_size = size;
+  for (auto _ : state) {
+    grpc_msg_compress(algorithm, &input, &output);
+    compressed_size = output.length;
+    grpc_slice_buffer_reset_and_unref(&output);
+  }
+  // Messages that do not shrink are sent uncompressed, for a ratio of 1.
+  state.counters["ratio"] = static_cast<double>(size) / compressed_size;
+  state.SetBytesProcessed(state.iterations() * size);
+  SetLabel(state, algorithm, payload);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&output);
+}
+
+static void BM_MessageDecompress(benchmark::State& state) {
+  const auto algorithm =
+      static_cast<grpc_message_compression_algorithm>(state.range(0));
+  const auto payload = static_cast<Payload>(state.range(1));
+  const size_t size = state.range(2);
+  grpc_core::ExecCtx exec_ctx;
+  const std::string data = MakePayload(payload, size);
+  grpc_slice_buffer input;
+  grpc_slice_buffer compressed;
+  grpc_slice_buffer output;
+  grpc_slice_buffer_init(&input);
+  grpc_slice_buffer_init(&compressed);
+  grpc_slice_buffer_init(&output);
+  grpc_slice_buffer_add(&input,
+                        grpc_slice_from_copied_buffer(data.data(), size));
+  if (!grpc_msg_compress(algorithm, &input, &compressed)) {
+    state.SkipWithError("payload does not compress");
+  }
+  for (auto _ : state) {
+    GPR_ASSERT(grpc_msg_decompress(algorithm, &compressed, &output));
+    grpc_slice_buffer_reset_and_unref(&output);
+  }
+  state.counters["ratio"] = static_cast<double>(size) / compressed.length;
+  state.SetBytesProcessed(state.iterations() * size);
+  SetLabel(state, algorithm, payload);
+  grpc_slice_buffer_destroy(&input);
+  grpc_slice_buffer_destroy(&compressed);
+  grpc_slice_buffer_destroy(&output);
+}
+
+static void CompressArgs(benchmark::internal::Benchmark* b,
+                         bool compressible_only) {
+  // zstd and lz4 are only benchmarked when gRPC is built with them.
+  const uint32_t supported = grpc_compression_bitset_to_message_bitset(
+      grpc_compression_supported_algorithms_bitset());
+  for (int algorithm :
+       {GRPC_MESSAGE_COMPRESS_DEFLATE, GRPC_MESSAGE_COMPRESS_GZIP,
+        GRPC_MESSAGE_COMPRESS_ZSTD, GRPC_MESSAGE_COMPRESS_LZ4}) {
+    if (!GPR_BITGET(supported, algorithm)) continue;
+    for (int payload : {kStructuredText, kRandom, kRepeated}) {
+      if (compressible_only && payload == kRandom) continue;
+      for (int size : {1024, 64 * 1024, 1024 * 1024}) {
+        b->Args({algorithm, payload, size});
+      }
+    }
+  }
+}
+BENCHMARK(BM_MessageCompress)->Apply([](benchmark::internal::Benchmark* b) {
+  CompressArgs(b, false);
+});
+BENCHMARK(BM_MessageDecompress)->Apply([](benchmark::internal::Benchmark* b) {
+  CompressArgs(b, true);
+});
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
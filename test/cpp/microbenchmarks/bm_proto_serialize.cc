@@ -0,0 +1,104 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark serializing messages of various sizes into byte buffers. Build
+   with the counters config to see the allocations per message. */
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpcpp/impl/codegen/proto_utils.h>
+#include <grpcpp/impl/grpc_library.h>
+#include <grpcpp/support/byte_buffer.h>
+
+#include "src/proto/grpc/testing/echo_messages.pb.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+namespace grpc {
+namespace testing {
+
+// Serializes msg through a ProtoBufferWriter of freshly allocated blocks,
+// which is how messages that do not fit in an inlined slice used to be
+// serialized.
+static bool SerializeToFreshBlocks(const protobuf::MessageLite& msg,
+                                   ByteBuffer* bb) {
+  ProtoBufferWriter writer(bb, kProtoBufferWriterMaxBufferLength,
+                           static_cast<int>(msg.ByteSizeLong()));
+  return msg.SerializeToZeroCopyStream(&writer);
+}
+
+// The request carries state.range(0) bytes of message.
+static void BM_ProtoSerialize_FreshBlocks(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(state.range(0), 'a'));
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    ByteBuffer bb;
+    GPR_ASSERT(SerializeToFreshBlocks(request, &bb));
+  }
+  track_counters.Finish(state);
+  state.SetBytesProcessed(state.iterations() * request.ByteSizeLong());
+}
+
+static void BM_ProtoSerialize(benchmark::State& state) {
+  EchoRequest request;
+  request.set_message(std::string(state.range(0), 'a'));
+  TrackCounters track_counters;
+  for (auto _ : state) {
+    ByteBuffer bb;
+    bool own_buffer;
+    GPR_ASSERT(
+        SerializationTraits<EchoRequest>::Serialize(request, &bb, &own_buffer)
+            .ok());
+  }
+  track_counters.Finish(state);
+  state.SetBytesProcessed(state.iterations() * request.ByteSizeLong());
+}
+
+// Replace "benchmark::internal::Benchmark" with "::testing::Benchmark" to use
+// internal microbenchmarking tooling
+static void SweepMessageSizes(benchmark::internal::Benchmark* b) {
+  // From an inlined slice to a chain of several blocks.
+  for (int size : {0, 16, 64, 1024, 64 * 1024, 1024 * 1024, 4 * 1024 * 1024,
+                   16 * 1024 * 1024}) {
+    b->Arg(size);
+  }
+}
+BENCHMARK(BM_ProtoSerialize_FreshBlocks)->Apply(SweepMessageSizes);
+BENCHMARK(BM_ProtoSerialize)->Apply(SweepMessageSizes);
+
+}  // namespace testing
+}  // namespace grpc
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+
+  benchmark::RunTheBenchmarksNamespaced();
+  return 0;
+}
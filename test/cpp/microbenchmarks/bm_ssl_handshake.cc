@@ -0,0 +1,208 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the rate of full and resumed TLS handshakes */
+
+#include <string.h>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/tsi/ssl_transport_security.h"
+#include "test/core/util/test_config.h"
+#include "test/core/util/tls_utils.h"
+
+#define CA_CERT_PATH "src/core/tsi/test_creds/ca.pem"
+#define SERVER_CERT_PATH "src/core/tsi/test_creds/server1.pem"
+#define SERVER_KEY_PATH "src/core/tsi/test_creds/server1.key"
+
+// Enough sessions per benchmark that several session cache shards are used.
+static const size_t kSessionCacheCapacity = 1024;
+
+// Handshaker factories shared by every thread of a benchmark run, the way a
+// channel's security connector shares them across subchannels.
+class Factories {
+ public:
+  Factories(tsi_tls_version tls_version, bool resumption) {
+    std::string ca = grpc_core::testing::GetFileContents(CA_CERT_PATH);
+    std::string cert = grpc_core::testing::GetFileContents(SERVER_CERT_PATH);
+    std::string key = grpc_core::testing::GetFileContents(SERVER_KEY_PATH);
+    tsi_ssl_pem_key_cert_pair key_cert_pair = {key.c_str(), cert.c_str()};
+    tsi_ssl_server_handshaker_options server_options;
+    server_options.pem_key_cert_pairs = &key_cert_pair;
+    server_options.num_key_cert_pairs = 1;
+    server_options.min_tls_version = tls_version;
+    server_options.max_tls_version = tls_version;
+    tsi_ssl_client_handshaker_options client_options;
+    client_options.pem_root_certs = ca.c_str();
+    client_options.min_tls_version = tls_version;
+    client_options.max_tls_version = tls_version;
+    if (resumption) {
+      ticket_keys_ = tsi_ssl_session_ticket_keys_create();
+      char ticket_key[48];
+      memset(ticket_key, 'k', sizeof(ticket_key));
+      const char* ticket_key_data[] = {ticket_key};
+      GPR_ASSERT(tsi_ssl_session_ticket_keys_set(ticket_keys_, ticket_key_data,
+                                                 sizeof(ticket_key),
+                                                 1) == TSI_OK);
+      server_options.session_ticket_keys = ticket_keys_;
+      session_cache_ = tsi_ssl_session_cache_create_lru(kSessionCacheCapacity);
+      client_options.session_cache = session_cache_;
+    }
+    GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
+                   &server_options, &server_factory_) == TSI_OK);
+    GPR_ASSERT(tsi_create_ssl_client_handshaker_factory_with_options(
+                   &client_options, &client_factory_) == TSI_OK);
+  }
+
+  ~Factories() {
+    tsi_ssl_client_handshaker_factory_unref(client_factory_);
+    tsi_ssl_server_handshaker_factory_unref(server_factory_);
+    if (session_cache_ != nullptr) tsi_ssl_session_cache_unref(session_cache_);
+    if (ticket_keys_ != nullptr) {
+      tsi_ssl_session_ticket_keys_unref(ticket_keys_);
+    }
+  }
+
+  // Runs one in-process handshake against |server_name| and returns whether
+  // the session was resumed.
+  bool Handshake(const char* server_name) {
+    tsi_handshaker* client = nullptr;
+    tsi_handshaker* server = nullptr;
+    GPR_ASSERT(tsi_ssl_client_handshaker_factory_create_handshaker(
+                   client_factory_, server_name, &client) == TSI_OK);
+    GPR_ASSERT(tsi_ssl_server_handshaker_factory_create_handshaker(
+                   server_factory_, &server) == TSI_OK);
+    std::string to_client;
+    std::string to_server;
+    tsi_handshaker_result* client_result = nullptr;
+    tsi_handshaker_result* server_result = nullptr;
+    while (client_result == nullptr || server_result == nullptr) {
+      if (client_result == nullptr) {
+        Step(client, &to_client, &to_server, &client_result);
+      }
+      if (server_result == nullptr) {
+        Step(server, &to_server, &to_client, &server_result);
+      }
+    }
+    bool reused = SessionReused(client_result);
+    tsi_handshaker_result_destroy(client_result);
+    tsi_handshaker_result_destroy(server_result);
+    tsi_handshaker_destroy(client);
+    tsi_handshaker_destroy(server);
+    return reused;
+  }
+
+ private:
+  static void Step(tsi_handshaker* handshaker, std::string* received,
+                   std::string* to_send, tsi_handshaker_result** result) {
+    const unsigned char* bytes_to_send = nullptr;
+    size_t bytes_to_send_size = 0;
+    GPR_ASSERT(tsi_handshaker_next(
+                   handshaker,
+                   reinterpret_cast<const unsigned char*>(received->data()),
+                   received->size(), &bytes_to_send, &bytes_to_send_size,
+                   result, nullptr, nullptr) == TSI_OK);
+    received->clear();
+    to_send->append(reinterpret_cast<const char*>(bytes_to_send),
+                    bytes_to_send_size);
+  }
+
+  static bool SessionReused(tsi_handshaker_result* result) {
+    tsi_peer peer;
+    GPR_ASSERT(tsi_handshaker_result_extract_peer(result, &peer) == TSI_OK);
+    const tsi_peer_property* property = tsi_peer_get_property_by_name(
+        &peer, TSI_SSL_SESSION_REUSED_PEER_PROPERTY);
+    bool reused = property != nullptr &&
+                  strncmp(property->value.data, "true",
+                          property->value.length) == 0;
+    tsi_peer_destruct(&peer);
+    return reused;
+  }
+
+  tsi_ssl_session_ticket_keys* ticket_keys_ = nullptr;
+  tsi_ssl_session_cache* session_cache_ = nullptr;
+  tsi_ssl_server_handshaker_factory* server_factory_ = nullptr;
+  tsi_ssl_client_handshaker_factory* client_factory_ = nullptr;
+};
+
+static Factories* g_factories;
+
+static void RunHandshakes(benchmark::State& state, bool resumption) {
+  grpc_core::ExecCtx exec_ctx;
+  if (state.thread_index == 0) {
+    __atomic_store_n(
+        &g_factories,
+        new Factories(static_cast<tsi_tls_version>(state.range(0)), resumption),
+        __ATOMIC_RELEASE);
+  }
+  // Each thread talks to its own server name, and so has its own session
+  // cache entry; the server certificate matches *.test.google.fr.
+  std::string server_name =
+      "thread" + std::to_string(state.thread_index) + ".test.google.fr";
+  // Benchmark threads start together; wait for the factories to exist.
+  while (__atomic_load_n(&g_factories, __ATOMIC_ACQUIRE) == nullptr) {
+  }
+  if (resumption) g_factories->Handshake(server_name.c_str());
+  int64_t resumed = 0;
+  for (auto _ : state) {
+    if (g_factories->Handshake(server_name.c_str())) resumed++;
+  }
+  state.counters["resumed"] = benchmark::Counter(
+      static_cast<double>(resumed), benchmark::Counter::kAvgIterations);
+  if (state.thread_index == 0) {
+    delete g_factories;
+    g_factories = nullptr;
+  }
+}
+
+static void BM_SslFullHandshake(benchmark::State& state) {
+  RunHandshakes(state, false);
+}
+
+static void BM_SslResumedHandshake(benchmark::State& state) {
+  RunHandshakes(state, true);
+}
+
+static void HandshakeArgs(benchmark::internal::Benchmark* b) {
+  for (int tls_version : {static_cast<int>(tsi_tls_version::TSI_TLS1_2),
+                          static_cast<int>(tsi_tls_version::TSI_TLS1_3)}) {
+    b->Arg(tls_version);
+  }
+}
+BENCHMARK(BM_SslFullHandshake)->Apply(HandshakeArgs)->ThreadRange(1, 16);
+BENCHMARK(BM_SslResumedHandshake)->Apply(HandshakeArgs)->ThreadRange(1, 16);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,299 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the SSL frame protector against the SSL zero-copy protector */
+
+#include <string.h>
+
+#include <string>
+
+#include <benchmark/benchmark.h>
+#include <grpc/grpc.h>
+#include <grpc/slice_buffer.h>
+#include <grpc/support/log.h>
+
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "src/core/lib/slice/slice_internal.h"
+#include "src/core/tsi/ssl_transport_security.h"
+#include "src/core/tsi/transport_security_grpc.h"
+#include "test/core/util/test_config.h"
+#include "test/core/util/tls_utils.h"
+
+#define CA_CERT_PATH "src/core/tsi/test_creds/ca.pem"
+#define SERVER_CERT_PATH "src/core/tsi/test_creds/server1.pem"
+#define SERVER_KEY_PATH "src/core/tsi/test_creds/server1.key"
+
+// Size of the staging buffers secure_endpoint copies through when it has to
+// use a tsi_frame_protector.
+static const size_t kStagingBufferSize = 8192;
+
+// Completes an in-process TLS handshake and holds both handshake results.
+class Handshake {
+ public:
+  explicit Handshake(tsi_tls_version tls_version) {
+    std::string ca = grpc_core::testing::GetFileContents(CA_CERT_PATH);
+    std::string cert = grpc_core::testing::GetFileContents(SERVER_CERT_PATH);
+    std::string key = grpc_core::testing::GetFileContents(SERVER_KEY_PATH);
+    tsi_ssl_pem_key_cert_pair key_cert_pair = {key.c_str(), cert.c_str()};
+    tsi_ssl_server_handshaker_options server_options;
+    server_options.pem_key_cert_pairs = &key_cert_pair;
+    server_options.num_key_cert_pairs = 1;
+    server_options.min_tls_version = tls_version;
+    server_options.max_tls_version = tls_version;
+    tsi_ssl_server_handshaker_factory* server_factory = nullptr;
+    GPR_ASSERT(tsi_create_ssl_server_handshaker_factory_with_options(
+                   &server_options, &server_factory) == TSI_OK);
+    tsi_ssl_client_handshaker_options client_options;
+    client_options.pem_root_certs = ca.c_str();
+    client_options.min_tls_version = tls_version;
+    client_options.max_tls_version = tls_version;
+    tsi_ssl_client_handshaker_factory* client_factory = nullptr;
+    GPR_ASSERT(tsi_create_ssl_client_handshaker_factory_with_options(
+                   &client_options, &client_factory) == TSI_OK);
+    tsi_handshaker* client = nullptr;
+    tsi_handshaker* server = nullptr;
+    GPR_ASSERT(tsi_ssl_client_handshaker_factory_create_handshaker(
+                   client_factory, "foo.test.google.fr", &client) == TSI_OK);
+    GPR_ASSERT(tsi_ssl_server_handshaker_factory_create_handshaker(
+                   server_factory, &server) == TSI_OK);
+    while (client_result_ == nullptr || server_result_ == nullptr) {
+      if (client_result_ == nullptr) {
+        Step(client, &to_client_, &to_server_, &client_result_);
+      }
+      if (server_result_ == nullptr) {
+        Step(server, &to_server_, &to_client_, &server_result_);
+      }
+    }
+    tsi_handshaker_destroy(client);
+    tsi_handshaker_destroy(server);
+    tsi_ssl_client_handshaker_factory_unref(client_factory);
+    tsi_ssl_server_handshaker_factory_unref(server_factory);
+  }
+
+  ~Handshake() {
+    tsi_handshaker_result_destroy(client_result_);
+    tsi_handshaker_result_destroy(server_result_);
+  }
+
+  tsi_handshaker_result* client_result() { return client_result_; }
+  tsi_handshaker_result* server_result() { return server_result_; }
+
+  // Bytes that reached the server after its handshake finished, preceded by
+  // the bytes its handshaker read past the end of the handshake. They have to
+  // go through the server's protector first.
+  std::string ServerLeftover() { return Leftover(server_result_, to_server_); }
+
+ private:
+  static void Step(tsi_handshaker* handshaker, std::string* received,
+                   std::string* to_send, tsi_handshaker_result** result) {
+    const unsigned char* bytes_to_send = nullptr;
+    size_t bytes_to_send_size = 0;
+    GPR_ASSERT(tsi_handshaker_next(
+                   handshaker,
+                   reinterpret_cast<const unsigned char*>(received->data()),
+                   received->size(), &bytes_to_send, &bytes_to_send_size,
+                   result, nullptr, nullptr) == TSI_OK);
+    received->clear();
+    to_send->append(reinterpret_cast<const char*>(bytes_to_send),
+                    bytes_to_send_size);
+  }
+
+  static std::string Leftover(tsi_handshaker_result* result,
+                              const std::string& pending) {
+    const unsigned char* unused_bytes = nullptr;
+    size_t unused_bytes_size = 0;
+    GPR_ASSERT(tsi_handshaker_result_get_unused_bytes(
+                   result, &unused_bytes, &unused_bytes_size) == TSI_OK);
+    return std::string(reinterpret_cast<const char*>(unused_bytes),
+                       unused_bytes_size) +
+           pending;
+  }
+
+  tsi_handshaker_result* client_result_ = nullptr;
+  tsi_handshaker_result* server_result_ = nullptr;
+  std::string to_client_;
+  std::string to_server_;
+};
+
+static void MakeMessage(size_t size, grpc_slice_buffer* message) {
+  grpc_slice slice = GRPC_SLICE_MALLOC(size);
+  memset(GRPC_SLICE_START_PTR(slice), 'a', size);
+  grpc_slice_buffer_add(message, slice);
+}
+
+// Mirrors secure_endpoint's frame protector path: plaintext is copied through
+// a staging buffer into the protector, and protected bytes are copied out of
+// a staging buffer into fresh slices, on both the write and the read side.
+static void FrameProtectorProtect(tsi_frame_protector* protector,
+                                  grpc_slice_buffer* unprotected,
+                                  grpc_slice_buffer* protected_slices) {
+  unsigned char staging[kStagingBufferSize];
+  for (size_t i = 0; i < unprotected->count; ++i) {
+    const unsigned char* bytes = GRPC_SLICE_START_PTR(unprotected->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(unprotected->slices[i]);
+    while (remaining > 0) {
+      size_t processed = remaining;
+      size_t staged = sizeof(staging);
+      GPR_ASSERT(tsi_frame_protector_protect(protector, bytes, &processed,
+                                             staging, &staged) == TSI_OK);
+      grpc_slice_buffer_add(protected_slices,
+                            grpc_slice_from_copied_buffer(
+                                reinterpret_cast<char*>(staging), staged));
+      bytes += processed;
+      remaining -= processed;
+    }
+  }
+  size_t still_pending = 0;
+  do {
+    size_t staged = sizeof(staging);
+    GPR_ASSERT(tsi_frame_protector_protect_flush(
+                   protector, staging, &staged, &still_pending) == TSI_OK);
+    grpc_slice_buffer_add(protected_slices,
+                          grpc_slice_from_copied_buffer(
+                              reinterpret_cast<char*>(staging), staged));
+  } while (still_pending > 0);
+  grpc_slice_buffer_reset_and_unref_internal(unprotected);
+}
+
+static void FrameProtectorUnprotect(tsi_frame_protector* protector,
+                                    grpc_slice_buffer* protected_slices,
+                                    grpc_slice_buffer* unprotected) {
+  unsigned char staging[kStagingBufferSize];
+  for (size_t i = 0; i < protected_slices->count; ++i) {
+    const unsigned char* bytes =
+        GRPC_SLICE_START_PTR(protected_slices->slices[i]);
+    size_t remaining = GRPC_SLICE_LENGTH(protected_slices->slices[i]);
+    bool keep_looping = true;
+    while (remaining > 0 || keep_looping) {
+      size_t processed = remaining;
+      size_t staged = sizeof(staging);
+      GPR_ASSERT(tsi_frame_protector_unprotect(protector, bytes, &processed,
+                                               staging, &staged) == TSI_OK);
+      if (staged > 0) {
+        grpc_slice_buffer_add(unprotected,
+                              grpc_slice_from_copied_buffer(
+                                  reinterpret_cast<char*>(staging), staged));
+      }
+      bytes += processed;
+      remaining -= processed;
+      // Keep reading while the staging buffer came back full.
+      keep_looping = staged == sizeof(staging);
+    }
+  }
+  grpc_slice_buffer_reset_and_unref_internal(protected_slices);
+}
+
+static void BM_SslFrameProtector(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  Handshake handshake(static_cast<tsi_tls_version>(state.range(1)));
+  tsi_frame_protector* client = nullptr;
+  tsi_frame_protector* server = nullptr;
+  GPR_ASSERT(tsi_handshaker_result_create_frame_protector(
+                 handshake.client_result(), nullptr, &client) == TSI_OK);
+  GPR_ASSERT(tsi_handshaker_result_create_frame_protector(
+                 handshake.server_result(), nullptr, &server) == TSI_OK);
+  grpc_slice_buffer message;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer_init(&message);
+  grpc_slice_buffer_init(&protected_slices);
+  std::string leftover = handshake.ServerLeftover();
+  if (!leftover.empty()) {
+    grpc_slice_buffer_add(&protected_slices,
+                          grpc_slice_from_cpp_string(std::move(leftover)));
+    FrameProtectorUnprotect(server, &protected_slices, &message);
+    grpc_slice_buffer_reset_and_unref_internal(&message);
+  }
+  const size_t message_size = state.range(0);
+  for (auto _ : state) {
+    MakeMessage(message_size, &message);
+    FrameProtectorProtect(client, &message, &protected_slices);
+    FrameProtectorUnprotect(server, &protected_slices, &message);
+    GPR_ASSERT(message.length == message_size);
+    grpc_slice_buffer_reset_and_unref_internal(&message);
+  }
+  state.SetBytesProcessed(state.iterations() * message_size);
+  grpc_slice_buffer_destroy_internal(&message);
+  grpc_slice_buffer_destroy_internal(&protected_slices);
+  tsi_frame_protector_destroy(client);
+  tsi_frame_protector_destroy(server);
+}
+
+static void BM_SslZeroCopyProtector(benchmark::State& state) {
+  grpc_core::ExecCtx exec_ctx;
+  Handshake handshake(static_cast<tsi_tls_version>(state.range(1)));
+  tsi_zero_copy_grpc_protector* client = nullptr;
+  tsi_zero_copy_grpc_protector* server = nullptr;
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 handshake.client_result(), nullptr, &client) == TSI_OK);
+  GPR_ASSERT(tsi_handshaker_result_create_zero_copy_grpc_protector(
+                 handshake.server_result(), nullptr, &server) == TSI_OK);
+  grpc_slice_buffer message;
+  grpc_slice_buffer protected_slices;
+  grpc_slice_buffer_init(&message);
+  grpc_slice_buffer_init(&protected_slices);
+  std::string leftover = handshake.ServerLeftover();
+  if (!leftover.empty()) {
+    grpc_slice_buffer_add(&protected_slices,
+                          grpc_slice_from_cpp_string(std::move(leftover)));
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                   server, &protected_slices, &message) == TSI_OK);
+    grpc_slice_buffer_reset_and_unref_internal(&message);
+  }
+  const size_t message_size = state.range(0);
+  for (auto _ : state) {
+    MakeMessage(message_size, &message);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_protect(
+                   client, &message, &protected_slices) == TSI_OK);
+    GPR_ASSERT(tsi_zero_copy_grpc_protector_unprotect(
+                   server, &protected_slices, &message) == TSI_OK);
+    GPR_ASSERT(message.length == message_size);
+    grpc_slice_buffer_reset_and_unref_internal(&message);
+  }
+  state.SetBytesProcessed(state.iterations() * message_size);
+  grpc_slice_buffer_destroy_internal(&message);
+  grpc_slice_buffer_destroy_internal(&protected_slices);
+  tsi_zero_copy_grpc_protector_destroy(client);
+  tsi_zero_copy_grpc_protector_destroy(server);
+}
+
+static void ProtectorArgs(benchmark::internal::Benchmark* b) {
+  for (int tls_version : {static_cast<int>(tsi_tls_version::TSI_TLS1_2),
+                          static_cast<int>(tsi_tls_version::TSI_TLS1_3)}) {
+    for (int message_size = 64; message_size <= 4 * 1024 * 1024;
+         message_size *= 8) {
+      b->Args({message_size, tls_version});
+    }
+  }
+}
+BENCHMARK(BM_SslFrameProtector)->Apply(ProtectorArgs);
+BENCHMARK(BM_SslZeroCopyProtector)->Apply(ProtectorArgs);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  grpc_init();
+  ::benchmark::Initialize(&argc, argv);
+  benchmark::RunTheBenchmarksNamespaced();
+  grpc_shutdown();
+  return 0;
+}
@@ -0,0 +1,108 @@
+/*
+ *
+ * Copyright 2021 gRPC authors.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ *
+ */
+
+/* Benchmark the cost of counting stats, with and without concurrent scraping */
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+
+#include <grpc/grpc.h>
+
+#include "src/core/lib/debug/stats.h"
+#include "src/core/lib/gprpp/thd.h"
+#include "src/core/lib/iomgr/exec_ctx.h"
+#include "test/core/util/test_config.h"
+#include "test/cpp/microbenchmarks/helpers.h"
+#include "test/cpp/util/test_config.h"
+
+static grpc_core::StatsCounter* g_counter;
+
+// While set, a background thread scrapes the stats in a loop, as an
+// aggressive monitoring agent would.
+static std::atomic<bool> g_scraping{false};
+static std::atomic<bool> g_shutdown{false};
+
+static void Scrape(void* /*arg*/) {
+  grpc_stats_data data;
+  while (!g_shutdown.load()) {
+    if (!g_scraping.load()) {
+      gpr_sleep_until(gpr_time_add(gpr_now(GPR_CLOCK_MONOTONIC),
+                                   gpr_time_from_millis(1, GPR_TIMESPAN)));
+      continue;
+    }
+    grpc_stats_collect(&data);
+    benchmark::DoNotOptimize(grpc_stats_data_as_openmetrics(&data));
+  }
+}
+
+// Arg is whether the stats are scraped concurrently.
+static void SetScraping(benchmark::State& state) {
+  if (state.thread_index == 0) g_scraping.store(state.range(0) != 0);
+}
+
+static void BM_StatsCounterIncrement(benchmark::State& state) {
+  SetScraping(state);
+  for (auto _ : state) {
+    g_counter->Increment();
+  }
+  if (state.thread_index == 0) g_scraping.store(false);
+}
+BENCHMARK(BM_StatsCounterIncrement)->Arg(0)->Arg(1)->ThreadRange(1, 16);
+
+static void BM_StatsBuiltinIncrement(benchmark::State& state) {
+  TrackCounters track_counters;
+  grpc_core::ExecCtx exec_ctx;
+  SetScraping(state);
+  for (auto _ : state) {
+    GRPC_STATS_INC_SYSCALL_WRITE();
+  }
+  if (state.thread_index == 0) g_scraping.store(false);
+  track_counters.Finish(state);
+}
+BENCHMARK(BM_StatsBuiltinIncrement)->Arg(0)->Arg(1)->ThreadRange(1, 16);
+
+static void BM_StatsScrape(benchmark::State& state) {
+  grpc_stats_data data;
+  for (auto _ : state) {
+    grpc_stats_collect(&data);
+    benchmark::DoNotOptimize(grpc_stats_data_as_openmetrics(&data));
+  }
+}
+BENCHMARK(BM_StatsScrape);
+
+// Some distros have RunSpecifiedBenchmarks under the benchmark namespace,
+// and others do not. This allows us to support both modes.
+namespace benchmark {
+void RunTheBenchmarksNamespaced() { RunSpecifiedBenchmarks(); }
+}  // namespace benchmark
+
+int main(int argc, char** argv) {
+  grpc::testing::TestEnvironment env(argc, argv);
+  LibraryInitializer libInit;
+  ::benchmark::Initialize(&argc, argv);
+  ::grpc::testing::InitTest(&argc, &argv, false);
+  g_counter = new grpc_core::StatsCounter("bm_stats_increments", "");
+  grpc_core::Thread scraper("bm_stats_scraper", Scrape, nullptr);
+  scraper.Start();
+  benchmark::RunTheBenchmarksNamespaced();
+  g_shutdown.store(true);
+  scraper.Join();
+  delete g_counter;
+  return 0;
+}
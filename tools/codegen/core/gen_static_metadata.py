@@ -73,6 +73,8 @@ CONFIG = [
     'deflate',
     'gzip',
     'stream/gzip',
+    'zstd',
+    'lz4',
     # metadata elements
     # begin hpack static elements
     (':authority', ''),
@@ -143,6 +145,8 @@ CONFIG = [
     ('grpc-encoding', 'identity'),
     ('grpc-encoding', 'gzip'),
     ('grpc-encoding', 'deflate'),
+    ('grpc-encoding', 'zstd'),
+    ('grpc-encoding', 'lz4'),
     ('te', 'trailers'),
     ('content-type', 'application/grpc'),
     (':scheme', 'grpc'),
@@ -186,6 +190,8 @@ COMPRESSION_ALGORITHMS = [
     'identity',
     'deflate',
     'gzip',
+    'zstd',
+    'lz4',
 ]
 
 STREAM_COMPRESSION_ALGORITHMS = [
@@ -939,6 +939,7 @@ include/grpcpp/completion_queue.h \
 include/grpcpp/create_channel.h \
 include/grpcpp/create_channel_posix.h \
 include/grpcpp/ext/health_check_service_server_builder_option.h \
+include/grpcpp/ext/network_latency.h \
 include/grpcpp/generic/async_generic_service.h \
 include/grpcpp/generic/generic_stub.h \
 include/grpcpp/grpcpp.h \
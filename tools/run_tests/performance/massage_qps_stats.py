@@ -317,6 +317,9 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_cq_ev_queue_transient_pop_failures"] = massage_qps_stats_helpers.counter(
                     core_stats, "cq_ev_queue_transient_pop_failures")
+            stats[
+                "core_security_handshake_queue_timeouts"] = massage_qps_stats_helpers.counter(
+                    core_stats, "security_handshake_queue_timeouts")
             h = massage_qps_stats_helpers.histogram(core_stats,
                                                     "call_initial_size")
             stats["core_call_initial_size"] = ",".join(
@@ -509,3 +512,33 @@ def massage_qps_stats(scenario_result):
             stats[
                 "core_server_cqs_checked_99p"] = massage_qps_stats_helpers.percentile(
                     h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "security_handshake_queue_time")
+            stats["core_security_handshake_queue_time"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_security_handshake_queue_time_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_security_handshake_queue_time_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_security_handshake_queue_time_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_security_handshake_queue_time_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)
+            h = massage_qps_stats_helpers.histogram(
+                core_stats, "security_handshake_time")
+            stats["core_security_handshake_time"] = ",".join(
+                "%f" % x for x in h.buckets)
+            stats["core_security_handshake_time_bkts"] = ",".join(
+                "%f" % x for x in h.boundaries)
+            stats[
+                "core_security_handshake_time_50p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 50, h.boundaries)
+            stats[
+                "core_security_handshake_time_95p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 95, h.boundaries)
+            stats[
+                "core_security_handshake_time_99p"] = massage_qps_stats_helpers.percentile(
+                    h.buckets, 99, h.boundaries)